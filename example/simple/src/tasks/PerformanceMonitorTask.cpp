@@ -19,8 +19,6 @@ static const uint32_t REPORT_INTERVAL_MS = 30000; // 30 seconds
 static struct {
     uint32_t totalRequests;
     uint32_t successfulRequests;
-    uint32_t cacheHits;
-    uint32_t cacheMisses;
     TickType_t totalResponseTime;
     TickType_t minResponseTime;
     TickType_t maxResponseTime;
@@ -123,21 +121,8 @@ void PerformanceMonitorTask::monitorDataRequest() {
     metrics.dataFreshnessChecks++;
     metrics.totalFreshnessCheckTime += freshnessTime;
     
-    // Monitor connection status check (with caching)
-    static TickType_t lastConnectionCheck = 0;
-    TickType_t now = xTaskGetTickCount();
-    bool wasCached = (now - lastConnectionCheck) < pdMS_TO_TICKS(5000);
-    
-    TickType_t connStart = xTaskGetTickCount();
-    (void)mb8artDevice->refreshConnectionStatus();  // Result used only for timing
-    TickType_t connTime = xTaskGetTickCount() - connStart;
-    
-    if (wasCached && connTime < pdMS_TO_TICKS(5)) {
-        metrics.cacheHits++;
-    } else {
-        metrics.cacheMisses++;
-    }
-    lastConnectionCheck = now;
+    // Connection status check (cache hits are counted by the driver)
+    (void)mb8artDevice->refreshConnectionStatus();
     
     // Monitor temperature request
     TickType_t reqStart = xTaskGetTickCount();
@@ -185,13 +170,22 @@ void PerformanceMonitorTask::generateReport() {
         ESP_LOGI(TASK_TAG, "  Max: %lu ms", pdTICKS_TO_MS(metrics.maxResponseTime));
     }
     
-    // Cache statistics
-    uint32_t totalCacheAccess = metrics.cacheHits + metrics.cacheMisses;
+    // Driver-side bus health counters
+    mb8art::BusMetrics bus = mb8artDevice->getMetrics();
+    ESP_LOGI(TASK_TAG, "Bus Health (%s):", bus.online ? "online" : "offline");
+    ESP_LOGI(TASK_TAG, "  Frames OK: %lu  CRC: %lu  Timeouts: %lu  Exceptions: %lu  Other: %lu",
+             bus.framesOk, bus.crcErrors, bus.timeouts, bus.exceptions, bus.otherErrors);
+    ESP_LOGI(TASK_TAG, "  Queued: %lu  Rejected: %lu  In flight: %u (high-water %u)",
+             bus.requestsQueued, bus.requestsRejected, bus.inFlight, bus.inFlightHighWater);
+    ESP_LOGI(TASK_TAG, "  Data timeouts: %lu  Retries: %lu  Offline/online: %lu/%lu",
+             bus.dataTimeouts, bus.retries, bus.offlineTransitions, bus.onlineTransitions);
+
+    uint32_t totalCacheAccess = bus.cacheHits + bus.cacheMisses;
     ESP_LOGI(TASK_TAG, "Connection Status Cache:");
-    ESP_LOGI(TASK_TAG, "  Hits: %lu", metrics.cacheHits);
-    ESP_LOGI(TASK_TAG, "  Misses: %lu", metrics.cacheMisses);
+    ESP_LOGI(TASK_TAG, "  Hits: %lu", bus.cacheHits);
+    ESP_LOGI(TASK_TAG, "  Misses: %lu", bus.cacheMisses);
     if (totalCacheAccess > 0) {
-        uint32_t hitRateTenths = (metrics.cacheHits * 1000) / totalCacheAccess;
+        uint32_t hitRateTenths = (bus.cacheHits * 1000) / totalCacheAccess;
         ESP_LOGI(TASK_TAG, "  Hit Rate: %lu.%lu%%", hitRateTenths / 10, hitRateTenths % 10);
     }
     
@@ -204,6 +198,22 @@ void PerformanceMonitorTask::generateReport() {
         ESP_LOGI(TASK_TAG, "  Avg Time: %lu ticks (%lu ms)", avgFreshnessTime, avgFreshnessMs);
     }
     
+    // Driver-side latency histograms (microseconds, percentiles by bucket)
+    static const struct {
+        mb8art::LatencyStage stage;
+        const char* name;
+    } latencyStages[] = {
+        {mb8art::LatencyStage::REQUEST_TO_RESPONSE, "Queue+wire"},
+        {mb8art::LatencyStage::DECODE, "Decode"},
+        {mb8art::LatencyStage::END_TO_END, "End-to-end"},
+    };
+    ESP_LOGI(TASK_TAG, "Read Latency (us):");
+    for (const auto& entry : latencyStages) {
+        mb8art::LatencySummary latency = mb8artDevice->getLatency(entry.stage);
+        ESP_LOGI(TASK_TAG, "  %-10s n=%lu p50=%lu p90=%lu p99=%lu max=%lu", entry.name,
+                 latency.count, latency.p50Us, latency.p90Us, latency.p99Us, latency.maxUs);
+    }
+
     // Memory usage
     ESP_LOGI(TASK_TAG, "Memory Usage:");
     ESP_LOGI(TASK_TAG, "  Free Heap: %d bytes", esp_get_free_heap_size());
@@ -30,6 +30,8 @@ struct ModuleSettings {
     uint8_t rs485Address;
     float moduleTemperature = 0.0f;
     bool isTemperatureValid = false;
+    uint16_t equipmentStatus = 0;       // Register 65
+    uint16_t productVersion = 0;        // Register 68: high byte HW, low byte SW (0 = not read)
 };
 
 #endif // COMMON_MODBUS_DEFINITIONS_H
@@ -1,7 +1,6 @@
 // src/MB8ART.cpp
 
 #include "MB8ART.h"
-#include <unordered_map>
 #include <string>
 #include <cmath>  // For NAN
 #include "ModbusDevice.h"  // For ModbusDevice base class
@@ -30,15 +29,16 @@ MB8ART::MB8ART(uint8_t sensorAddress, const char* tag)
     MB8ART_LOG_INIT_STEP("Creating MB8ART instance");
 
     // Create event groups (RYN4 interleaved pattern - saves one event group)
-    xTaskEventGroup = xEventGroupCreate();   // Task communication bits
-    xSensorEventGroup = xEventGroupCreate(); // Interleaved update/error bits: U0 E0 U1 E1 ... U7 E7
-    xInitEventGroup = xEventGroupCreate();   // Initialization step bits
+    // (in-instance storage when MB8ART_STATIC_ALLOCATION is set)
+    xTaskEventGroup = MB8ART_EVENT_GROUP_CREATE(taskEventGroupStorage);     // Task communication bits
+    xSensorEventGroup = MB8ART_EVENT_GROUP_CREATE(sensorEventGroupStorage); // Interleaved update/error bits: U0 E0 U1 E1 ... U7 E7
+    xInitEventGroup = MB8ART_EVENT_GROUP_CREATE(initEventGroupStorage);     // Initialization step bits
 
     // Create initialization mutex
-    initMutex = xSemaphoreCreateMutex();
+    initMutex = MB8ART_MUTEX_CREATE(initMutexStorage);
 
     // Create interface mutex for IDeviceInstance
-    interfaceMutex = xSemaphoreCreateMutex();
+    interfaceMutex = MB8ART_MUTEX_CREATE(interfaceMutexStorage);
 
     // Immediately check if creation was successful
     if (!xTaskEventGroup || !xSensorEventGroup || !xInitEventGroup ||
@@ -51,18 +51,20 @@ MB8ART::MB8ART(uint8_t sensorAddress, const char* tag)
     // Clear all event bits in all groups
     MB8ART_SRP_EVENT_GROUP_CLEAR_BITS(xTaskEventGroup, 0x00FFFFFF);
     MB8ART_SRP_EVENT_GROUP_CLEAR_BITS(xSensorEventGroup, 0x00FFFFFF);
+    taskENTER_CRITICAL(&channelStateMux);
+    sensorEvents.forget(0x00FFFFFF);
+    taskEXIT_CRITICAL(&channelStateMux);
     MB8ART_SRP_EVENT_GROUP_CLEAR_BITS(xInitEventGroup, 0x00FFFFFF);
 
     // Initialize data structures
     initializeDataStructures();
-    
-    // Register callback with ModbusDevice system
-    registerModbusResponseCallback(
-        std::bind(&MB8ART::processModbusResponse, this, 
-                 std::placeholders::_1, 
-                 std::placeholders::_2, 
-                 std::placeholders::_3));
-                 
+
+    // Make the module discoverable (MB8ART_SRP_MB8ART / _BY_ADDRESS / _BY_TAG)
+    if (!MB8ARTSharedResources::registerMB8ART(this)) {
+        LOG_MB8ART_WARN_NL("Instance registry full (MB8ART_MAX_INSTANCES=%d) - 0x%02X not registered",
+                           MB8ART_MAX_INSTANCES, sensorAddress);
+    }
+
     MB8ART_LOG_INIT_STEP("MB8ART instance created successfully");
 }
 
@@ -71,6 +73,11 @@ MB8ART::~MB8ART() {
 }
 
 void MB8ART::cleanup() {
+    // Unregister first so no response or lookup reaches the event groups
+    // while they are deleted (the fast path does not null-check them)
+    unregisterDevice();
+    MB8ARTSharedResources::unregisterMB8ART(this);
+
     // Clean up task event group
     if (xTaskEventGroup) {
         vEventGroupDelete(xTaskEventGroup);
@@ -99,10 +106,7 @@ void MB8ART::cleanup() {
         vSemaphoreDelete(interfaceMutex);
         interfaceMutex = nullptr;
     }
-    
 
-    // Ensure device is unregistered from global map
-    unregisterDevice();
     
     // Log cleanup
     LOG_MB8ART_INFO_NL("MB8ART device cleanup complete");
@@ -118,6 +122,12 @@ bool MB8ART::initializeDevice() {
 
     LOG_MB8ART_INFO_NL("Starting MB8ART initialization for address 0x%02X", getServerAddress());
 
+    // Event groups are required from here on - the event fast path assumes them
+    if (!xSensorEventGroup || !xTaskEventGroup) {
+        LOG_MB8ART_ERROR_NL("Event groups not created - cannot initialize");
+        return false;
+    }
+
     // Register device with ModbusDevice system
     if (registerDevice() != ModbusError::SUCCESS) {
         LOG_MB8ART_ERROR_NL("Failed to register device with ModbusDevice system");
@@ -168,7 +178,7 @@ bool MB8ART::configure() {
 
     // Create init event group if needed
     if (!xInitEventGroup) {
-        xInitEventGroup = xEventGroupCreate();
+        xInitEventGroup = MB8ART_EVENT_GROUP_CREATE(initEventGroupStorage);
         if (!xInitEventGroup) {
             LOG_MB8ART_ERROR_NL("Failed to create init event group");
             return false;
@@ -186,6 +196,7 @@ bool MB8ART::configure() {
 
     for (int attempt = 0; attempt < MAX_BATCH_ATTEMPTS && !batchSuccess; attempt++) {
         if (attempt > 0) {
+            busMetrics.retry();
             LOG_MB8ART_DEBUG_NL("Batch read attempt %d/%d", attempt + 1, MAX_BATCH_ATTEMPTS);
             vTaskDelay(pdMS_TO_TICKS(50 * attempt)); // Progressive backoff: 50ms, 100ms
         }
@@ -204,63 +215,36 @@ bool MB8ART::configure() {
         // STEP 1: Read measurement range synchronously
         MB8ART_LOG_INIT_STEP("Reading measurement range...");
 
-        auto rangeResult = readHoldingRegisters(MEASUREMENT_RANGE_REGISTER, 1);
-        if (!rangeResult.isOk()) {
-            auto category = modbus::ModbusErrorTracker::categorizeError(rangeResult.error());
-            modbus::ModbusErrorTracker::recordError(getServerAddress(), category);
-            LOG_MB8ART_ERROR_NL("Failed to read measurement range - device offline (error: %d)",
-                               static_cast<int>(rangeResult.error()));
+        if (!readRegisterBlock(mb8art::registerDescriptor(mb8art::RegisterId::MEASUREMENT_RANGE))) {
+            LOG_MB8ART_ERROR_NL("Failed to read measurement range - device offline");
             statusFlags.moduleOffline = 1;  // Mark device as offline
             MB8ART_PERF_END(init_module, "Module initialization (failed)");
             return false;
         }
-        modbus::ModbusErrorTracker::recordSuccess(getServerAddress());
 
         // Device responded - mark as online
         statusFlags.moduleOffline = 0;
     
-    currentRange = static_cast<mb8art::MeasurementRange>(rangeResult.value()[0] & 0x01);
     LOG_MB8ART_DEBUG_NL("Measurement range: %s", 
                       (currentRange == mb8art::MeasurementRange::HIGH_RES) ? "HIGH_RES (0.01°C)" : "LOW_RES (0.1°C)");
-    setInitializationBit(InitBits::MEASUREMENT_RANGE);
     setInitializationBit(InitBits::DEVICE_RESPONSIVE);
     
-    // STEP 2: Read module temperature and settings
+    // STEP 2: Read module temperature and settings (best effort, logged by the decoders)
     MB8ART_LOG_INIT_STEP("Reading module settings...");
     
-    // Read module temperature
-    auto tempResult = readHoldingRegisters(MODULE_TEMPERATURE_REGISTER, 1);
-    if (tempResult.isOk() && !tempResult.value().empty()) {
-        moduleSettings.moduleTemperature = tempResult.value()[0] * 0.1f;
-        moduleSettings.isTemperatureValid = true;
-        LOG_MB8ART_DEBUG_NL("Module temperature: %.1f°C", moduleSettings.moduleTemperature);
-    }
-    
-    // Read RS485 address
-    auto addrResult = readHoldingRegisters(RS485_ADDRESS_REGISTER, 1);
-    if (addrResult.isOk() && !addrResult.value().empty()) {
-        moduleSettings.rs485Address = addrResult.value()[0] & 0xFF;
-        LOG_MB8ART_DEBUG_NL("RS485 address: 0x%02X", moduleSettings.rs485Address);
-    }
-    
-    // Read baud rate
-    auto baudResult = readHoldingRegisters(BAUD_RATE_REGISTER, 1);
-    if (baudResult.isOk() && !baudResult.value().empty()) {
-        moduleSettings.baudRate = baudResult.value()[0] & 0xFF;
-        LOG_MB8ART_DEBUG_NL("Baud rate code: %d", moduleSettings.baudRate);
-    }
-    
-    // Read parity
-    auto parityResult = readHoldingRegisters(PARITY_REGISTER, 1);
-    if (parityResult.isOk() && !parityResult.value().empty()) {
-        moduleSettings.parity = parityResult.value()[0] & 0xFF;
-        LOG_MB8ART_DEBUG_NL("Parity code: %d", moduleSettings.parity);
+    const mb8art::RegisterId moduleRegisters[] = {
+        mb8art::RegisterId::MODULE_TEMPERATURE, mb8art::RegisterId::RS485_ADDRESS,
+        mb8art::RegisterId::BAUD_RATE, mb8art::RegisterId::PARITY
+    };
+    for (mb8art::RegisterId id : moduleRegisters) {
+        readRegisterBlock(mb8art::registerDescriptor(id));
     }
     
     // STEP 3: Read channel configurations
     MB8ART_LOG_INIT_STEP("Reading channel configurations...");
     
     for (int i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
+        mb8art::UntrackedTransaction untracked(busMetrics);
         auto configResult = readHoldingRegisters(CHANNEL_CONFIG_REGISTER_START + i, 1);
         if (!configResult.isOk()) {
             auto category = modbus::ModbusErrorTracker::categorizeError(configResult.error());
@@ -457,8 +441,6 @@ bool MB8ART::configure() {
 // Implementation of markChannelDeactivated with char buffer
 // markChannelDeactivated is now in MB8ARTSensor.cpp
 
-// processModbusResponse is now in MB8ARTModbus.cpp
-
 // Configuration methods with error codes
 
 // Enhanced error handling for configuration
@@ -499,15 +481,15 @@ void MB8ART::printChannelDiagnostics() {
                 status += "/DISCONNECTED";
             }
             
-            if (sensorReadings[i].Error) {
+            if (sensorState.hasError(i)) {
                 errorCount++;
                 status += "/ERROR";
             }
             
-            if (sensorReadings[i].isTemperatureValid) {
+            if (sensorState.isValid(i)) {
                 validDataCount++;
                 LOG_MB8ART_INFO_NL("Channel %d: %s - %.2f°C", i, status.c_str(), 
-                                  sensorReadings[i].temperature);
+                                  sensorState.temperature[i]);
             } else {
                 LOG_MB8ART_INFO_NL("Channel %d: %s - No Valid Data", i, status.c_str());
             }
@@ -653,7 +635,9 @@ bool MB8ART::requestConnectionStatus() {
     }
     
     // Read discrete inputs for connection status
-    auto result = readDiscreteInputs(CONNECTION_STATUS_START_REGISTER, DEFAULT_NUMBER_OF_SENSORS);
+    mb8art::RegisterRequest request = mb8art::registerRequest(mb8art::RegisterId::CONNECTION_STATUS);
+    auto result = readDiscreteInputs(request.address, request.count);
+    busMetrics.requestQueued(result.isOk());
 
     if (!result.isOk()) {
         auto category = modbus::ModbusErrorTracker::categorizeError(result.error());
@@ -691,7 +675,10 @@ bool MB8ART::refreshConnectionStatus() {
     TickType_t now = xTaskGetTickCount();
     TickType_t timeSinceLastCheck = now - lastConnectionStatusCheck;
     
-    if (lastConnectionStatusCheck != 0 && timeSinceLastCheck < pdMS_TO_TICKS(CONNECTION_STATUS_CACHE_MS)) {
+    bool cached = lastConnectionStatusCheck != 0 &&
+                  timeSinceLastCheck < pdMS_TO_TICKS(CONNECTION_STATUS_CACHE_MS);
+    busMetrics.cacheLookup(cached);
+    if (cached) {
         // Use cached data
         MB8ART_DEBUG_ONLY(
             LOG_MB8ART_DEBUG_NL("Using cached connection status (age: %d ms)", 
@@ -725,8 +712,6 @@ bool MB8ART::refreshConnectionStatus() {
 
 // hasRecentSensorData is now in MB8ARTSensor.cpp
 
-// batchReadInitialConfig is now in MB8ARTConfig.cpp
-
 // clearPendingResponses is now in MB8ARTModbus.cpp
 
 // probeDevice is now in MB8ARTDevice.cpp
@@ -6,14 +6,33 @@
 #include "freertos/semphr.h"
 #include "freertos/timers.h"
 #include <array>
-#include <functional>
+#include <atomic>
 #include "QueuedModbusDevice.h"
 #include "ModbusTypes.h"
 #include <MutexGuard.h>
 #include <IDeviceInstance.h>
 #include "CommonModbusDefinitions.h"
 #include "MB8ARTLoggingMacros.h"
+#include "MB8ARTAllocation.h"
 #include "MB8ARTSharedResources.h"
+#include "MB8ARTFilters.h"
+#include "MB8ARTStatistics.h"
+#include "MB8ARTSeqLock.h"
+#include "MB8ARTHistory.h"
+#include "MB8ARTRollup.h"
+#include "MB8ARTAlarms.h"
+#include "MB8ARTHold.h"
+#include "MB8ARTSensorState.h"
+#include "MB8ARTEventBits.h"
+#include "MB8ARTLatency.h"
+#include "MB8ARTTrace.h"
+#include "MB8ARTLogLimiter.h"
+#include "MB8ARTMetrics.h"
+#include "MB8ARTRegisters.h"
+#include "MB8ARTChannelModes.h"
+#ifdef MB8ART_ENABLE_MQTT
+#include "MB8ARTPublisher.h"
+#endif
 
 // Import ModbusDevice types into global scope for MB8ART usage
 using modbus::ModbusResult;
@@ -75,6 +94,9 @@ namespace mb8art {
 // This saves one event group (~70 bytes) and allows atomic per-sensor checks
 
 // Update bits (even positions: 0, 2, 4, 6, 8, 10, 12, 14)
+// Set for every active channel decoded from a temperature frame - also when the
+// sample is open, out of range or rejected. Check the error bit, validity or
+// quality code to tell whether the value is usable.
 static constexpr uint32_t SENSOR0_UPDATE_BIT = (1UL << 0UL);
 static constexpr uint32_t SENSOR1_UPDATE_BIT = (1UL << 2UL);
 static constexpr uint32_t SENSOR2_UPDATE_BIT = (1UL << 4UL);
@@ -114,51 +136,16 @@ static constexpr uint32_t ALL_SENSOR_ERROR_BITS =
     SENSOR0_ERROR_BIT | SENSOR1_ERROR_BIT | SENSOR2_ERROR_BIT | SENSOR3_ERROR_BIT |
     SENSOR4_ERROR_BIT | SENSOR5_ERROR_BIT | SENSOR6_ERROR_BIT | SENSOR7_ERROR_BIT;
 
-// Channel and sensor type enums
-enum class ChannelMode : uint16_t {
-    DEACTIVATED = 0x00,
-    THERMOCOUPLE = 0x01,
-    PT_INPUT = 0x02,
-    VOLTAGE = 0x03,
-    CURRENT = 0x04,
-};
-
-// Define sub-types for Thermocouple, PT, Voltage, and Current
-enum class ThermocoupleType : uint16_t {
-    TYPE_J = 0x00,
-    TYPE_K = 0x01,
-    TYPE_T = 0x02,
-    TYPE_E = 0x03,
-    TYPE_R = 0x04,
-    TYPE_S = 0x05,
-    TYPE_B = 0x06,
-    TYPE_N = 0x07
+// Alarm bits (16-23): set while any alarm rule on the channel is active
+// Level-triggered - wait on them with xClearOnExit = pdFALSE
+static constexpr uint32_t SENSOR_ALARM_BITS[8] = {
+    (1UL << 16UL), (1UL << 17UL), (1UL << 18UL), (1UL << 19UL),
+    (1UL << 20UL), (1UL << 21UL), (1UL << 22UL), (1UL << 23UL)
 };
 
-enum class PTType : uint16_t {
-    PT100 = 0x00,
-    PT1000 = 0x01,
-    CU50 = 0x02,
-    CU100 = 0x03
-};
+static constexpr uint32_t ALL_SENSOR_ALARM_BITS = 0x00FF0000UL;
 
-enum class VoltageRange : uint16_t {
-    MV_15 = 0x00,
-    MV_50 = 0x01,
-    MV_100 = 0x02,
-    V_1 = 0x03
-};
-
-enum class CurrentRange : uint16_t {
-    MA_20 = 0x00,
-    MA_4_TO_20 = 0x01
-};
-
-// enum for measurement range configuration
-enum class MeasurementRange {
-    LOW_RES = 0,  // -200 to 850°C, 0.1° resolution
-    HIGH_RES = 1  // -200 to 200°C, 0.01° resolution
-};
+// Channel modes, subtypes and scales: MB8ARTChannelModes.h
 
 // Migration complete - now using IDeviceInstance types directly
 using DeviceError = IDeviceInstance::DeviceError;
@@ -175,7 +162,8 @@ struct SensorReading {
     uint8_t Error : 1;
     uint8_t lastCommandSuccess : 1;  // Track if last command succeeded
     uint8_t isStateConfirmed : 1;    // Track if state has been confirmed
-    uint8_t reserved : 4;            // Reserved for future use
+    uint8_t isRejected : 1;          // Last sample dropped by the spike rejector
+    uint8_t reserved : 3;            // Reserved for future use
 
     // Constructor for initialization
     SensorReading() :
@@ -185,6 +173,7 @@ struct SensorReading {
         Error(0),
         lastCommandSuccess(0),
         isStateConfirmed(0),
+        isRejected(0),
         reserved(0) {}
 };
 
@@ -212,12 +201,40 @@ struct SensorHardwareConfig {
  *
  * This struct contains only the runtime pointers to the application's
  * temperature and validity variables. It's initialized once at startup.
+ *
+ * temperaturePtr is only written for temperature channels (always tenths of
+ * °C, whatever the resolution mode). Voltage and current channels write
+ * analogPtr instead, so a millivolt reading never lands in a °C variable.
  */
 struct SensorBinding {
-    int16_t* temperaturePtr;   // Pointer to temperature in tenths of degrees (Temperature_t)
+    int16_t* temperaturePtr;   // Temperature in tenths of °C (Temperature_t), temperature channels only
     bool* validityPtr;         // Pointer to validity flag in application
+    QualityCode* qualityPtr;   // Optional: why the value is (in)valid, may be omitted/nullptr
+    AnalogValue* analogPtr;    // Optional: voltage/current reading with its unit, may be omitted/nullptr
+};
+
+/**
+ * @brief One Modbus response as seen by the raw-frame tap
+ *
+ * data points into the response buffer and is only valid for the duration
+ * of the callback - copy what you need.
+ */
+struct ModbusFrame {
+    uint8_t functionCode;
+    uint16_t startAddress;     // First register/coil of the request
+    const uint8_t* data;
+    uint16_t length;
+    uint32_t timestampMs;      // Tick time the response was received
 };
 
+/**
+ * @brief Raw-frame tap: plain function pointer plus user context
+ *
+ * Called from the Modbus response context for every response before the
+ * driver decodes it. Keep it short and non-blocking.
+ */
+typedef void (*ModbusResponseCallback)(void* context, const ModbusFrame& frame);
+
 /**
  * @brief Default hardware configuration for all 8 sensor channels
  *
@@ -236,60 +253,6 @@ static constexpr std::array<SensorHardwareConfig, 8> DEFAULT_SENSOR_CONFIG = {{
     {7, SENSOR_UPDATE_BITS[7], SENSOR_ERROR_BITS[7], true}
 }};
 
-// String conversion functions
-inline const char* channelModeToString(ChannelMode mode) {
-    switch (mode) {
-        case ChannelMode::THERMOCOUPLE: return "THERMOCOUPLE";
-        case ChannelMode::PT_INPUT: return "PT_INPUT";
-        case ChannelMode::VOLTAGE: return "VOLTAGE";
-        case ChannelMode::CURRENT: return "CURRENT";
-        case ChannelMode::DEACTIVATED: return "DEACTIVATED";
-        default: return "UNKNOWN";
-    }
-}
-
-inline const char* thermocoupleTypeToString(ThermocoupleType type) {
-    switch (type) {
-        case ThermocoupleType::TYPE_J: return "TYPE_J";
-        case ThermocoupleType::TYPE_K: return "TYPE_K";
-        case ThermocoupleType::TYPE_T: return "TYPE_T";
-        case ThermocoupleType::TYPE_E: return "TYPE_E";
-        case ThermocoupleType::TYPE_R: return "TYPE_R";
-        case ThermocoupleType::TYPE_S: return "TYPE_S";
-        case ThermocoupleType::TYPE_B: return "TYPE_B";
-        case ThermocoupleType::TYPE_N: return "TYPE_N";
-        default: return "UNKNOWN_THERMOCOUPLE_TYPE";
-    }
-}
-
-inline const char* ptTypeToString(PTType type) {
-    switch (type) {
-        case PTType::PT100: return "PT100";
-        case PTType::PT1000: return "PT1000";
-        case PTType::CU50: return "CU50";
-        case PTType::CU100: return "CU100";
-        default: return "UNKNOWN_PT_TYPE";
-    }
-}
-
-inline const char* voltageRangeToString(VoltageRange range) {
-    switch (range) {
-        case VoltageRange::MV_15: return "±15mV";
-        case VoltageRange::MV_50: return "±50mV";
-        case VoltageRange::MV_100: return "±100mV";
-        case VoltageRange::V_1: return "±1V";
-        default: return "UNKNOWN_VOLTAGE_RANGE";
-    }
-}
-
-inline const char* currentRangeToString(CurrentRange range) {
-    switch (range) {
-        case CurrentRange::MA_20: return "±20mA";
-        case CurrentRange::MA_4_TO_20: return "4-20mA";
-        default: return "UNKNOWN_CURRENT_RANGE";
-    }
-}
-
 } // namespace mb8art
 
 class MB8ART : public QueuedModbusDevice, public IDeviceInstance {
@@ -322,7 +285,6 @@ public:
     bool isInitialized() const noexcept override { return statusFlags.initialized; }
     bool isModuleResponsive() const;
     bool batchReadAllConfig();
-    bool batchReadInitialConfig();
 
     /**
      * @brief Bind sensor data pointers (unified mapping API)
@@ -330,7 +292,8 @@ public:
      * This method accepts an array of pointers to application temperature and validity variables.
      * When sensor readings are updated, the library will update these variables directly.
      *
-     * @param bindings Array of 8 SensorBinding structs (temperaturePtr and validityPtr)
+     * @param bindings Array of 8 SensorBinding structs (temperaturePtr, validityPtr,
+     *                 optional qualityPtr and analogPtr)
      *
      * Example usage:
      * @code
@@ -371,7 +334,7 @@ public:
     void handleModbusResponse(uint8_t functionCode, uint16_t address, 
                              const uint8_t* data, size_t length) override;
     void handleModbusError(ModbusError error) override;
-    void invokeModbusResponseCallback(uint8_t functionCode, const uint8_t* data, uint16_t length) const;
+    void invokeModbusResponseCallback(const mb8art::ModbusFrame& frame) const;
     
     // MB8ART specific data methods
     bool requestTemperatures();
@@ -384,6 +347,7 @@ public:
     EventGroupHandle_t getEventGroup() const noexcept override { return xTaskEventGroup; }
 
     // Get the sensor event group (interleaved update/error bits)
+    // Error/alarm bits are driver-owned: wait on them, do not clear them
     EventGroupHandle_t getSensorEventGroup() const noexcept { return xSensorEventGroup; }
 
     // Task notification setup
@@ -403,6 +367,18 @@ public:
     bool reqAddress();
     bool reqBaudRate();
     bool reqParity();
+    bool reqEquipmentStatus();
+    bool reqProductVersion();
+
+    /**
+     * @brief Synchronously read one REGISTER_MAP block and decode it
+     *
+     * Goes through the same decoder as an async response to that block.
+     * Only holding-register blocks can be read this way; temperatures and
+     * connection status use the queued requests.
+     * @return false if offline, the read failed or the value was rejected
+     */
+    bool readRegister(mb8art::RegisterId id);
 
     bool setFactoryReset();
     bool setAddress(uint8_t addressValue);
@@ -425,7 +401,7 @@ public:
 
     // State and status methods
     bool hasModbusResponseCallback() const;
-    const SensorReading& getSensorReading(uint8_t index) const;
+    SensorReading getSensorReading(uint8_t index) const;   // View built from the SoA state
     bool getAllSensorReadings(SensorReading* destination) const;
     bool getSensorConnectionStatus(uint8_t channel) const;
     
@@ -436,6 +412,180 @@ public:
 
     bool isSensorStateConfirmed(uint8_t sensorIndex) const;
 
+    /**
+     * @brief Engineering-unit mapping for analog (voltage/current) channels
+     *
+     * The mapping is applied when a frame is decoded; read the result with
+     * getEngineeringValue(channel) / getEngineeringDivider(channel).
+     * getData() also returns engineering units for mapped channels.
+     */
+    bool setEngineeringScale(uint8_t channel, const mb8art::LinearScale& scale);
+    void clearEngineeringScale(uint8_t channel);
+    int32_t getEngineeringValue(uint8_t channel) const;
+    int16_t getEngineeringDivider(uint8_t channel) const;
+
+    /**
+     * @brief Per-channel filter chain (median -> EMA/Kalman)
+     *
+     * Applied at ingest: getSensorTemperature(), bound pointers and getData()
+     * return the filtered value; getRawValue() returns the unfiltered one.
+     * The filter resets on sensor error, range or channel-mode change.
+     */
+    bool setChannelFilter(uint8_t channel, const mb8art::FilterConfig& config);
+    mb8art::FilterConfig getChannelFilter(uint8_t channel) const;
+    void resetChannelFilter(uint8_t channel);
+    int16_t getRawValue(uint8_t channel) const;
+
+    /**
+     * @brief Per-channel spike/outlier rejection (runs before the filter)
+     *
+     * A rejected sample never reaches the filter or the stored reading. The
+     * channel still sets its update bit (the frame arrived), is held as
+     * UNCERTAIN_REJECTED (bindings keep the held value under a hold policy,
+     * are invalidated otherwise) and sets SensorReading::isRejected.
+     */
+    bool setRejectionConfig(uint8_t channel, const mb8art::RejectionConfig& config);
+    mb8art::RejectionConfig getRejectionConfig(uint8_t channel) const;
+    uint32_t getRejectedSampleCount(uint8_t channel) const;
+    void resetRejectedSampleCounts();
+
+    /**
+     * @brief Rolling min/max/mean/variance over the last N accepted samples
+     *
+     * Updated in O(1) per frame. getChannelStatistics() takes no lock and
+     * never blocks data processing. Window 0 (default) disables a channel.
+     */
+    bool setStatisticsWindow(uint8_t channel, uint8_t samples);
+    mb8art::ChannelStatistics getChannelStatistics(uint8_t channel) const;
+    void resetChannelStatistics(uint8_t channel);
+
+    /**
+     * @brief Latency percentiles of temperature reads (microseconds)
+     *
+     * Request enqueue, response arrival and decode completion are stamped
+     * with esp_timer and folded into log-bucketed histograms per device.
+     * Reads take no lock. Bus start is not visible to the driver, so queue
+     * wait and wire time are reported together as REQUEST_TO_RESPONSE.
+     */
+    mb8art::LatencySummary getLatency(mb8art::LatencyStage stage) const;
+    void resetLatency();
+    static uint32_t getLatencyTimeUs();
+
+    /**
+     * @brief Bus health counters for this device in one snapshot
+     *
+     * Frames, CRC errors, timeouts, exceptions, queued and in-flight
+     * requests, status cache hits, online/offline transitions and the
+     * request-to-response latency. Counters are relaxed atomics updated on
+     * the existing request, response and error paths; reading takes no lock.
+     * resetMetrics() zeroes the counters and the latency histograms.
+     */
+    mb8art::BusMetrics getMetrics() const;
+    void resetMetrics();
+
+    /**
+     * @brief Log the MB8ART_PERF_* / MB8ART_PROFILE_SCOPE counters
+     *
+     * One INFO line per name (count, mean, max, total in microseconds).
+     * The table is process-wide; read it with mb8art::Profiler::snapshot()
+     * and zero it with mb8art::Profiler::reset().
+     */
+    static void logProfile();
+
+    /**
+     * @brief Rate limit for one error/timeout/offline log site
+     *
+     * Token bucket per instance and site: `burst` messages, then one per
+     * `intervalMs`; the next message that passes reports how many were
+     * suppressed. Defaults in mb8art::defaultLogRate(). burst 0 mutes the
+     * site, intervalMs 0 removes the limit.
+     */
+    void setLogRateLimit(mb8art::LogSite site, uint32_t intervalMs, uint8_t burst) {
+        if (site < mb8art::LogSite::COUNT) {
+            logLimiters[site].configure(mb8art::LogRate{intervalMs, burst});
+        }
+    }
+    mb8art::LogRate getLogRateLimit(mb8art::LogSite site) const {
+        return site < mb8art::LogSite::COUNT ? logLimiters[site].getRate() : mb8art::LogRate{0, 0};
+    }
+
+    /**
+     * @brief Record every decoded temperature frame into a compressed history
+     *
+     * The buffer is caller-owned (e.g. a static mb8art::StaticHistory<64>)
+     * and can be read back at any time with history->reader().
+     * Pass nullptr to stop recording.
+     */
+    void attachHistory(mb8art::HistoryBuffer* history) { historyBuffer = history; }
+    mb8art::HistoryBuffer* getHistory() const { return historyBuffer; }
+
+    /**
+     * @brief Record every Modbus transaction into a binary trace ring
+     *
+     * The ring is caller-owned (e.g. a static mb8art::StaticTrace<128, 16>):
+     * temperature requests, every response (with the first payload bytes)
+     * and every error, with microsecond timestamps and round-trip time.
+     * Dump it with trace->dump() and decode with tools/mb8art_trace.py.
+     * Pass nullptr to stop recording.
+     */
+    void attachTrace(mb8art::TraceBuffer* trace) { traceBuffer = trace; }
+    mb8art::TraceBuffer* getTrace() const { return traceBuffer; }
+
+#ifdef MB8ART_ENABLE_MQTT
+    /**
+     * @brief Publish every decoded frame through a batching publisher
+     *
+     * The publisher is caller-owned (usually static) and runs in the frame
+     * path, so its callback must not block - enqueue, don't send. Only
+     * channels that moved beyond their deadband go out, one message per
+     * frame (see MB8ARTPublisher.h). Timeouts and polls refused while
+     * offline offer a frame too, so held/BAD_TIMEOUT values and heartbeats
+     * still go out. Pass nullptr to stop publishing.
+     */
+    void attachPublisher(mb8art::ReadingPublisher* publisher);
+    mb8art::ReadingPublisher* getPublisher() const { return readingPublisher; }
+#endif
+
+    /**
+     * @brief Fold a channel's accepted samples into tiered rollups
+     *
+     * The series is caller-owned (e.g. a static mb8art::StaticRollup<60, 60, 168>)
+     * and is queried directly with series->query(); times are seconds since
+     * boot (getRollupTime()). Pass nullptr to detach.
+     */
+    bool attachRollup(uint8_t channel, mb8art::RollupSeries* series);
+    mb8art::RollupSeries* getRollup(uint8_t channel) const;
+    static uint32_t getRollupTime();
+
+    /**
+     * @brief Per-channel alarm rules evaluated in the decode path
+     *
+     * Up to MB8ART_MAX_ALARM_RULES rules per channel. Transitions set/clear
+     * SENSOR_ALARM_BITS[channel] in the sensor event group and invoke the
+     * callback from the Modbus response context. STALE rules are also
+     * evaluated when waitForData() times out.
+     */
+    bool setAlarmRule(uint8_t channel, uint8_t ruleIndex, const mb8art::AlarmRule& rule);
+    void clearAlarmRules(uint8_t channel);
+    void setAlarmCallback(mb8art::AlarmCallback callback, void* context);
+    uint8_t getActiveAlarms(uint8_t channel) const;  // Bit n = rule n active
+    uint8_t getAlarmedChannels() const { return alarmActiveMask; }
+
+    /**
+     * @brief Keep the last good value through short outages
+     *
+     * With a policy set, channel errors and waitForData() timeouts keep the
+     * bound value valid (optionally extrapolated) until it ages to BAD.
+     * getSnapshot()/getHeldReading() take no lock.
+     */
+    bool setHoldPolicy(uint8_t channel, const mb8art::HoldPolicy& policy);
+    mb8art::HoldPolicy getHoldPolicy(uint8_t channel) const;
+    mb8art::ChannelSnapshot getSnapshot(uint8_t channel) const;
+    mb8art::HeldReading getHeldReading(uint8_t channel) const;
+    // Snapshot values are in binding units: tenths of °C, or getEngineeringDivider() for analog
+    int16_t getSnapshotDivider(uint8_t channel) const;
+    mb8art::QualityCode getQualityCode(uint8_t channel) const { return getHeldReading(channel).code; }
+
     // Event bit handling methods
     void setUpdateEventBits(uint32_t bitsToSet);
     void clearUpdateEventBits(uint32_t bitsToClear);
@@ -490,7 +640,8 @@ public:
     void printModuleSettings() const;
 
     const ModuleSettings& getModuleSettings() const { return moduleSettings; }
-    const SensorReading* getSensorReadings() const { return sensorReadings; }
+    std::array<SensorReading, DEFAULT_NUMBER_OF_SENSORS> getSensorReadings() const;
+    const mb8art::SensorStateTable& getSensorState() const { return sensorState; }
     const mb8art::ChannelConfig* getChannelConfigs() const { return channelConfigs; }
     mb8art::MeasurementRange getCurrentRange() const { return currentRange; }
 
@@ -498,8 +649,8 @@ public:
     BaudRate getStoredBaudRate() const;
     Parity getStoredParity() const;
 
-    // Callback registration
-    void registerModbusResponseCallback(std::function<void(uint8_t functionCode, const uint8_t* data, uint16_t length)> callback);
+    // Callback registration (raw-frame tap, nullptr to remove)
+    void registerModbusResponseCallback(mb8art::ModbusResponseCallback callback, void* context);
 
     // Static utilities
     static BaudRate getBaudRateEnum(uint8_t rawValue);
@@ -616,6 +767,7 @@ private:
     // Unified mapping architecture
     const mb8art::SensorHardwareConfig* hardwareConfig; // Pointer to constexpr hardware config (flash)
     std::array<mb8art::SensorBinding, 8> sensorBindings; // Runtime sensor bindings (RAM)
+    static_assert(sizeof(TickType_t) == sizeof(uint32_t), "SensorStateTable stores 32-bit ticks");
 
     static TickType_t lastGlobalDataUpdate;
     uint8_t channelsConfiguredDuringInit;  // Bitmask to track configured channels during init
@@ -629,7 +781,6 @@ private:
 
     // Helper methods
     bool initializeModuleSettings();  // Returns false if device is offline
-    void processModbusResponse(uint8_t functionCode, const uint8_t* data, uint16_t length);
     void notifyDataReceiver();
 
     // Data processing helpers
@@ -662,6 +813,23 @@ private:
     void updateEventBits(EventBits_t updateBitsToSet, 
                         EventBits_t errorBitsToSet,
                         EventBits_t errorBitsToClear);
+
+    // Apply a sensor event group change with at most one clear and one set
+    // (bookkeeping under channelStateMux, kernel calls outside it)
+    void commitSensorEventBits(EventBits_t toSet, EventBits_t toClear) {
+        taskENTER_CRITICAL(&channelStateMux);
+        mb8art::EventBitsCommit commit = sensorEvents.prepare(toSet, toClear);
+        taskEXIT_CRITICAL(&channelStateMux);
+        if (commit.toClear) {
+            MB8ART_EVENT_GROUP_CLEAR_BITS_FAST(xSensorEventGroup, commit.toClear);
+        }
+        if (commit.toSet) {
+            MB8ART_EVENT_GROUP_SET_BITS_FAST(xSensorEventGroup, commit.toSet);
+        }
+        taskENTER_CRITICAL(&channelStateMux);
+        sensorEvents.finish(commit);
+        taskEXIT_CRITICAL(&channelStateMux);
+    }
     bool checkAllInitBitsSet() const;
     bool waitForInitStep(EventBits_t stepBit, const char* stepName, TickType_t timeout = pdMS_TO_TICKS(5000));
 
@@ -682,6 +850,25 @@ private:
 
     bool requestConnectionStatus();
     void handleConnectionStatus(const uint8_t* data, size_t length);
+
+    // REGISTER_MAP dispatch (MB8ARTModbus.cpp); decoders return true if the
+    // payload was accepted
+    typedef bool (MB8ART::*RegisterDecoder)(const uint8_t* data, size_t length, uint16_t address);
+    bool dispatchRegisterResponse(const mb8art::RegisterDescriptor& reg, const uint8_t* data, size_t length,
+                                  uint16_t address, bool signalWaiters);
+    bool readRegisterBlock(const mb8art::RegisterDescriptor& reg);
+    bool decodeConnectionStatus(const uint8_t* data, size_t length, uint16_t address);
+    bool decodeTemperatures(const uint8_t* data, size_t length, uint16_t address);
+    bool decodeEquipmentStatus(const uint8_t* data, size_t length, uint16_t address);
+    bool decodeModuleTemperature(const uint8_t* data, size_t length, uint16_t address);
+    bool decodeProductVersion(const uint8_t* data, size_t length, uint16_t address);
+    bool decodeModuleBatch(const uint8_t* data, size_t length, uint16_t address);
+    bool decodeRs485Address(const uint8_t* data, size_t length, uint16_t address);
+    bool decodeBaudRate(const uint8_t* data, size_t length, uint16_t address);
+    bool decodeParity(const uint8_t* data, size_t length, uint16_t address);
+    bool decodeMeasurementRange(const uint8_t* data, size_t length, uint16_t address);
+    bool decodeChannelConfig(const uint8_t* data, size_t length, uint16_t address);
+    static const RegisterDecoder REGISTER_DECODERS[];
     void handleDisconnection();
     void updateConnectionStatus(uint8_t channel, bool connected);
     void readOptionalSettings();
@@ -706,15 +893,102 @@ private:
     // Process different sensor types
     int16_t processThermocoupleData(uint16_t rawData, mb8art::ThermocoupleType type);
     int16_t processPTData(uint16_t rawData, mb8art::PTType type, mb8art::MeasurementRange range);
-    int16_t processVoltageData(uint16_t rawData, mb8art::VoltageRange range);   // Note: returns raw value for now
-    int16_t processCurrentData(uint16_t rawData, mb8art::CurrentRange range);   // Note: returns raw value for now
+    int16_t processVoltageData(uint16_t rawData, mb8art::VoltageRange range);   // Fixed-point per VoltageRange
+    int16_t processCurrentData(uint16_t rawData, mb8art::CurrentRange range);   // Hundredths of mA
+    void updateEngineeringValue(uint8_t channel, int16_t value);
+    bool isAnalogChannel(uint8_t channel) const;
+    int16_t getChannelDivider(uint8_t channel) const;      // channelScale divider of the channel
+    const char* channelUnitSuffix(uint8_t channel) const;  // "°C", "mV" or "mA"
+    int16_t getAnalogFullScale(uint8_t channel) const;
+    bool isWithinValidRange(uint8_t channel, int16_t value) const;
+    void updateDecodePlan(uint8_t channel);
+    mb8art::SensorReading makeSensorReading(uint8_t channel) const;
+    int16_t applyChannelFilter(uint8_t channel, int16_t value);
+    bool rejectSample(uint8_t channel, int16_t value, char* statusBuffer,
+                      size_t bufferSize, int& offset);
+    void syncChannelContext(uint8_t channel);
+    void updateChannelStatistics(uint8_t channel, int16_t value);
+    void recordHistoryFrame();
+#ifdef MB8ART_ENABLE_MQTT
+    void publishFrame();
+#endif
+    void evaluateChannelAlarms(uint8_t channel, bool hasValue, bool sensorOpen, int16_t value);
+    void evaluateStaleAlarms(uint8_t channelMask);
+    void publishAlarmBits();
+    void collectAlarmBits(EventBits_t& toSet, EventBits_t& toClear);
+    void recordChannelSnapshot(uint8_t channel, int32_t bindingValue);
+    void holdChannel(uint8_t channel, mb8art::QualityCode reason);
+    void writeBoundValue(uint8_t channel, int32_t bindingValue);
+    void ageSilentChannels(uint8_t channelMask);
+    void resetChannelSnapshot(uint8_t channel);
     int16_t convertRawToTemperature(uint16_t rawData, bool highResolution);
     int16_t applyTemperatureCorrection(int16_t temperature);
 
     // Member variables for state tracking
     ModuleSettings moduleSettings;
-    mb8art::SensorReading sensorReadings[DEFAULT_NUMBER_OF_SENSORS];
+    mb8art::SensorStateTable sensorState;  // Structure-of-arrays per-channel state
     // Note: channelConfigs and currentRange are protected for test access
+
+    // Engineering-unit mapping for analog channels (computed at ingest)
+    mb8art::LinearScale engineeringScales[DEFAULT_NUMBER_OF_SENSORS] = {};
+    int32_t engineeringValues[DEFAULT_NUMBER_OF_SENSORS] = {};
+
+    // Per-channel rejection/filter state and last unfiltered value
+    mb8art::ChannelFilter channelFilters[DEFAULT_NUMBER_OF_SENSORS];
+    int16_t rawValues[DEFAULT_NUMBER_OF_SENSORS] = {};
+    mb8art::SpikeRejector spikeRejectors[DEFAULT_NUMBER_OF_SENSORS];
+    uint32_t rejectedSamples[DEFAULT_NUMBER_OF_SENSORS] = {};
+    uint16_t channelContextKeys[DEFAULT_NUMBER_OF_SENSORS] = {};
+
+    // Rolling statistics (written under channelStateMux, read lock-free via seqlock)
+    mb8art::RollingStatistics channelStatistics[DEFAULT_NUMBER_OF_SENSORS];
+    mb8art::SeqLock<mb8art::ChannelStatistics> statisticsSnapshots[DEFAULT_NUMBER_OF_SENSORS];
+
+    // Temperature read latency (recorded from the response context, read lock-free)
+    mb8art::LatencyHistogram latencyHistograms[static_cast<uint8_t>(mb8art::LatencyStage::COUNT)];
+    std::atomic<uint32_t> pendingRequestUs{0};  // Enqueue time of the outstanding read, 0 = none
+    void recordReadLatency(uint32_t receivedUs);
+
+    // Last-good-value snapshots (writer copy under channelStateMux, published via seqlock)
+    mb8art::ChannelSnapshot channelSnapshots[DEFAULT_NUMBER_OF_SENSORS];
+    mb8art::SeqLock<mb8art::ChannelSnapshot> publishedSnapshots[DEFAULT_NUMBER_OF_SENSORS];
+
+    // Optional compressed history (caller-owned, fed from processTemperatureData)
+    mb8art::HistoryBuffer* historyBuffer = nullptr;
+
+    // Optional transaction trace (caller-owned, fed from request/response/error paths)
+    mb8art::TraceBuffer* traceBuffer = nullptr;
+
+#ifdef MB8ART_ENABLE_MQTT
+    // Optional reading publisher (caller-owned, fed from processTemperatureData
+    // and ageSilentChannels)
+    mb8art::ReadingPublisher* readingPublisher = nullptr;
+    std::atomic<bool> publishingFrame{false};   // One offerFrame() at a time across both paths
+#endif
+    // requestedUs: stamp of the request this event answers (RTT), 0 = unknown
+    void traceTransaction(mb8art::TraceKind kind, uint8_t functionCode, uint16_t address,
+                          uint8_t result, const uint8_t* data, size_t length, uint32_t nowUs,
+                          uint32_t requestedUs = 0);
+
+    // Per-site log rate limiters (error, timeout and offline messages)
+    mb8art::LogLimiterTable logLimiters;
+
+    // Bus health counters (relaxed atomics, read by getMetrics())
+    mb8art::BusMetricsCounters busMetrics;
+
+    // Optional per-channel rollups (caller-owned, fed with accepted samples)
+    mb8art::RollupSeries* rollupSeries[DEFAULT_NUMBER_OF_SENSORS] = {};
+
+    // Alarm rules/state and transition callback (function pointer + context)
+    mb8art::ChannelAlarms channelAlarms[DEFAULT_NUMBER_OF_SENSORS];
+    mb8art::AlarmCallback alarmCallback = nullptr;
+    void* alarmCallbackContext = nullptr;
+    uint8_t alarmConfiguredMask = 0;   // Channels with at least one rule
+    uint8_t alarmActiveMask = 0;       // Channels with at least one active alarm (channelStateMux)
+
+    // Serializes configuration calls against the decode path for the
+    // per-channel rejection, filter, statistics, alarm and hold state
+    mutable portMUX_TYPE channelStateMux = portMUX_INITIALIZER_UNLOCKED;
     
     // Passive responsiveness tracking (from RYN4 suggestion)
     TickType_t lastResponseTime = 0;
@@ -738,6 +1012,9 @@ private:
     // Event groups (RYN4 interleaved pattern)
     EventGroupHandle_t xTaskEventGroup;    // Task communication bits (DATA_READY, DATA_ERROR, etc.)
     EventGroupHandle_t xSensorEventGroup;  // Interleaved update/error bits: U0 E0 U1 E1 ... U7 E7
+
+    // Error/alarm bits that may be set in xSensorEventGroup (skips no-op clears, channelStateMux)
+    mb8art::SensorEventPublisher sensorEvents{mb8art::ALL_SENSOR_ERROR_BITS | mb8art::ALL_SENSOR_ALARM_BITS};
     EventGroupHandle_t xInitEventGroup;    // Initialization step bits
 
     // Initialization event group uses bits 0-23 (no shifting needed)
@@ -746,13 +1023,23 @@ private:
     SemaphoreHandle_t initMutex;
     SemaphoreHandle_t interfaceMutex;  // For IDeviceInstance interface
 
+#if MB8ART_STATIC_ALLOCATION
+    // Backing storage for the handles above (see MB8ARTAllocation.h)
+    StaticEventGroup_t taskEventGroupStorage;
+    StaticEventGroup_t sensorEventGroupStorage;
+    StaticEventGroup_t initEventGroupStorage;
+    StaticSemaphore_t initMutexStorage;
+    StaticSemaphore_t interfaceMutexStorage;
+#endif
+
     // Task handles for notifications
     TaskHandle_t dataReceiverTask;     // Task to notify when data arrives
 
     // Callback storage
     TickType_t lastReportReceivedTime;
     TimerHandle_t missedReportTimer;
-    std::function<void(uint8_t functionCode, const uint8_t* data, uint16_t length)> modbusResponseCallback;
+    mb8art::ModbusResponseCallback modbusResponseCallback = nullptr;
+    void* modbusResponseCallbackContext = nullptr;
 
     // Expected update interval in milliseconds
     static uint32_t expectedUpdateIntervalMs;
@@ -766,17 +1053,23 @@ private:
     static constexpr TickType_t INIT_TOTAL_TIMEOUT = pdMS_TO_TICKS(1500);   // 1.5s total
     static constexpr TickType_t INTER_REQUEST_DELAY = pdMS_TO_TICKS(10);    // 10ms between requests
 
-    // Register addresses
-    static constexpr uint16_t CONNECTION_STATUS_START_REGISTER = 0;            // Starting register for connection status
-    static constexpr uint16_t MEASUREMENT_RANGE_REGISTER = 76;                 // Measurement range register
-    static constexpr uint16_t CHANNEL_CONFIG_REGISTER_START = 128;             // Start of channel configuration registers
-    static constexpr uint16_t TEMPERATURE_REGISTER_START = 0;                  // Start of temperature registers
+    // Register addresses (from mb8art::REGISTER_MAP, see MB8ARTRegisters.h)
+    static constexpr uint16_t CONNECTION_STATUS_START_REGISTER =
+        mb8art::registerDescriptor(mb8art::RegisterId::CONNECTION_STATUS).address;
+    static constexpr uint16_t MEASUREMENT_RANGE_REGISTER =
+        mb8art::registerDescriptor(mb8art::RegisterId::MEASUREMENT_RANGE).address;
+    static constexpr uint16_t CHANNEL_CONFIG_REGISTER_START =
+        mb8art::registerDescriptor(mb8art::RegisterId::CHANNEL_CONFIG).address;
+    static constexpr uint16_t TEMPERATURE_REGISTER_START =
+        mb8art::registerDescriptor(mb8art::RegisterId::TEMPERATURES).address;
 
     // Optional settings registers
-    static constexpr uint16_t MODULE_TEMPERATURE_REGISTER = 67;                // Module temperature register
-    static constexpr uint16_t RS485_ADDRESS_REGISTER = 70;                     // RS485 Address register
-    static constexpr uint16_t BAUD_RATE_REGISTER = 71;                         // RS485 Baud Rate register
-    static constexpr uint16_t PARITY_REGISTER = 72;                            // RS485 Parity register
+    static constexpr uint16_t RS485_ADDRESS_REGISTER =
+        mb8art::registerDescriptor(mb8art::RegisterId::RS485_ADDRESS).address;
+    static constexpr uint16_t BAUD_RATE_REGISTER =
+        mb8art::registerDescriptor(mb8art::RegisterId::BAUD_RATE).address;
+    static constexpr uint16_t PARITY_REGISTER =
+        mb8art::registerDescriptor(mb8art::RegisterId::PARITY).address;
 
     // Response timeout settings
     static constexpr TickType_t MB8ART_RESPONSE_TIMEOUT_MS = pdMS_TO_TICKS(1000);
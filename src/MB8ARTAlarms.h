@@ -0,0 +1,227 @@
+#ifndef MB8ART_ALARMS_H
+#define MB8ART_ALARMS_H
+
+#include <stdint.h>
+
+/**
+ * @file MB8ARTAlarms.h
+ * @brief Declarative per-channel alarm rules evaluated at ingest
+ *
+ * Rules are checked in the decode path right after a channel's sample is
+ * accepted, so a reaction (event bit, callback) happens in the same cycle
+ * the frame arrived instead of at the consumer's next poll.
+ *
+ * Thresholds use the channel's native fixed-point unit (tenths/hundredths °C,
+ * see getDataScaleDivider). Storage is fixed: MB8ART_MAX_ALARM_RULES rules
+ * per channel, no heap.
+ */
+
+// Rules per channel (each costs ~20 bytes × 8 channels)
+#ifndef MB8ART_MAX_ALARM_RULES
+    #ifdef PROJECT_MB8ART_MAX_ALARM_RULES
+        #define MB8ART_MAX_ALARM_RULES PROJECT_MB8ART_MAX_ALARM_RULES
+    #else
+        #define MB8ART_MAX_ALARM_RULES 4
+    #endif
+#endif
+
+static_assert(MB8ART_MAX_ALARM_RULES > 0 && MB8ART_MAX_ALARM_RULES <= 8,
+              "MB8ART_MAX_ALARM_RULES must be 1..8 (active rules form a uint8_t mask)");
+
+namespace mb8art {
+
+enum class AlarmType : uint8_t {
+    NONE = 0,
+    HIGH = 1,          // value >= threshold, clears below threshold - hysteresis
+    LOW = 2,           // value <= threshold, clears above threshold + hysteresis
+    RATE_OF_RISE = 3,  // rise >= threshold counts per minute
+    STALE = 4,         // no valid sample for threshold seconds
+    SENSOR_OPEN = 5    // module reports open circuit (0x7530)
+};
+
+struct AlarmRule {
+    AlarmType type = AlarmType::NONE;
+    int16_t threshold = 0;
+    int16_t hysteresis = 0;      // HIGH / LOW / RATE_OF_RISE only
+    uint16_t onDelayMs = 0;      // Condition must hold this long before raising
+    uint16_t offDelayMs = 0;     // Clear condition must hold this long before clearing
+};
+
+/**
+ * @brief What the decode path knows about a channel in this cycle
+ */
+struct AlarmInput {
+    bool hasValue;        // A valid, accepted sample arrived
+    bool sensorOpen;      // Channel reported 0x7530
+    int16_t value;
+    uint32_t nowMs;
+};
+
+/**
+ * @brief Rules and state for one channel
+ */
+class ChannelAlarms {
+public:
+    bool setRule(uint8_t index, const AlarmRule& rule) {
+        if (index >= MB8ART_MAX_ALARM_RULES) {
+            return false;
+        }
+        rules[index] = rule;
+        states[index] = RuleState();
+        activeMask &= static_cast<uint8_t>(~(1u << index));
+        return true;
+    }
+
+    const AlarmRule& getRule(uint8_t index) const { return rules[index < MB8ART_MAX_ALARM_RULES ? index : 0]; }
+
+    void clear() {
+        for (uint8_t i = 0; i < MB8ART_MAX_ALARM_RULES; i++) {
+            rules[i] = AlarmRule();
+            states[i] = RuleState();
+        }
+        activeMask = 0;
+        hasLastValue = false;
+        hasLastValid = false;
+    }
+
+    bool hasRules() const {
+        for (uint8_t i = 0; i < MB8ART_MAX_ALARM_RULES; i++) {
+            if (rules[i].type != AlarmType::NONE) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint8_t getActiveMask() const { return activeMask; }
+
+    /**
+     * @brief Evaluate all rules for this cycle
+     * @return Mask of rules whose active state changed
+     */
+    uint8_t evaluate(const AlarmInput& input) {
+        int64_t ratePerMinute = 0;
+        bool rateKnown = false;
+        if (input.hasValue) {
+            if (hasLastValue && input.nowMs != lastValueMs) {
+                // 64-bit: a full-range delta × 60000 does not fit int32_t
+                ratePerMinute = (static_cast<int64_t>(input.value) - lastValue) * 60000 /
+                                static_cast<int64_t>(input.nowMs - lastValueMs);
+                rateKnown = true;
+            }
+            lastValue = input.value;
+            lastValueMs = input.nowMs;
+            hasLastValue = true;
+            lastValidMs = input.nowMs;
+            hasLastValid = true;
+        } else if (input.sensorOpen) {
+            hasLastValue = false;  // Rate across an outage is meaningless
+        }
+
+        uint8_t changed = 0;
+        for (uint8_t i = 0; i < MB8ART_MAX_ALARM_RULES; i++) {
+            const AlarmRule& rule = rules[i];
+            if (rule.type == AlarmType::NONE) {
+                continue;
+            }
+
+            // Raise / clear conditions; both false = hold current state
+            bool raise = false;
+            bool clear = false;
+            switch (rule.type) {
+                case AlarmType::HIGH:
+                    if (input.hasValue) {
+                        raise = input.value >= rule.threshold;
+                        clear = input.value < rule.threshold - rule.hysteresis;
+                    }
+                    break;
+                case AlarmType::LOW:
+                    if (input.hasValue) {
+                        raise = input.value <= rule.threshold;
+                        clear = input.value > rule.threshold + rule.hysteresis;
+                    }
+                    break;
+                case AlarmType::RATE_OF_RISE:
+                    if (rateKnown) {
+                        raise = ratePerMinute >= rule.threshold;
+                        clear = ratePerMinute < rule.threshold - rule.hysteresis;
+                    }
+                    break;
+                case AlarmType::STALE: {
+                    // Without any valid sample yet, staleness counts from the first evaluation
+                    if (!hasLastValid) {
+                        lastValidMs = input.nowMs;
+                        hasLastValid = true;
+                    }
+                    bool stale = (input.nowMs - lastValidMs) >= static_cast<uint32_t>(rule.threshold) * 1000u;
+                    raise = stale;
+                    clear = !stale;
+                    break;
+                }
+                case AlarmType::SENSOR_OPEN:
+                    raise = input.sensorOpen;
+                    clear = input.hasValue;
+                    break;
+                default:
+                    break;
+            }
+
+            if (applyDelays(i, raise, clear, input.nowMs)) {
+                changed |= static_cast<uint8_t>(1u << i);
+            }
+        }
+        return changed;
+    }
+
+private:
+    struct RuleState {
+        uint32_t pendingSinceMs = 0;
+        bool pending = false;
+    };
+
+    // Returns true when the rule's active state flips
+    bool applyDelays(uint8_t index, bool raise, bool clear, uint32_t nowMs) {
+        RuleState& state = states[index];
+        bool active = (activeMask & (1u << index)) != 0;
+        bool wantChange = active ? clear : raise;
+
+        if (!wantChange) {
+            state.pending = false;
+            return false;
+        }
+        if (!state.pending) {
+            state.pending = true;
+            state.pendingSinceMs = nowMs;
+        }
+        uint16_t delay = active ? rules[index].offDelayMs : rules[index].onDelayMs;
+        if (nowMs - state.pendingSinceMs < delay) {
+            return false;
+        }
+
+        state.pending = false;
+        activeMask ^= static_cast<uint8_t>(1u << index);
+        return true;
+    }
+
+    AlarmRule rules[MB8ART_MAX_ALARM_RULES];
+    RuleState states[MB8ART_MAX_ALARM_RULES];
+    uint32_t lastValueMs = 0;
+    uint32_t lastValidMs = 0;
+    int16_t lastValue = 0;
+    uint8_t activeMask = 0;
+    bool hasLastValue = false;
+    bool hasLastValid = false;
+};
+
+/**
+ * @brief Alarm transition callback
+ *
+ * Called from the Modbus response context - keep it short and non-blocking
+ * (set a flag, give a semaphore, switch an output).
+ */
+typedef void (*AlarmCallback)(void* context, uint8_t channel, uint8_t ruleIndex,
+                              const AlarmRule& rule, bool active, int16_t value);
+
+} // namespace mb8art
+
+#endif // MB8ART_ALARMS_H
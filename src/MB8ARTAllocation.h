@@ -0,0 +1,46 @@
+#ifndef MB8ART_ALLOCATION_H
+#define MB8ART_ALLOCATION_H
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/semphr.h"
+
+/**
+ * @file MB8ARTAllocation.h
+ * @brief Static allocation mode for safety-rated builds
+ *
+ * With MB8ART_STATIC_ALLOCATION=1 every RTOS object the driver owns is
+ * created in storage inside the MB8ART instance (xEventGroupCreateStatic,
+ * xSemaphoreCreateMutexStatic) and MB8ARTSharedResources lives in static
+ * storage, so nothing is taken from the heap by this library after
+ * construction. Requires configSUPPORT_STATIC_ALLOCATION.
+ *
+ * Per-channel state, filters, statistics, alarms and hold snapshots are
+ * fixed-size members in both modes; history and rollups use caller-provided
+ * storage (StaticHistory / StaticRollup). getData()/getDataRaw() return
+ * std::vector by IDeviceInstance contract - use getSensorState(),
+ * getAllSensorReadings() or bindings on the polling path instead.
+ */
+
+#ifndef MB8ART_STATIC_ALLOCATION
+    #ifdef PROJECT_MB8ART_STATIC_ALLOCATION
+        #define MB8ART_STATIC_ALLOCATION PROJECT_MB8ART_STATIC_ALLOCATION
+    #else
+        #define MB8ART_STATIC_ALLOCATION 0
+    #endif
+#endif
+
+#if MB8ART_STATIC_ALLOCATION
+    #if !defined(configSUPPORT_STATIC_ALLOCATION) || (configSUPPORT_STATIC_ALLOCATION == 0)
+        #error "MB8ART_STATIC_ALLOCATION requires configSUPPORT_STATIC_ALLOCATION=1"
+    #endif
+
+    // storage: a StaticEventGroup_t / StaticSemaphore_t lvalue that outlives the handle
+    #define MB8ART_EVENT_GROUP_CREATE(storage) xEventGroupCreateStatic(&(storage))
+    #define MB8ART_MUTEX_CREATE(storage) xSemaphoreCreateMutexStatic(&(storage))
+#else
+    #define MB8ART_EVENT_GROUP_CREATE(storage) xEventGroupCreate()
+    #define MB8ART_MUTEX_CREATE(storage) xSemaphoreCreateMutex()
+#endif
+
+#endif // MB8ART_ALLOCATION_H
@@ -0,0 +1,364 @@
+#ifndef MB8ART_CHANNEL_MODES_H
+#define MB8ART_CHANNEL_MODES_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+/**
+ * @file MB8ARTChannelModes.h
+ * @brief Channel mode/subtype table, per-channel scales and fixed-point helpers
+ *
+ * Everything that depends on a channel's mode, subtype and the module's
+ * resolution register: names, the fixed-point divider and the accepted
+ * range. Free of FreeRTOS so the table can be checked in native tests.
+ *
+ * Values are scaled and formatted with the divider from channelScale() -
+ * never by testing the resolution mode directly, which only applies to RTD
+ * inputs.
+ */
+
+namespace mb8art {
+
+// Channel and sensor type enums
+enum class ChannelMode : uint16_t {
+    DEACTIVATED = 0x00,
+    THERMOCOUPLE = 0x01,
+    PT_INPUT = 0x02,
+    VOLTAGE = 0x03,
+    CURRENT = 0x04,
+};
+
+// Define sub-types for Thermocouple, PT, Voltage, and Current
+enum class ThermocoupleType : uint16_t {
+    TYPE_J = 0x00,
+    TYPE_K = 0x01,
+    TYPE_T = 0x02,
+    TYPE_E = 0x03,
+    TYPE_R = 0x04,
+    TYPE_S = 0x05,
+    TYPE_B = 0x06,
+    TYPE_N = 0x07
+};
+
+enum class PTType : uint16_t {
+    PT100 = 0x00,
+    PT1000 = 0x01,
+    CU50 = 0x02,
+    CU100 = 0x03
+};
+
+enum class VoltageRange : uint16_t {
+    MV_15 = 0x00,
+    MV_50 = 0x01,
+    MV_100 = 0x02,
+    V_1 = 0x03
+};
+
+enum class CurrentRange : uint16_t {
+    MA_20 = 0x00,
+    MA_4_TO_20 = 0x01
+};
+
+// =============================================================================
+// Analog input scaling (voltage/current channels)
+// =============================================================================
+// The module reports analog inputs on a ±30000-count full scale - the same
+// convention as the current ranges ("raw / 1500 = mA", 20mA = 30000 counts).
+static constexpr int32_t ANALOG_FULL_SCALE_COUNTS = 30000;
+
+/**
+ * @brief Fixed-point scaling for one voltage range (constexpr - lives in flash)
+ *
+ * Each range is converted to its own fixed-point unit so int16_t keeps the
+ * full module resolution. value / divider = millivolts.
+ */
+struct VoltageRangeScale {
+    int16_t fullScale;  // Full-scale value in fixed-point units
+    int16_t divider;    // Fixed-point units per mV
+};
+
+// Indexed by VoltageRange
+static constexpr VoltageRangeScale VOLTAGE_RANGE_SCALES[4] = {
+    {15000, 1000},  // ±15mV:  µV           (15000 = 15.000 mV)
+    {5000, 100},    // ±50mV:  0.01 mV      (5000 = 50.00 mV)
+    {10000, 100},   // ±100mV: 0.01 mV      (10000 = 100.00 mV)
+    {10000, 10}     // ±1V:    0.1 mV       (10000 = 1000.0 mV)
+};
+
+// Current channels: hundredths of mA (processCurrentData)
+static constexpr int16_t CURRENT_FULL_SCALE = 2000;  // 20.00 mA
+static constexpr int16_t CURRENT_DIVIDER = 100;
+
+// =============================================================================
+// Channel mode / subtype descriptors (constexpr - lives in flash)
+// =============================================================================
+// Single source for everything that depends on a channel's mode and subtype:
+// valid subtypes, names, fixed-point divider, accepted range and whether the
+// resolution register (76) applies. Indexed by ChannelMode and subtype, so
+// validation, naming and scaling are array lookups with no heap or lock.
+
+/**
+ * @brief Fixed-point unit and accepted native range of a channel
+ */
+struct ChannelScale {
+    int16_t divider;   // Fixed-point units per °C / mV / mA
+    int16_t validMin;  // Lowest plausible sample (native units)
+    int16_t validMax;  // Highest plausible sample (native units)
+};
+
+struct SubTypeDescriptor {
+    const char* name;
+    ChannelScale scale;  // For RTD inputs: the LOW_RES scale
+};
+
+struct ChannelModeDescriptor {
+    const char* name;
+    const SubTypeDescriptor* subTypes;
+    uint8_t subTypeCount;
+    bool followsResolution;           // Register 76 selects tenths / hundredths
+    const char* unknownSubTypeName;   // Returned for out-of-table subtypes
+};
+
+// Temperature scales: -200.0..850.0 °C in tenths, -200.00..200.00 °C in hundredths
+static constexpr ChannelScale LOW_RES_TEMPERATURE_SCALE = {10, -2000, 8500};
+static constexpr ChannelScale HIGH_RES_TEMPERATURE_SCALE = {100, -20000, 20000};
+
+static constexpr SubTypeDescriptor THERMOCOUPLE_SUBTYPES[] = {
+    {"TYPE_J", LOW_RES_TEMPERATURE_SCALE},
+    {"TYPE_K", LOW_RES_TEMPERATURE_SCALE},
+    {"TYPE_T", LOW_RES_TEMPERATURE_SCALE},
+    {"TYPE_E", LOW_RES_TEMPERATURE_SCALE},
+    {"TYPE_R", LOW_RES_TEMPERATURE_SCALE},
+    {"TYPE_S", LOW_RES_TEMPERATURE_SCALE},
+    {"TYPE_B", LOW_RES_TEMPERATURE_SCALE},
+    {"TYPE_N", LOW_RES_TEMPERATURE_SCALE}
+};
+
+static constexpr SubTypeDescriptor PT_SUBTYPES[] = {
+    {"PT100", LOW_RES_TEMPERATURE_SCALE},
+    {"PT1000", LOW_RES_TEMPERATURE_SCALE},
+    {"CU50", LOW_RES_TEMPERATURE_SCALE},
+    {"CU100", LOW_RES_TEMPERATURE_SCALE}
+};
+
+static constexpr SubTypeDescriptor VOLTAGE_SUBTYPES[] = {
+    {"±15mV", {VOLTAGE_RANGE_SCALES[0].divider, -VOLTAGE_RANGE_SCALES[0].fullScale, VOLTAGE_RANGE_SCALES[0].fullScale}},
+    {"±50mV", {VOLTAGE_RANGE_SCALES[1].divider, -VOLTAGE_RANGE_SCALES[1].fullScale, VOLTAGE_RANGE_SCALES[1].fullScale}},
+    {"±100mV", {VOLTAGE_RANGE_SCALES[2].divider, -VOLTAGE_RANGE_SCALES[2].fullScale, VOLTAGE_RANGE_SCALES[2].fullScale}},
+    {"±1V", {VOLTAGE_RANGE_SCALES[3].divider, -VOLTAGE_RANGE_SCALES[3].fullScale, VOLTAGE_RANGE_SCALES[3].fullScale}}
+};
+
+static constexpr SubTypeDescriptor CURRENT_SUBTYPES[] = {
+    {"±20mA", {CURRENT_DIVIDER, -CURRENT_FULL_SCALE, CURRENT_FULL_SCALE}},
+    {"4-20mA", {CURRENT_DIVIDER, -CURRENT_FULL_SCALE, CURRENT_FULL_SCALE}}
+};
+
+// Deactivated channels accept subtype 0 only and produce no samples
+static constexpr SubTypeDescriptor DEACTIVATED_SUBTYPES[] = {
+    {"N/A", LOW_RES_TEMPERATURE_SCALE}
+};
+
+// Indexed by ChannelMode
+static constexpr ChannelModeDescriptor CHANNEL_MODES[] = {
+    {"DEACTIVATED", DEACTIVATED_SUBTYPES, 1, false, "N/A"},
+    {"THERMOCOUPLE", THERMOCOUPLE_SUBTYPES, 8, false, "UNKNOWN_THERMOCOUPLE_TYPE"},
+    {"PT_INPUT", PT_SUBTYPES, 4, true, "UNKNOWN_PT_TYPE"},
+    {"VOLTAGE", VOLTAGE_SUBTYPES, 4, false, "UNKNOWN_VOLTAGE_RANGE"},
+    {"CURRENT", CURRENT_SUBTYPES, 2, false, "UNKNOWN_CURRENT_RANGE"}
+};
+
+static constexpr uint8_t CHANNEL_MODE_COUNT = sizeof(CHANNEL_MODES) / sizeof(CHANNEL_MODES[0]);
+
+static_assert(CHANNEL_MODE_COUNT == static_cast<uint8_t>(ChannelMode::CURRENT) + 1,
+              "CHANNEL_MODES must cover every ChannelMode");
+static_assert(sizeof(THERMOCOUPLE_SUBTYPES) / sizeof(THERMOCOUPLE_SUBTYPES[0]) ==
+              static_cast<uint8_t>(ThermocoupleType::TYPE_N) + 1, "THERMOCOUPLE_SUBTYPES out of sync");
+static_assert(sizeof(PT_SUBTYPES) / sizeof(PT_SUBTYPES[0]) ==
+              static_cast<uint8_t>(PTType::CU100) + 1, "PT_SUBTYPES out of sync");
+static_assert(sizeof(VOLTAGE_SUBTYPES) / sizeof(VOLTAGE_SUBTYPES[0]) ==
+              static_cast<uint8_t>(VoltageRange::V_1) + 1, "VOLTAGE_SUBTYPES out of sync");
+static_assert(sizeof(CURRENT_SUBTYPES) / sizeof(CURRENT_SUBTYPES[0]) ==
+              static_cast<uint8_t>(CurrentRange::MA_4_TO_20) + 1, "CURRENT_SUBTYPES out of sync");
+
+/**
+ * @return Descriptor for a raw mode value, nullptr if unknown
+ */
+inline const ChannelModeDescriptor* findChannelMode(uint16_t mode) {
+    return (mode < CHANNEL_MODE_COUNT) ? &CHANNEL_MODES[mode] : nullptr;
+}
+
+/**
+ * @return Descriptor for a raw mode/subtype pair, nullptr if the pair is invalid
+ */
+inline const SubTypeDescriptor* findSubType(uint16_t mode, uint16_t subType) {
+    const ChannelModeDescriptor* descriptor = findChannelMode(mode);
+    return (descriptor != nullptr && subType < descriptor->subTypeCount)
+           ? &descriptor->subTypes[subType] : nullptr;
+}
+
+inline const char* subTypeToString(uint16_t mode, uint16_t subType) {
+    const ChannelModeDescriptor* descriptor = findChannelMode(mode);
+    if (descriptor == nullptr) {
+        return "N/A";
+    }
+    return (subType < descriptor->subTypeCount) ? descriptor->subTypes[subType].name
+                                                : descriptor->unknownSubTypeName;
+}
+
+/**
+ * @brief Linear engineering-unit mapping (y = m·x + b) for analog channels
+ *
+ * Applied at ingest to the channel's fixed-point value, so consumers read
+ * e.g. bar or kg directly instead of re-scaling millivolts in every task.
+ * The gain is stored as Q16.16 - no floating point in the decode path.
+ *
+ * @code
+ * // 0..100 mV strain gauge -> 0..250.0 kg (tenths)
+ * mb8art->setEngineeringScale(3, mb8art::LinearScale::fromFloat(2.5f, 0.0f, 10));
+ * @endcode
+ */
+struct LinearScale {
+    int32_t gainQ16;  // m × divider × 65536 (output counts per mV or mA)
+    int32_t offset;   // b × divider (output counts)
+    int16_t divider;  // Output counts per engineering unit (0 = mapping disabled)
+
+    /**
+     * @brief Build a mapping from physical gain/offset
+     * @param gain Engineering units per mV (voltage) or per mA (current)
+     * @param offset Engineering value at 0 mV / 0 mA
+     * @param outputDivider Output counts per engineering unit (e.g. 10 = tenths)
+     */
+    static constexpr LinearScale fromFloat(float gain, float offset, int16_t outputDivider) {
+        return LinearScale{
+            static_cast<int32_t>(static_cast<double>(gain) * outputDivider * 65536.0 + (gain >= 0 ? 0.5 : -0.5)),
+            static_cast<int32_t>(static_cast<double>(offset) * outputDivider + (offset >= 0 ? 0.5 : -0.5)),
+            outputDivider
+        };
+    }
+
+    bool isEnabled() const { return divider != 0; }
+
+    /**
+     * @brief Apply the mapping to a channel value
+     * @param value Channel fixed-point value
+     * @param inputDivider Fixed-point units per mV/mA of the channel
+     */
+    int32_t apply(int32_t value, int16_t inputDivider) const {
+        int64_t scaled = static_cast<int64_t>(value) * gainQ16 / inputDivider;
+        // Half away from zero, like rescaleFixedPoint: -1.5 -> -2, 1.5 -> 2
+        int64_t half = static_cast<int64_t>(1) << 15;
+        int64_t rounded = (scaled >= 0) ? (scaled + half) >> 16 : -((half - scaled) >> 16);
+        return static_cast<int32_t>(rounded) + offset;
+    }
+};
+
+// Unit of a bound analog reading (AnalogValue)
+enum class AnalogUnit : uint8_t {
+    MILLIVOLT = 0,  // VOLTAGE channel, native fixed-point
+    MILLIAMP,       // CURRENT channel, native fixed-point
+    ENGINEERING     // Mapped by setEngineeringScale()
+};
+
+/**
+ * @brief Bound reading of a voltage/current channel
+ *
+ * value / divider = reading in unit. The divider depends on the range (see
+ * VOLTAGE_RANGE_SCALES) or on the engineering scale, so it is written along
+ * with every value.
+ */
+struct AnalogValue {
+    int32_t value;
+    int16_t divider;
+    AnalogUnit unit;
+};
+
+// enum for measurement range configuration
+enum class MeasurementRange {
+    LOW_RES = 0,  // -200 to 850°C, 0.1° resolution
+    HIGH_RES = 1  // -200 to 200°C, 0.01° resolution
+};
+
+/**
+ * @brief Scale of a channel for the given resolution mode
+ *
+ * Unknown mode/subtype pairs fall back to the LOW_RES temperature scale.
+ */
+inline ChannelScale channelScale(uint16_t mode, uint16_t subType, MeasurementRange range) {
+    const ChannelModeDescriptor* descriptor = findChannelMode(mode);
+    if (descriptor == nullptr || subType >= descriptor->subTypeCount) {
+        return LOW_RES_TEMPERATURE_SCALE;
+    }
+    if (descriptor->followsResolution && range == MeasurementRange::HIGH_RES) {
+        return HIGH_RES_TEMPERATURE_SCALE;
+    }
+    return descriptor->subTypes[subType].scale;
+}
+
+// String conversion functions (names live in CHANNEL_MODES)
+inline const char* channelModeToString(ChannelMode mode) {
+    const ChannelModeDescriptor* descriptor = findChannelMode(static_cast<uint16_t>(mode));
+    return (descriptor != nullptr) ? descriptor->name : "UNKNOWN";
+}
+
+inline const char* thermocoupleTypeToString(ThermocoupleType type) {
+    return subTypeToString(static_cast<uint16_t>(ChannelMode::THERMOCOUPLE), static_cast<uint16_t>(type));
+}
+
+inline const char* ptTypeToString(PTType type) {
+    return subTypeToString(static_cast<uint16_t>(ChannelMode::PT_INPUT), static_cast<uint16_t>(type));
+}
+
+inline const char* voltageRangeToString(VoltageRange range) {
+    return subTypeToString(static_cast<uint16_t>(ChannelMode::VOLTAGE), static_cast<uint16_t>(range));
+}
+
+inline const char* currentRangeToString(CurrentRange range) {
+    return subTypeToString(static_cast<uint16_t>(ChannelMode::CURRENT), static_cast<uint16_t>(range));
+}
+
+// Temperature bindings (SensorBinding::temperaturePtr, SensorReading) are tenths of °C
+static constexpr int16_t BINDING_TEMPERATURE_DIVIDER = 10;
+
+/**
+ * @brief Convert a fixed-point value between two dividers
+ *
+ * Rounds half away from zero when the target is coarser.
+ */
+inline int32_t rescaleFixedPoint(int32_t value, int16_t fromDivider, int16_t toDivider) {
+    if (fromDivider == toDivider || fromDivider <= 0 || toDivider <= 0) {
+        return value;
+    }
+    int64_t scaled = static_cast<int64_t>(value) * toDivider;
+    int64_t half = fromDivider / 2;
+    scaled = (scaled >= 0) ? (scaled + half) / fromDivider : (scaled - half) / fromDivider;
+    return static_cast<int32_t>(scaled);
+}
+
+/**
+ * @brief Format value / divider with as many decimals as the divider has
+ *
+ * Power-of-ten dividers print as a decimal ("-0.38", "1000.0"); anything else
+ * prints as "value/divider".
+ * @return snprintf's result
+ */
+inline int formatFixedPoint(char* out, size_t size, int32_t value, int16_t divider) {
+    int decimals = 0;
+    int32_t power = 1;
+    while (power < divider && decimals < 4) {
+        power *= 10;
+        decimals++;
+    }
+    if (divider <= 1 || power != divider) {
+        return (divider <= 1) ? snprintf(out, size, "%ld", static_cast<long>(value))
+                              : snprintf(out, size, "%ld/%d", static_cast<long>(value), divider);
+    }
+    int64_t magnitude = (value < 0) ? -static_cast<int64_t>(value) : value;
+    return snprintf(out, size, "%s%ld.%0*ld", (value < 0) ? "-" : "",
+                    static_cast<long>(magnitude / divider), decimals,
+                    static_cast<long>(magnitude % divider));
+}
+
+} // namespace mb8art
+
+#endif // MB8ART_CHANNEL_MODES_H
@@ -0,0 +1,242 @@
+#ifndef MB8ART_COMMANDS_H
+#define MB8ART_COMMANDS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @file MB8ARTCommands.h
+ * @brief Command table, text parser and binary framing for remote control
+ *
+ * Commands are looked up in a constexpr table sorted by name (binary search,
+ * checked at compile time) over non-owning StringRefs, so parsing a payload
+ * allocates nothing. Parameters are parsed into typed values before the
+ * command runs.
+ *
+ * Text form:   "name", "name:param" or "name param"
+ *              e.g. "read_temperature", "configure_range:high"
+ *
+ * Binary form (5 bytes per command, frames may be concatenated):
+ *   [0xA5] [CommandId] [arg lo] [arg hi] [CRC-8 over the first 4 bytes]
+ *   CRC-8 polynomial 0x07, init 0x00 (CRC-8/SMBUS)
+ */
+
+namespace mb8art {
+
+/**
+ * @brief Non-owning string slice (std::string_view is C++17)
+ */
+struct StringRef {
+    const char* data;
+    size_t size;
+
+    constexpr StringRef() : data(""), size(0) {}
+    constexpr StringRef(const char* text, size_t length) : data(text), size(length) {}
+    template <size_t N>
+    constexpr StringRef(const char (&literal)[N]) : data(literal), size(N - 1) {}
+
+    // <0, 0, >0 like strcmp
+    constexpr int compare(const StringRef& other) const {
+        return compareFrom(other, 0);
+    }
+    bool operator==(const StringRef& other) const {
+        return size == other.size && memcmp(data, other.data, size) == 0;
+    }
+
+private:
+    constexpr int compareFrom(const StringRef& other, size_t i) const {
+        return (i == size || i == other.size)
+                   ? (size == other.size ? 0 : (size < other.size ? -1 : 1))
+               : (data[i] != other.data[i])
+                   ? (static_cast<uint8_t>(data[i]) < static_cast<uint8_t>(other.data[i]) ? -1 : 1)
+                   : compareFrom(other, i + 1);
+    }
+};
+
+enum class CommandId : uint8_t {
+    NONE = 0,
+    READ_TEMPERATURE = 1,
+    CONFIGURE_RANGE = 2,    // arg: MeasurementRange (0 = low, 1 = high)
+    PRINT_SETTINGS = 3,
+    PRINT_READINGS = 4,
+    RESET_METRICS = 5,
+    COUNT
+};
+
+enum class CommandParam : uint8_t {
+    NONE,                   // Parameter ignored
+    RANGE                   // "low" / "high"
+};
+
+struct CommandSpec {
+    StringRef name;
+    CommandId id;
+    CommandParam param;
+};
+
+// Sorted by name - enforced below
+static constexpr CommandSpec COMMAND_TABLE[] = {
+    {"configure_range", CommandId::CONFIGURE_RANGE, CommandParam::RANGE},
+    {"print_readings", CommandId::PRINT_READINGS, CommandParam::NONE},
+    {"print_settings", CommandId::PRINT_SETTINGS, CommandParam::NONE},
+    {"read_temperature", CommandId::READ_TEMPERATURE, CommandParam::NONE},
+    {"reset_metrics", CommandId::RESET_METRICS, CommandParam::NONE},
+};
+static constexpr size_t COMMAND_COUNT = sizeof(COMMAND_TABLE) / sizeof(COMMAND_TABLE[0]);
+
+namespace detail {
+constexpr bool commandTableSorted(size_t i) {
+    return i + 1 >= COMMAND_COUNT ||
+           (COMMAND_TABLE[i].name.compare(COMMAND_TABLE[i + 1].name) < 0 && commandTableSorted(i + 1));
+}
+constexpr bool commandTableComplete(size_t i, uint32_t seen) {
+    return i == COMMAND_COUNT
+               ? seen == (1u << static_cast<uint8_t>(CommandId::COUNT)) - 2
+               : commandTableComplete(i + 1, seen | (1u << static_cast<uint8_t>(COMMAND_TABLE[i].id)));
+}
+} // namespace detail
+
+static_assert(detail::commandTableSorted(0), "COMMAND_TABLE must be sorted by name");
+static_assert(detail::commandTableComplete(0, 0), "COMMAND_TABLE must list every CommandId once");
+
+inline const CommandSpec* findCommand(StringRef name) {
+    size_t low = 0;
+    size_t high = COMMAND_COUNT;
+    while (low < high) {
+        size_t mid = (low + high) / 2;
+        int order = COMMAND_TABLE[mid].name.compare(name);
+        if (order == 0) {
+            return &COMMAND_TABLE[mid];
+        }
+        if (order < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return nullptr;
+}
+
+inline const CommandSpec* findCommand(CommandId id) {
+    for (const CommandSpec& spec : COMMAND_TABLE) {
+        if (spec.id == id) {
+            return &spec;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief A command ready to execute
+ */
+struct ParsedCommand {
+    CommandId id = CommandId::NONE;
+    uint16_t arg = 0;
+};
+
+enum class CommandStatus : uint8_t {
+    OK,
+    UNKNOWN_COMMAND,
+    INVALID_PARAMETER,
+    BAD_FRAME,              // Binary: wrong magic, checksum or length
+    DEVICE_UNAVAILABLE      // Parsed, but no initialized MB8ART to run it on
+};
+
+inline bool parseCommandParam(CommandParam type, StringRef text, uint16_t& out) {
+    switch (type) {
+        case CommandParam::NONE:
+            out = 0;
+            return true;
+        case CommandParam::RANGE:
+            if (text == StringRef("low")) {
+                out = 0;
+                return true;
+            }
+            if (text == StringRef("high")) {
+                out = 1;
+                return true;
+            }
+            return false;
+    }
+    return false;
+}
+
+// Checks a binary argument against the parameter type
+inline bool validateCommandArg(CommandParam type, uint16_t arg) {
+    return type == CommandParam::NONE || (type == CommandParam::RANGE && arg <= 1);
+}
+
+/**
+ * @brief Parse "name", "name:param" or "name param"
+ *
+ * A parameter given separately (the legacy handleControlCommand(command,
+ * parameter) form) is used when the text has none.
+ */
+inline CommandStatus parseCommand(StringRef text, ParsedCommand& out, StringRef separateParam = StringRef()) {
+    size_t split = 0;
+    while (split < text.size && text.data[split] != ':' && text.data[split] != ' ') {
+        split++;
+    }
+    const CommandSpec* spec = findCommand(StringRef(text.data, split));
+    if (spec == nullptr) {
+        return CommandStatus::UNKNOWN_COMMAND;
+    }
+    StringRef param = split < text.size ? StringRef(text.data + split + 1, text.size - split - 1)
+                                        : separateParam;
+    if (!parseCommandParam(spec->param, param, out.arg)) {
+        return CommandStatus::INVALID_PARAMETER;
+    }
+    out.id = spec->id;
+    return CommandStatus::OK;
+}
+
+// ============================================================================
+// Binary framing
+// ============================================================================
+
+static constexpr uint8_t COMMAND_FRAME_MAGIC = 0xA5;
+static constexpr size_t COMMAND_FRAME_SIZE = 5;
+
+inline uint8_t commandFrameCrc(const uint8_t* data, size_t length) {
+    uint8_t crc = 0;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x80) ? static_cast<uint8_t>((crc << 1) ^ 0x07) : static_cast<uint8_t>(crc << 1);
+        }
+    }
+    return crc;
+}
+
+inline void encodeCommandFrame(const ParsedCommand& command, uint8_t* out) {
+    out[0] = COMMAND_FRAME_MAGIC;
+    out[1] = static_cast<uint8_t>(command.id);
+    out[2] = static_cast<uint8_t>(command.arg);
+    out[3] = static_cast<uint8_t>(command.arg >> 8);
+    out[4] = commandFrameCrc(out, 4);
+}
+
+/**
+ * @brief Decode one frame (at least COMMAND_FRAME_SIZE bytes)
+ */
+inline CommandStatus decodeCommandFrame(const uint8_t* frame, ParsedCommand& out) {
+    if (frame[0] != COMMAND_FRAME_MAGIC || commandFrameCrc(frame, 4) != frame[4]) {
+        return CommandStatus::BAD_FRAME;
+    }
+    const CommandSpec* spec = findCommand(static_cast<CommandId>(frame[1]));
+    if (spec == nullptr) {
+        return CommandStatus::UNKNOWN_COMMAND;
+    }
+    uint16_t arg = static_cast<uint16_t>(frame[2] | (frame[3] << 8));
+    if (!validateCommandArg(spec->param, arg)) {
+        return CommandStatus::INVALID_PARAMETER;
+    }
+    out.id = spec->id;
+    out.arg = arg;
+    return CommandStatus::OK;
+}
+
+} // namespace mb8art
+
+#endif // MB8ART_COMMANDS_H
@@ -16,20 +16,10 @@ bool MB8ART::batchReadAllConfig() {
     
     // First batch: Read all channel configurations (128-135 = 8 registers) - CRITICAL
     LOG_MB8ART_DEBUG_NL("Reading channel configurations first (critical data)");
-    auto channelResult = readHoldingRegisters(CHANNEL_CONFIG_REGISTER_START, DEFAULT_NUMBER_OF_SENSORS);
-    if (!channelResult.isOk() || channelResult.value().size() < DEFAULT_NUMBER_OF_SENSORS) {
-        auto category = modbus::ModbusErrorTracker::categorizeError(channelResult.error());
-        modbus::ModbusErrorTracker::recordError(getServerAddress(), category);
-        LOG_MB8ART_ERROR_NL("Failed to read channel configs batch (error: %d)",
-                           static_cast<int>(channelResult.error()));
+    if (!readRegisterBlock(mb8art::registerDescriptor(RegisterId::CHANNEL_CONFIG))) {
+        LOG_MB8ART_ERROR_NL("Failed to read channel configs batch");
         return false;
     }
-    modbus::ModbusErrorTracker::recordSuccess(getServerAddress());
-    
-    // Process each channel configuration
-    for (int i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
-        processChannelConfig(i, channelResult.value()[i]);
-    }
     
     // Update the pre-computed active channel mask
     updateActiveChannelMask();
@@ -37,125 +27,42 @@ bool MB8ART::batchReadAllConfig() {
     setInitializationBit(InitBits::CHANNEL_CONFIG);
     LOG_MB8ART_DEBUG_NL("Channel configs batch read successful");
 
-    // Second batch: Read module settings and measurement range (70-76 = 7 registers) - CRITICAL
-    constexpr uint16_t MODULE_BATCH_START = RS485_ADDRESS_REGISTER;  // Start at register 70
-    constexpr uint16_t MODULE_BATCH_COUNT = 7;  // From RS485_ADDRESS_REGISTER through MEASUREMENT_RANGE_REGISTER
-    
+    // Second batch: Read module settings and measurement range (70-76 = 7 registers) - CRITICAL.
+    // Decoded by decodeModuleBatch(), which also sets the MEASUREMENT_RANGE init bit
     LOG_MB8ART_DEBUG_NL("Reading module settings and measurement range");
-    auto moduleResult = readHoldingRegisters(MODULE_BATCH_START, MODULE_BATCH_COUNT);
-    if (!moduleResult.isOk()) {
-        auto category = modbus::ModbusErrorTracker::categorizeError(moduleResult.error());
-        modbus::ModbusErrorTracker::recordError(getServerAddress(), category);
-        LOG_MB8ART_ERROR_NL("Module batch read failed with error: %d - cannot determine measurement range!",
-                          static_cast<int>(moduleResult.error()));
+    if (!readRegisterBlock(mb8art::registerDescriptor(RegisterId::MODULE_BATCH))) {
+        LOG_MB8ART_ERROR_NL("Module batch read failed - cannot determine measurement range!");
         return false;  // Critical failure - we need measurement range
-    } else if (moduleResult.value().size() < MODULE_BATCH_COUNT) {
-        modbus::ModbusErrorTracker::recordError(getServerAddress(), modbus::ModbusErrorTracker::ErrorCategory::INVALID_DATA);
-        LOG_MB8ART_ERROR_NL("Module batch read returned %d registers, expected %d",
-                          moduleResult.value().size(), MODULE_BATCH_COUNT);
-        return false;  // Critical failure
-    } else {
-        modbus::ModbusErrorTracker::recordSuccess(getServerAddress());
-        // Process module settings from batch (starting at register 70)
-        // Register 70: RS485 address (offset 0)
-        moduleSettings.rs485Address = moduleResult.value()[0] & 0xFF;
-        
-        // Register 71: Baud rate (offset 1)
-        moduleSettings.baudRate = moduleResult.value()[1] & 0xFF;
-        
-        // Register 72: Parity (offset 2)
-        moduleSettings.parity = moduleResult.value()[2] & 0xFF;
-        
-        // Register 76: Measurement range - MB8ART device quirk:
-        // In batch reads, the measurement range value appears at register 75 (index 5)
-        // even though single register reads show it correctly at register 76
-        uint16_t rawRange = moduleResult.value()[5];  // Read from index 5 for batch reads
-        LOG_MB8ART_DEBUG_NL("Measurement range at index 5 (reg 75): 0x%04X", rawRange);
-        LOG_MB8ART_DEBUG_NL("Value at index 6 (reg 76): 0x%04X", moduleResult.value()[6]);
-        
-        currentRange = static_cast<mb8art::MeasurementRange>(rawRange & 0x01);
-        
-        setInitializationBit(InitBits::MEASUREMENT_RANGE);
-        
-        LOG_MB8ART_DEBUG_NL("Module settings batch read successful");
-        LOG_MB8ART_DEBUG_NL("Settings - Addr: 0x%02X, Baud: %s, Range: %s",
-                           moduleSettings.rs485Address,
-                           baudRateToString(getBaudRateEnum(moduleSettings.baudRate)).c_str(),
-                           (currentRange == mb8art::MeasurementRange::HIGH_RES) ? "HIGH_RES" : "LOW_RES");
     }
     
+    LOG_MB8ART_DEBUG_NL("Module settings batch read successful");
+    LOG_MB8ART_DEBUG_NL("Settings - Addr: 0x%02X, Baud: %s, Range: %s",
+                       moduleSettings.rs485Address,
+                       baudRateToString(getBaudRateEnum(moduleSettings.baudRate)).c_str(),
+                       (currentRange == mb8art::MeasurementRange::HIGH_RES) ? "HIGH_RES" : "LOW_RES");
+    
     setInitializationBit(InitBits::DEVICE_RESPONSIVE);
     
     return true;  // Channel configs successful (module settings are optional)
 }
 
-bool MB8ART::batchReadInitialConfig() {
-    MB8ART_LOG_INIT_STEP("Batch reading device configuration...");
-    
-    // Read 10 registers starting from module temp (67) through measurement range (76)
-    auto result = readHoldingRegisters(MODULE_TEMPERATURE_REGISTER, 10);
-    
-    if (result.isOk()) {
-        LOG_MB8ART_DEBUG_NL("Batch config request sent successfully");
-        // The response will be handled in handleModbusResponse
-        return true;
-    } else {
-        LOG_MB8ART_ERROR_NL("Failed to send batch config request");
-        return false;
-    }
-}
-
-
-
 void MB8ART::readOptionalSettings() {
-    // Read RS485 address
+    // Synchronous reads - decoded before they return
     if (reqAddress()) {
-        EventBits_t bits = MB8ART_SRP_EVENT_GROUP_WAIT_BITS(
-            xTaskEventGroup,
-            DATA_READY_BIT | DATA_ERROR_BIT,
-            pdTRUE,
-            pdFALSE,
-            pdMS_TO_TICKS(500)
-        );
-        
-        if (bits & DATA_READY_BIT) {
-            LOG_MB8ART_DEBUG_NL("RS485 address: 0x%02X", moduleSettings.rs485Address);
-        }
+        LOG_MB8ART_DEBUG_NL("RS485 address: 0x%02X", moduleSettings.rs485Address);
     }
     
     vTaskDelay(pdMS_TO_TICKS(20));
     
-    // Read baud rate
     if (reqBaudRate()) {
-        EventBits_t bits = MB8ART_SRP_EVENT_GROUP_WAIT_BITS(
-            xTaskEventGroup,
-            DATA_READY_BIT | DATA_ERROR_BIT,
-            pdTRUE,
-            pdFALSE,
-            pdMS_TO_TICKS(500)
-        );
-        
-        if (bits & DATA_READY_BIT) {
-            LOG_MB8ART_DEBUG_NL("Baud rate: %s", 
-                              baudRateToString(getBaudRateEnum(moduleSettings.baudRate)).c_str());
-        }
+        LOG_MB8ART_DEBUG_NL("Baud rate: %s", 
+                          baudRateToString(getBaudRateEnum(moduleSettings.baudRate)).c_str());
     }
     
     vTaskDelay(pdMS_TO_TICKS(20));
     
-    // Read module temperature
     if (reqModuleTemperature()) {
-        EventBits_t bits = MB8ART_SRP_EVENT_GROUP_WAIT_BITS(
-            xTaskEventGroup,
-            DATA_READY_BIT | DATA_ERROR_BIT,
-            pdTRUE,
-            pdFALSE,
-            pdMS_TO_TICKS(500)
-        );
-        
-        if (bits & DATA_READY_BIT && moduleSettings.isTemperatureValid) {
-            LOG_MB8ART_DEBUG_NL("Module temperature: %.1f°C", moduleSettings.moduleTemperature);
-        }
+        LOG_MB8ART_DEBUG_NL("Module temperature: %.1f°C", moduleSettings.moduleTemperature);
     }
 }
 
@@ -170,136 +77,86 @@ void MB8ART::setDataReceiverTask(TaskHandle_t taskHandle) {
 
 
 
-bool MB8ART::reqAddress() {
-    // Prevent polling if device is offline
-    if (statusFlags.moduleOffline) {
-        LOG_MB8ART_DEBUG_NL("reqAddress blocked - device offline");
+bool MB8ART::readRegisterBlock(const mb8art::RegisterDescriptor& reg) {
+    if (reg.functionCode != mb8art::REGISTER_FC_HOLDING) {
+        LOG_MB8ART_ERROR_NL("%s is not a holding register block", reg.name);
         return false;
     }
-    
-    // Read the Modbus register at address 0x0046 (70) to get the RS485 address from the holding registers.
-    auto result = readHoldingRegisters(RS485_ADDRESS_REGISTER, 1);
-
-    if (result.isOk() && !result.value().empty()) {
-        modbus::ModbusErrorTracker::recordSuccess(getServerAddress());
-        LOG_MB8ART_DEBUG_NL("RS485 address request successful, value: 0x%02X", result.value()[0]);
-        moduleSettings.rs485Address = result.value()[0] & 0xFF;
-        return true;
-    } else {
+
+    mb8art::UntrackedTransaction untracked(busMetrics);
+    auto result = readHoldingRegisters(reg.address, reg.count);
+    if (!result.isOk()) {
         auto category = modbus::ModbusErrorTracker::categorizeError(result.error());
         modbus::ModbusErrorTracker::recordError(getServerAddress(), category);
-        LOG_MB8ART_ERROR_NL("Failed to read RS485 address, error: %d", static_cast<int>(result.error()));
+        LOG_MB8ART_ERROR_NL("Failed to read %s, error: %d", reg.name, static_cast<int>(result.error()));
         return false;
     }
+    if (result.value().size() < reg.count) {
+        modbus::ModbusErrorTracker::recordError(getServerAddress(), modbus::ModbusErrorTracker::ErrorCategory::INVALID_DATA);
+        LOG_MB8ART_ERROR_NL("%s read returned %u registers, expected %u", reg.name,
+                           static_cast<unsigned>(result.value().size()), static_cast<unsigned>(reg.count));
+        return false;
+    }
+    modbus::ModbusErrorTracker::recordSuccess(getServerAddress());
+
+    // Same decoder as the async path, fed the registers as wire bytes
+    uint8_t payload[mb8art::MAX_REGISTER_BLOCK * 2];
+    for (uint8_t i = 0; i < reg.count; i++) {
+        payload[i * 2] = static_cast<uint8_t>(result.value()[i] >> 8);
+        payload[i * 2 + 1] = static_cast<uint8_t>(result.value()[i]);
+    }
+    return dispatchRegisterResponse(reg, payload, reg.count * 2u, reg.address, false);
 }
 
 
 
 
-bool MB8ART::reqBaudRate() {
+bool MB8ART::readRegister(mb8art::RegisterId id) {
+    const mb8art::RegisterDescriptor& reg = mb8art::registerDescriptor(id);
+
     // Prevent polling if device is offline
     if (statusFlags.moduleOffline) {
-        LOG_MB8ART_DEBUG_NL("reqBaudRate blocked - device offline");
-        return false;
-    }
-    
-    LOG_MB8ART_DEBUG_NL("Requesting baud rate from register 0x%02X", BAUD_RATE_REGISTER);
-    // Read the Modbus register at address 0x0047 (71) to get the RS485 baud rate configuration from the holding registers.
-    auto result = readHoldingRegisters(BAUD_RATE_REGISTER, 1);
-
-    if (result.isOk() && !result.value().empty()) {
-        modbus::ModbusErrorTracker::recordSuccess(getServerAddress());
-        LOG_MB8ART_DEBUG_NL("Baud rate request successful, value: %d", result.value()[0]);
-        moduleSettings.baudRate = result.value()[0] & 0xFF;
-        return true;
-    } else {
-        auto category = modbus::ModbusErrorTracker::categorizeError(result.error());
-        modbus::ModbusErrorTracker::recordError(getServerAddress(), category);
-        LOG_MB8ART_ERROR_NL("Failed to read baud rate, error: %d", static_cast<int>(result.error()));
+        LOG_MB8ART_DEBUG_NL("%s read blocked - device offline", reg.name);
         return false;
     }
+
+    return readRegisterBlock(reg);
 }
 
 
 
 
-bool MB8ART::reqParity() {
-    // Prevent polling if device is offline
-    if (statusFlags.moduleOffline) {
-        LOG_MB8ART_DEBUG_NL("reqParity blocked - device offline");
-        return false;
-    }
-    
-    LOG_MB8ART_DEBUG_NL("Requesting parity from register 0x%02X", PARITY_REGISTER);
-    // Read the Modbus register at address 0x0048 (72) to get the RS485 parity configuration from the holding registers.
-    auto result = readHoldingRegisters(PARITY_REGISTER, 1);
-
-    if (result.isOk() && !result.value().empty()) {
-        modbus::ModbusErrorTracker::recordSuccess(getServerAddress());
-        LOG_MB8ART_DEBUG_NL("Parity request successful, value: %d", result.value()[0]);
-        moduleSettings.parity = result.value()[0] & 0xFF;
-        return true;
-    } else {
-        auto category = modbus::ModbusErrorTracker::categorizeError(result.error());
-        modbus::ModbusErrorTracker::recordError(getServerAddress(), category);
-        LOG_MB8ART_ERROR_NL("Failed to read parity, error: %d", static_cast<int>(result.error()));
-        return false;
-    }
+bool MB8ART::reqAddress() {
+    return readRegister(RegisterId::RS485_ADDRESS);
 }
 
+bool MB8ART::reqBaudRate() {
+    return readRegister(RegisterId::BAUD_RATE);
+}
 
-
+bool MB8ART::reqParity() {
+    return readRegister(RegisterId::PARITY);
+}
 
 bool MB8ART::reqModuleTemperature() {
-    // Prevent polling if device is offline
-    if (statusFlags.moduleOffline) {
-        LOG_MB8ART_DEBUG_NL("reqModuleTemperature blocked - device offline");
-        return false;
-    }
-    
-    // Read the Modbus register at address 0x0044 (68) for the module temperature
-    auto result = readHoldingRegisters(MODULE_TEMPERATURE_REGISTER, 1);
-
-    if (result.isOk() && !result.value().empty()) {
-        modbus::ModbusErrorTracker::recordSuccess(getServerAddress());
-        LOG_MB8ART_DEBUG_NL("Module temperature request successful, raw value: %d", result.value()[0]);
-        moduleSettings.moduleTemperature = result.value()[0] * 0.1f;  // Convert to degrees
-        moduleSettings.isTemperatureValid = true;
-        return true;
-    } else {
-        auto category = modbus::ModbusErrorTracker::categorizeError(result.error());
-        modbus::ModbusErrorTracker::recordError(getServerAddress(), category);
-        LOG_MB8ART_ERROR_NL("Failed to read module temperature, error: %d", static_cast<int>(result.error()));
+    // Register 67 (0x0043); a failed read invalidates the previous value
+    bool ok = readRegister(RegisterId::MODULE_TEMPERATURE);
+    if (!ok && !statusFlags.moduleOffline) {
         moduleSettings.isTemperatureValid = false;
-        return false;
     }
+    return ok;
 }
 
+bool MB8ART::reqMeasurementRange() {
+    return readRegister(RegisterId::MEASUREMENT_RANGE);
+}
 
+bool MB8ART::reqEquipmentStatus() {
+    return readRegister(RegisterId::EQUIPMENT_STATUS);
+}
 
-
-bool MB8ART::reqMeasurementRange() {
-    // Prevent polling if device is offline
-    if (statusFlags.moduleOffline) {
-        LOG_MB8ART_DEBUG_NL("reqMeasurementRange blocked - device offline");
-        return false;
-    }
-    
-    // Read the Modbus register for measurement range (address 0x004C)
-    auto result = readHoldingRegisters(MEASUREMENT_RANGE_REGISTER, 1);
-
-    if (result.isOk() && !result.value().empty()) {
-        modbus::ModbusErrorTracker::recordSuccess(getServerAddress());
-        uint16_t value = result.value()[0];
-        LOG_MB8ART_DEBUG_NL("Measurement range request successful, value: %d", value);
-        currentRange = static_cast<mb8art::MeasurementRange>(value & 0x01);
-        return true;
-    } else {
-        auto category = modbus::ModbusErrorTracker::categorizeError(result.error());
-        modbus::ModbusErrorTracker::recordError(getServerAddress(), category);
-        LOG_MB8ART_ERROR_NL("Failed to read measurement range");
-        return false;
-    }
+bool MB8ART::reqProductVersion() {
+    return readRegister(RegisterId::PRODUCT_VERSION);
 }
 
 
@@ -307,24 +164,7 @@ bool MB8ART::reqMeasurementRange() {
 
 // Request methods
 bool MB8ART::reqAllChannelModes() {
-    // Prevent polling if device is offline
-    if (statusFlags.moduleOffline) {
-        LOG_MB8ART_DEBUG_NL("reqAllChannelModes blocked - device offline");
-        return false;
-    }
-    
-    // Read all channel configurations
-    auto result = readHoldingRegisters(CHANNEL_CONFIG_REGISTER_START, DEFAULT_NUMBER_OF_SENSORS);
-
-    if (!result.isOk()) {
-        auto category = modbus::ModbusErrorTracker::categorizeError(result.error());
-        modbus::ModbusErrorTracker::recordError(getServerAddress(), category);
-        LOG_MB8ART_ERROR_NL("Failed to request all channel configurations");
-        return false;
-    }
-
-    modbus::ModbusErrorTracker::recordSuccess(getServerAddress());
-    return true;
+    return readRegister(RegisterId::CHANNEL_CONFIG);
 }
 
 
@@ -339,10 +179,10 @@ bool MB8ART::reqChannelMode(uint8_t channel) {
         return false;
     }
 
-    uint16_t startingAddress = CHANNEL_CONFIG_REGISTER_START + channel;
-
     // Read single channel configuration
-    auto result = readHoldingRegisters(startingAddress, 1);
+    mb8art::RegisterRequest request = mb8art::registerRequest(RegisterId::CHANNEL_CONFIG, channel);
+    mb8art::UntrackedTransaction untracked(busMetrics);
+    auto result = readHoldingRegisters(request.address, request.count);
 
     if (!result.isOk()) {
         auto category = modbus::ModbusErrorTracker::categorizeError(result.error());
@@ -369,68 +209,47 @@ bool MB8ART::reqChannelMode(uint8_t channel) {
 
 
 std::string MB8ART::baudRateToString(BaudRate rate) {
-    static const std::unordered_map<BaudRate, std::string> baudRateStrings = {
-        {BaudRate::BAUD_1200, "1200 bps"},
-        {BaudRate::BAUD_2400, "2400 bps"},
-        {BaudRate::BAUD_4800, "4800 bps"},
-        {BaudRate::BAUD_9600, "9600 bps"},
-        {BaudRate::BAUD_19200, "19200 bps"},
-        {BaudRate::BAUD_38400, "38400 bps"},
-        {BaudRate::BAUD_57600, "57600 bps"},
-        {BaudRate::BAUD_115200, "115200 bps"},
-        {BaudRate::BAUD_FACTORY_RESET, "Factory reset"}
+    // Indexed by BaudRate (flash, no hashtable)
+    static constexpr const char* baudRateStrings[] = {
+        "1200 bps", "2400 bps", "4800 bps", "9600 bps",
+        "19200 bps", "38400 bps", "57600 bps", "115200 bps",
+        "Factory reset"
     };
-    
-    auto it = baudRateStrings.find(rate);
-    return it != baudRateStrings.end() ? it->second : "Unknown baud rate";
+
+    size_t index = static_cast<size_t>(rate);
+    return index < sizeof(baudRateStrings) / sizeof(baudRateStrings[0])
+           ? baudRateStrings[index] : "Unknown baud rate";
 }
 
 
 
 
 std::string MB8ART::parityToString(Parity parity) {
-    static const std::unordered_map<Parity, std::string> parityStrings = {
-        {Parity::NONE, "None"},
-        {Parity::ODD, "Odd"},
-        {Parity::EVEN, "Even"},
-        {Parity::ERROR, "Error"}
-    };
-    
-    auto it = parityStrings.find(parity);
-    return it != parityStrings.end() ? it->second : "Unknown";
+    // Indexed by Parity
+    static constexpr const char* parityStrings[] = {"None", "Odd", "Even", "Error"};
+
+    size_t index = static_cast<size_t>(parity);
+    return index < sizeof(parityStrings) / sizeof(parityStrings[0])
+           ? parityStrings[index] : "Unknown";
 }
 
 
 
 
 BaudRate MB8ART::getBaudRateEnum(uint8_t rawValue) {
-    static const std::unordered_map<uint8_t, BaudRate> baudRateMap = {
-        {0x00, BaudRate::BAUD_1200},
-        {0x01, BaudRate::BAUD_2400},
-        {0x02, BaudRate::BAUD_4800},
-        {0x03, BaudRate::BAUD_9600},
-        {0x04, BaudRate::BAUD_19200},
-        {0x05, BaudRate::BAUD_38400},
-        {0x06, BaudRate::BAUD_57600},
-        {0x07, BaudRate::BAUD_115200}
-    };
-    
-    auto it = baudRateMap.find(rawValue);
-    return it != baudRateMap.end() ? it->second : BaudRate::ERROR;
+    // Register values 0x00-0x07 map 1:1 onto BAUD_1200..BAUD_115200
+    return rawValue <= static_cast<uint8_t>(BaudRate::BAUD_115200)
+           ? static_cast<BaudRate>(rawValue) : BaudRate::ERROR;
 }
 
 
 
 
 Parity MB8ART::getParityEnum(uint8_t rawValue) {
-    static const std::unordered_map<uint8_t, Parity> parityMap = {
-        {0, Parity::NONE},
-        {1, Parity::EVEN},
-        {2, Parity::ODD}
-    };
-    
-    auto it = parityMap.find(rawValue);
-    return it != parityMap.end() ? it->second : Parity::ERROR;
+    // Indexed by the register value (0 = none, 1 = even, 2 = odd)
+    static constexpr Parity parityMap[] = {Parity::NONE, Parity::EVEN, Parity::ODD};
+
+    return rawValue < sizeof(parityMap) / sizeof(parityMap[0]) ? parityMap[rawValue] : Parity::ERROR;
 }
 
 
@@ -461,9 +280,11 @@ void MB8ART::bindSensorPointers(const std::array<mb8art::SensorBinding, 8>& bind
 
     // Log which sensors have bindings
     for (size_t i = 0; i < 8; i++) {
-        if (bindings[i].temperaturePtr != nullptr && bindings[i].validityPtr != nullptr) {
-            LOG_MB8ART_DEBUG_NL("Sensor %d bound to temp=0x%p, valid=0x%p",
-                               i, bindings[i].temperaturePtr, bindings[i].validityPtr);
+        if ((bindings[i].temperaturePtr != nullptr || bindings[i].analogPtr != nullptr) &&
+            bindings[i].validityPtr != nullptr) {
+            LOG_MB8ART_DEBUG_NL("Sensor %d bound to temp=0x%p, analog=0x%p, valid=0x%p",
+                               i, bindings[i].temperaturePtr, bindings[i].analogPtr,
+                               bindings[i].validityPtr);
         } else {
             LOG_MB8ART_DEBUG_NL("Sensor %d has incomplete binding (nullptr)", i);
         }
@@ -485,3 +306,233 @@ void MB8ART::setHardwareConfig(const mb8art::SensorHardwareConfig* config) {
 }
 
 
+
+// ========== Engineering-Unit Mapping ==========
+
+bool MB8ART::setEngineeringScale(uint8_t channel, const mb8art::LinearScale& scale) {
+    if (channel >= DEFAULT_NUMBER_OF_SENSORS) {
+        LOG_MB8ART_ERROR_NL("setEngineeringScale: Invalid channel %d", channel);
+        return false;
+    }
+    if (scale.divider <= 0) {
+        LOG_MB8ART_ERROR_NL("setEngineeringScale: Invalid output divider %d for channel %d",
+                           scale.divider, channel);
+        return false;
+    }
+
+    engineeringScales[channel] = scale;
+    // Re-apply to the last sample so readers see consistent units immediately
+    updateEngineeringValue(channel, sensorState.temperature[channel]);
+
+    LOG_MB8ART_DEBUG_NL("Channel %d engineering scale: gain=%ld/65536, offset=%ld, divider=%d",
+                       channel, static_cast<long>(scale.gainQ16),
+                       static_cast<long>(scale.offset), scale.divider);
+    return true;
+}
+
+void MB8ART::clearEngineeringScale(uint8_t channel) {
+    if (channel >= DEFAULT_NUMBER_OF_SENSORS) {
+        return;
+    }
+    engineeringScales[channel] = mb8art::LinearScale{};
+    engineeringValues[channel] = sensorState.temperature[channel];
+}
+
+// ========== Channel Filter Chain ==========
+
+bool MB8ART::setChannelFilter(uint8_t channel, const mb8art::FilterConfig& config) {
+    if (channel >= DEFAULT_NUMBER_OF_SENSORS) {
+        LOG_MB8ART_ERROR_NL("setChannelFilter: Invalid channel %d", channel);
+        return false;
+    }
+    if (!config.isValid()) {
+        LOG_MB8ART_ERROR_NL("setChannelFilter: Invalid filter config for channel %d", channel);
+        return false;
+    }
+
+    taskENTER_CRITICAL(&channelStateMux);
+    channelFilters[channel].configure(config);
+    taskEXIT_CRITICAL(&channelStateMux);
+
+    LOG_MB8ART_DEBUG_NL("Channel %d filter: median=%d, smoothing=%d",
+                       channel, static_cast<int>(config.median), static_cast<int>(config.smoothing));
+    return true;
+}
+
+mb8art::FilterConfig MB8ART::getChannelFilter(uint8_t channel) const {
+    if (channel >= DEFAULT_NUMBER_OF_SENSORS) {
+        return mb8art::FilterConfig{};
+    }
+    taskENTER_CRITICAL(&channelStateMux);
+    mb8art::FilterConfig config = channelFilters[channel].getConfig();
+    taskEXIT_CRITICAL(&channelStateMux);
+    return config;
+}
+
+void MB8ART::resetChannelFilter(uint8_t channel) {
+    if (channel >= DEFAULT_NUMBER_OF_SENSORS) {
+        return;
+    }
+    taskENTER_CRITICAL(&channelStateMux);
+    channelFilters[channel].reset();
+    spikeRejectors[channel].reset();
+    taskEXIT_CRITICAL(&channelStateMux);
+}
+
+// ========== Spike Rejection ==========
+
+bool MB8ART::setRejectionConfig(uint8_t channel, const mb8art::RejectionConfig& config) {
+    if (channel >= DEFAULT_NUMBER_OF_SENSORS) {
+        LOG_MB8ART_ERROR_NL("setRejectionConfig: Invalid channel %d", channel);
+        return false;
+    }
+
+    taskENTER_CRITICAL(&channelStateMux);
+    spikeRejectors[channel].configure(config);
+    taskEXIT_CRITICAL(&channelStateMux);
+
+    LOG_MB8ART_DEBUG_NL("Channel %d rejection: maxSlew=%u/s, jumpThreshold=%u",
+                       channel, config.maxSlewPerSecond, config.jumpThreshold);
+    return true;
+}
+
+mb8art::RejectionConfig MB8ART::getRejectionConfig(uint8_t channel) const {
+    if (channel >= DEFAULT_NUMBER_OF_SENSORS) {
+        return mb8art::RejectionConfig{};
+    }
+    taskENTER_CRITICAL(&channelStateMux);
+    mb8art::RejectionConfig config = spikeRejectors[channel].getConfig();
+    taskEXIT_CRITICAL(&channelStateMux);
+    return config;
+}
+
+// ========== Rolling Statistics ==========
+
+bool MB8ART::setStatisticsWindow(uint8_t channel, uint8_t samples) {
+    if (channel >= DEFAULT_NUMBER_OF_SENSORS) {
+        LOG_MB8ART_ERROR_NL("setStatisticsWindow: Invalid channel %d", channel);
+        return false;
+    }
+    if (samples > mb8art::RollingStatistics::CAPACITY) {
+        LOG_MB8ART_ERROR_NL("setStatisticsWindow: Window %d exceeds capacity %d",
+                           samples, mb8art::RollingStatistics::CAPACITY);
+        return false;
+    }
+
+    taskENTER_CRITICAL(&channelStateMux);
+    channelStatistics[channel].setWindow(samples);
+    statisticsSnapshots[channel].write(mb8art::ChannelStatistics{});
+    taskEXIT_CRITICAL(&channelStateMux);
+    return true;
+}
+
+void MB8ART::resetChannelStatistics(uint8_t channel) {
+    if (channel >= DEFAULT_NUMBER_OF_SENSORS) {
+        return;
+    }
+    taskENTER_CRITICAL(&channelStateMux);
+    channelStatistics[channel].reset();
+    statisticsSnapshots[channel].write(mb8art::ChannelStatistics{});
+    taskEXIT_CRITICAL(&channelStateMux);
+}
+
+// ========== Rollups ==========
+
+bool MB8ART::attachRollup(uint8_t channel, mb8art::RollupSeries* series) {
+    if (channel >= DEFAULT_NUMBER_OF_SENSORS) {
+        LOG_MB8ART_ERROR_NL("attachRollup: Invalid channel %d", channel);
+        return false;
+    }
+    rollupSeries[channel] = series;
+    return true;
+}
+
+// ========== Alarm Rules ==========
+
+bool MB8ART::setAlarmRule(uint8_t channel, uint8_t ruleIndex, const mb8art::AlarmRule& rule) {
+    if (channel >= DEFAULT_NUMBER_OF_SENSORS || ruleIndex >= MB8ART_MAX_ALARM_RULES) {
+        LOG_MB8ART_ERROR_NL("setAlarmRule: Invalid channel %d or rule %d", channel, ruleIndex);
+        return false;
+    }
+    if (rule.hysteresis < 0) {
+        LOG_MB8ART_ERROR_NL("setAlarmRule: Negative hysteresis for channel %d", channel);
+        return false;
+    }
+
+    taskENTER_CRITICAL(&channelStateMux);
+    channelAlarms[channel].setRule(ruleIndex, rule);
+    if (channelAlarms[channel].hasRules()) {
+        alarmConfiguredMask |= (1 << channel);
+    } else {
+        alarmConfiguredMask &= ~(1 << channel);
+    }
+    taskEXIT_CRITICAL(&channelStateMux);
+
+    LOG_MB8ART_DEBUG_NL("Channel %d alarm rule %d: type=%d, threshold=%d, hysteresis=%d",
+                       channel, ruleIndex, static_cast<int>(rule.type), rule.threshold, rule.hysteresis);
+    return true;
+}
+
+void MB8ART::clearAlarmRules(uint8_t channel) {
+    if (channel >= DEFAULT_NUMBER_OF_SENSORS) {
+        return;
+    }
+    taskENTER_CRITICAL(&channelStateMux);
+    channelAlarms[channel].clear();
+    alarmConfiguredMask &= ~(1 << channel);
+    alarmActiveMask &= ~(1 << channel);
+    taskEXIT_CRITICAL(&channelStateMux);
+    publishAlarmBits();
+}
+
+void MB8ART::setAlarmCallback(mb8art::AlarmCallback callback, void* context) {
+    taskENTER_CRITICAL(&channelStateMux);
+    alarmCallback = callback;
+    alarmCallbackContext = context;
+    taskEXIT_CRITICAL(&channelStateMux);
+}
+
+// ========== Hold Policy ==========
+
+bool MB8ART::setHoldPolicy(uint8_t channel, const mb8art::HoldPolicy& policy) {
+    if (channel >= DEFAULT_NUMBER_OF_SENSORS) {
+        LOG_MB8ART_ERROR_NL("setHoldPolicy: Invalid channel %d", channel);
+        return false;
+    }
+    if (policy.isEnabled() && policy.uncertainAfterMs > policy.badAfterMs) {
+        LOG_MB8ART_ERROR_NL("setHoldPolicy: uncertainAfterMs %lu exceeds badAfterMs %lu",
+                           static_cast<unsigned long>(policy.uncertainAfterMs),
+                           static_cast<unsigned long>(policy.badAfterMs));
+        return false;
+    }
+
+    taskENTER_CRITICAL(&channelStateMux);
+    channelSnapshots[channel].policy = policy;
+    publishedSnapshots[channel].write(channelSnapshots[channel]);
+    taskEXIT_CRITICAL(&channelStateMux);
+
+    LOG_MB8ART_DEBUG_NL("Channel %d hold: uncertain=%lums, bad=%lums, extrapolate=%lums", channel,
+                       static_cast<unsigned long>(policy.uncertainAfterMs),
+                       static_cast<unsigned long>(policy.badAfterMs),
+                       static_cast<unsigned long>(policy.extrapolateMs));
+    return true;
+}
+
+mb8art::HoldPolicy MB8ART::getHoldPolicy(uint8_t channel) const {
+    if (channel >= DEFAULT_NUMBER_OF_SENSORS) {
+        return mb8art::HoldPolicy{};
+    }
+    return publishedSnapshots[channel].read().policy;
+}
+
+void MB8ART::resetChannelSnapshot(uint8_t channel) {
+    if (channel >= DEFAULT_NUMBER_OF_SENSORS) {
+        return;
+    }
+    taskENTER_CRITICAL(&channelStateMux);
+    mb8art::ChannelSnapshot cleared;
+    cleared.policy = channelSnapshots[channel].policy;
+    channelSnapshots[channel] = cleared;
+    publishedSnapshots[channel].write(cleared);
+    taskEXIT_CRITICAL(&channelStateMux);
+}
@@ -0,0 +1,445 @@
+#ifndef MB8ART_DEFERRED_LOG_H
+#define MB8ART_DEFERRED_LOG_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <string>
+#include <type_traits>
+
+/**
+ * @file MB8ARTDeferredLog.h
+ * @brief Binary log ring: capture format pointer + raw arguments, format later
+ *
+ * With MB8ART_DEFERRED_LOG=1 the LOG_MB8ART_*_NL macros do not call
+ * ESP_LOGx / LOG_WRITE. The caller copies the format-string pointer, a tick
+ * and its arguments (integers, doubles, pointers and a bounded copy of each
+ * string) into a fixed-size record and publishes it with one CAS - no
+ * vsnprintf, no UART, no logger mutex on the Modbus response path.
+ *
+ * Records are turned into text by formatDeferredLog(), which walks the
+ * format string and prints one conversion at a time. Run it from the
+ * low-priority task started by MB8ARTSharedResources::startDeferredLogTask(),
+ * call MB8ARTSharedResources::flushDeferredLog() from your own idle work, or
+ * pop() raw records and format them elsewhere.
+ *
+ * The ring is a bounded MPMC queue (Vyukov): when it is full new messages
+ * are dropped and counted rather than overwriting unread ones. Format
+ * strings must have static storage duration (string literals).
+ * Unsupported: '*' width/precision and %n.
+ */
+
+// Route LOG_MB8ART_*_NL through the ring (0 = log synchronously)
+#ifndef MB8ART_DEFERRED_LOG
+    #ifdef PROJECT_MB8ART_DEFERRED_LOG
+        #define MB8ART_DEFERRED_LOG PROJECT_MB8ART_DEFERRED_LOG
+    #else
+        #define MB8ART_DEFERRED_LOG 0
+    #endif
+#endif
+
+// Records in the global ring, power of two (~64 bytes each)
+#ifndef MB8ART_DEFERRED_LOG_RECORDS
+    #ifdef PROJECT_MB8ART_DEFERRED_LOG_RECORDS
+        #define MB8ART_DEFERRED_LOG_RECORDS PROJECT_MB8ART_DEFERRED_LOG_RECORDS
+    #else
+        #define MB8ART_DEFERRED_LOG_RECORDS 32
+    #endif
+#endif
+
+// Drain task stack (bytes) and polling period
+#ifndef MB8ART_DEFERRED_LOG_STACK_SIZE
+    #ifdef PROJECT_MB8ART_DEFERRED_LOG_STACK_SIZE
+        #define MB8ART_DEFERRED_LOG_STACK_SIZE PROJECT_MB8ART_DEFERRED_LOG_STACK_SIZE
+    #else
+        #define MB8ART_DEFERRED_LOG_STACK_SIZE 3072
+    #endif
+#endif
+
+#ifndef MB8ART_DEFERRED_LOG_FLUSH_MS
+    #ifdef PROJECT_MB8ART_DEFERRED_LOG_FLUSH_MS
+        #define MB8ART_DEFERRED_LOG_FLUSH_MS PROJECT_MB8ART_DEFERRED_LOG_FLUSH_MS
+    #else
+        #define MB8ART_DEFERRED_LOG_FLUSH_MS 50
+    #endif
+#endif
+
+namespace mb8art {
+
+enum class DeferredArgType : uint8_t {
+    NONE = 0,
+    I32,
+    U32,
+    I64,
+    U64,
+    F64,
+    STR,    // NUL-terminated copy in the payload
+    PTR
+};
+
+struct DeferredLogRecord {
+    static constexpr uint8_t MAX_ARGS = 8;
+    static constexpr uint8_t PAYLOAD_BYTES = 44;
+
+    const char* format;
+    uint32_t tick;
+    uint8_t level;
+    uint8_t argCount;
+    uint8_t payloadUsed;
+    uint8_t truncated;      // Arguments or string bytes did not fit
+    uint8_t types[MAX_ARGS];
+    uint8_t payload[PAYLOAD_BYTES];
+};
+
+namespace detail {
+
+inline void putDeferredArg(DeferredLogRecord& r, DeferredArgType type, const void* value, size_t size) {
+    if (r.argCount >= DeferredLogRecord::MAX_ARGS ||
+        r.payloadUsed + size > DeferredLogRecord::PAYLOAD_BYTES) {
+        r.truncated = 1;
+        return;
+    }
+    memcpy(r.payload + r.payloadUsed, value, size);
+    r.payloadUsed += static_cast<uint8_t>(size);
+    r.types[r.argCount++] = static_cast<uint8_t>(type);
+}
+
+inline void putDeferredString(DeferredLogRecord& r, const char* s) {
+    if (s == nullptr) {
+        s = "(null)";
+    }
+    size_t room = DeferredLogRecord::PAYLOAD_BYTES - r.payloadUsed;
+    if (r.argCount >= DeferredLogRecord::MAX_ARGS || room == 0) {
+        r.truncated = 1;
+        return;
+    }
+    size_t length = strlen(s);
+    if (length + 1 > room) {
+        length = room - 1;
+        r.truncated = 1;
+    }
+    memcpy(r.payload + r.payloadUsed, s, length);
+    r.payload[r.payloadUsed + length] = '\0';
+    r.payloadUsed += static_cast<uint8_t>(length + 1);
+    r.types[r.argCount++] = static_cast<uint8_t>(DeferredArgType::STR);
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value>::type
+packDeferredArg(DeferredLogRecord& r, T value) {
+    if (sizeof(T) <= 4) {
+        if (std::is_signed<T>::value) {
+            int32_t v = static_cast<int32_t>(value);
+            putDeferredArg(r, DeferredArgType::I32, &v, sizeof(v));
+        } else {
+            uint32_t v = static_cast<uint32_t>(value);
+            putDeferredArg(r, DeferredArgType::U32, &v, sizeof(v));
+        }
+    } else if (std::is_signed<T>::value) {
+        int64_t v = static_cast<int64_t>(value);
+        putDeferredArg(r, DeferredArgType::I64, &v, sizeof(v));
+    } else {
+        uint64_t v = static_cast<uint64_t>(value);
+        putDeferredArg(r, DeferredArgType::U64, &v, sizeof(v));
+    }
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_enum<T>::value>::type
+packDeferredArg(DeferredLogRecord& r, T value) {
+    int32_t v = static_cast<int32_t>(value);
+    putDeferredArg(r, DeferredArgType::I32, &v, sizeof(v));
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value>::type
+packDeferredArg(DeferredLogRecord& r, T value) {
+    double v = static_cast<double>(value);
+    putDeferredArg(r, DeferredArgType::F64, &v, sizeof(v));
+}
+
+inline void packDeferredArg(DeferredLogRecord& r, const char* s) { putDeferredString(r, s); }
+inline void packDeferredArg(DeferredLogRecord& r, char* s) { putDeferredString(r, s); }
+inline void packDeferredArg(DeferredLogRecord& r, const std::string& s) { putDeferredString(r, s.c_str()); }
+
+template <typename T>
+inline void packDeferredArg(DeferredLogRecord& r, T* p) {
+    uint64_t v = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(p));
+    putDeferredArg(r, DeferredArgType::PTR, &v, sizeof(v));
+}
+
+inline void packDeferredArgs(DeferredLogRecord&) {}
+
+template <typename T, typename... Rest>
+inline void packDeferredArgs(DeferredLogRecord& r, const T& first, const Rest&... rest) {
+    packDeferredArg(r, first);
+    packDeferredArgs(r, rest...);
+}
+
+} // namespace detail
+
+/**
+ * @brief Bounded lock-free queue of log records
+ *
+ * Cell sequences are stored relative to the cell index so that a
+ * zero-initialised ring is empty and the constructor can stay constexpr
+ * (no guard on the function-local global ring).
+ */
+template <uint16_t Capacity>
+class DeferredLogRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "DeferredLogRing capacity must be a power of two");
+public:
+    constexpr DeferredLogRing() : cells(), enqueuePos(0), dequeuePos(0), droppedCount(0) {}
+
+    DeferredLogRing(const DeferredLogRing&) = delete;
+    DeferredLogRing& operator=(const DeferredLogRing&) = delete;
+
+    /**
+     * @brief Capture one message
+     * @return false if the ring was full (counted in takeDropped())
+     */
+    template <typename... Args>
+    bool write(uint8_t level, uint32_t tick, const char* format, const Args&... args) {
+        uint32_t pos = enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &cells[pos & (Capacity - 1)];
+            int32_t diff = static_cast<int32_t>(cell->sequence.load(std::memory_order_acquire) -
+                                                lap(pos));
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        DeferredLogRecord& r = cell->record;
+        r.format = format;
+        r.tick = tick;
+        r.level = level;
+        r.argCount = 0;
+        r.payloadUsed = 0;
+        r.truncated = 0;
+        detail::packDeferredArgs(r, args...);
+        cell->sequence.store(lap(pos) + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Take the oldest record
+     * @return false if the ring is empty
+     */
+    bool pop(DeferredLogRecord& out) {
+        uint32_t pos = dequeuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &cells[pos & (Capacity - 1)];
+            int32_t diff = static_cast<int32_t>(cell->sequence.load(std::memory_order_acquire) -
+                                                (lap(pos) + 1));
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        out = cell->record;
+        cell->sequence.store(lap(pos) + Capacity, std::memory_order_release);
+        return true;
+    }
+
+    // Messages dropped because the ring was full since the last call
+    uint32_t takeDropped() { return droppedCount.exchange(0, std::memory_order_relaxed); }
+
+    uint16_t getCapacity() const { return Capacity; }
+
+private:
+    struct Cell {
+        std::atomic<uint32_t> sequence;
+        DeferredLogRecord record;
+    };
+
+    // Sequence a cell holds when free for position pos, minus its index
+    static uint32_t lap(uint32_t pos) { return pos & ~static_cast<uint32_t>(Capacity - 1); }
+
+    Cell cells[Capacity];
+    std::atomic<uint32_t> enqueuePos;
+    std::atomic<uint32_t> dequeuePos;
+    std::atomic<uint32_t> droppedCount;
+};
+
+/**
+ * @brief Render a record the way printf would have
+ * @return Length of the text (truncated to size - 1)
+ */
+inline size_t formatDeferredLog(const DeferredLogRecord& r, char* out, size_t size) {
+    if (size == 0) {
+        return 0;
+    }
+    size_t used = 0;
+    uint8_t arg = 0;
+    uint8_t offset = 0;
+    const char* p = r.format != nullptr ? r.format : "(null)";
+
+    auto append = [&](const char* text, size_t n) {
+        size_t room = size - 1 - used;
+        n = n < room ? n : room;
+        memcpy(out + used, text, n);
+        used += n;
+    };
+
+    while (*p != '\0' && used < size - 1) {
+        if (*p != '%') {
+            const char* next = strchr(p, '%');
+            size_t n = next != nullptr ? static_cast<size_t>(next - p) : strlen(p);
+            append(p, n);
+            p += n;
+            continue;
+        }
+        if (p[1] == '%') {
+            append("%", 1);
+            p += 2;
+            continue;
+        }
+
+        // %[flags][width][.precision][length]conversion; length is rewritten
+        // to match the stored width, so it is parsed but not copied
+        char spec[24];
+        size_t n = 0;
+        const char* start = p++;
+        while (*p != '\0' && strchr("-+ #0", *p) != nullptr && n < 8) spec[++n] = *p++;
+        while (*p >= '0' && *p <= '9' && n < 12) spec[++n] = *p++;
+        if (*p == '.') {
+            spec[++n] = *p++;
+            while (*p >= '0' && *p <= '9' && n < 18) spec[++n] = *p++;
+        }
+        while (*p != '\0' && strchr("hlLqjzt", *p) != nullptr) p++;
+        char conversion = *p;
+        if (conversion == '\0') {
+            append(start, static_cast<size_t>(p - start));
+            break;
+        }
+        p++;
+        spec[0] = '%';
+
+        char field[48];
+        int written = 0;
+        DeferredArgType type = arg < r.argCount ? static_cast<DeferredArgType>(r.types[arg])
+                                                : DeferredArgType::NONE;
+        const uint8_t* value = r.payload + offset;
+        int64_t i64 = 0;
+        uint64_t u64 = 0;
+        double f64 = 0;
+        switch (type) {
+            case DeferredArgType::I32: { int32_t v; memcpy(&v, value, 4); i64 = v; u64 = static_cast<uint32_t>(v); f64 = v; offset += 4; break; }
+            case DeferredArgType::U32: { uint32_t v; memcpy(&v, value, 4); i64 = static_cast<int32_t>(v); u64 = v; f64 = v; offset += 4; break; }
+            case DeferredArgType::I64: memcpy(&i64, value, 8); u64 = static_cast<uint64_t>(i64); f64 = static_cast<double>(i64); offset += 8; break;
+            case DeferredArgType::U64:
+            case DeferredArgType::PTR: memcpy(&u64, value, 8); i64 = static_cast<int64_t>(u64); f64 = static_cast<double>(u64); offset += 8; break;
+            case DeferredArgType::F64: memcpy(&f64, value, 8); i64 = static_cast<int64_t>(f64); u64 = static_cast<uint64_t>(i64); offset += 8; break;
+            case DeferredArgType::STR: offset += static_cast<uint8_t>(strlen(reinterpret_cast<const char*>(value)) + 1); break;
+            case DeferredArgType::NONE: break;
+        }
+        if (type == DeferredArgType::NONE) {
+            append("?", 1);  // Argument did not fit in the record
+            continue;
+        }
+        arg++;
+
+        switch (conversion) {
+            case 'd': case 'i':
+                spec[++n] = 'l'; spec[++n] = 'l'; spec[++n] = conversion; spec[++n] = '\0';
+                written = snprintf(field, sizeof(field), spec, static_cast<long long>(i64));
+                break;
+            case 'u': case 'x': case 'X': case 'o':
+                spec[++n] = 'l'; spec[++n] = 'l'; spec[++n] = conversion; spec[++n] = '\0';
+                written = snprintf(field, sizeof(field), spec, static_cast<unsigned long long>(u64));
+                break;
+            case 'c':
+                spec[++n] = 'c'; spec[++n] = '\0';
+                written = snprintf(field, sizeof(field), spec, static_cast<int>(i64));
+                break;
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+                spec[++n] = conversion; spec[++n] = '\0';
+                written = snprintf(field, sizeof(field), spec, f64);
+                break;
+            case 's':
+                spec[++n] = 's'; spec[++n] = '\0';
+                written = snprintf(field, sizeof(field), spec,
+                                   type == DeferredArgType::STR ? reinterpret_cast<const char*>(value) : "?");
+                break;
+            case 'p':
+                written = snprintf(field, sizeof(field), "0x%llx", static_cast<unsigned long long>(u64));
+                break;
+            default:
+                append(start, static_cast<size_t>(p - start));
+                continue;
+        }
+        if (written > 0) {
+            append(field, static_cast<size_t>(written) < sizeof(field) ? static_cast<size_t>(written)
+                                                                       : sizeof(field) - 1);
+        }
+    }
+    if (r.truncated && used < size - 1) {
+        append(" [...]", 6);
+    }
+    out[used] = '\0';
+    return used;
+}
+
+// Receives formatted text from DeferredLog::drain()
+typedef void (*DeferredLogSink)(void* context, uint8_t level, uint32_t tick, const char* text);
+
+/**
+ * @brief The ring behind LOG_MB8ART_*_NL when MB8ART_DEFERRED_LOG=1
+ */
+class DeferredLog {
+public:
+    typedef DeferredLogRing<MB8ART_DEFERRED_LOG_RECORDS> Ring;
+    static constexpr size_t LINE_BYTES = 160;
+
+    static Ring& ring() {
+        static Ring instance;
+        return instance;
+    }
+
+    template <typename... Args>
+    static bool write(uint8_t level, uint32_t tick, const char* format, const Args&... args) {
+        return ring().write(level, tick, format, args...);
+    }
+
+    /**
+     * @brief Format and hand out up to maxRecords pending messages, oldest first
+     * @return Messages delivered
+     */
+    static uint16_t drain(DeferredLogSink sink, void* context, uint16_t maxRecords = 0xFFFF) {
+        DeferredLogRecord record;
+        char line[LINE_BYTES];
+        uint16_t n = 0;
+        while (n < maxRecords && ring().pop(record)) {
+            formatDeferredLog(record, line, sizeof(line));
+            sink(context, record.level, record.tick, line);
+            n++;
+        }
+        return n;
+    }
+};
+
+// Never called - lets the compiler check deferred format strings
+inline void deferredLogFormatCheck(const char*, ...) __attribute__((format(printf, 1, 2)));
+inline void deferredLogFormatCheck(const char*, ...) {}
+
+} // namespace mb8art
+
+#endif // MB8ART_DEFERRED_LOG_H
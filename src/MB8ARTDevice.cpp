@@ -19,6 +19,7 @@ bool MB8ART::probeDevice() {
 
     // Single read to verify device is responsive
     // Use measurement range register - small, fast, and confirms device identity
+    mb8art::UntrackedTransaction untracked(busMetrics);
     auto result = readHoldingRegisters(MEASUREMENT_RANGE_REGISTER, 1);
 
     if (result.isOk() && !result.value().empty()) {
@@ -115,12 +116,30 @@ IDeviceInstance::DeviceError MB8ART::waitForData(TickType_t timeout) {
         timeout
     );
 
-    if (sensorBits & interleavedUpdateMask) {
+    uint8_t receivedMask = 0;
+    for (uint8_t i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
+        if (sensorBits & mb8art::SENSOR_UPDATE_BITS[i]) {
+            receivedMask |= static_cast<uint8_t>(1u << i);
+        }
+    }
+    uint8_t missingMask = static_cast<uint8_t>(activeChannelMask) & ~receivedMask;
+
+    if (receivedMask != 0) {
         LOG_MB8ART_DEBUG_NL("Received sensor bits: 0x%04X", sensorBits);
 
         // Reset consecutive timeout counter on successful data reception
         consecutiveTimeouts = 0;
 
+        if (missingMask != 0) {
+            // The bus answered - only the channels without an update bit are
+            // held, and it is not counted as a bus timeout. The wait timed
+            // out, so clear the received bits as a satisfied wait would.
+            commitSensorEventBits(0, sensorBits & interleavedUpdateMask);
+            ageSilentChannels(missingMask);
+            LOG_MB8ART_WARN_LIMITED(logLimiters[mb8art::LogSite::DATA_TIMEOUT],
+                                    "No update for channels 0x%02X", missingMask);
+        }
+
         // Process each channel - check both update and error bits
         for (uint8_t i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
             if (activeChannelMask & (1 << i)) {
@@ -128,7 +147,8 @@ IDeviceInstance::DeviceError MB8ART::waitForData(TickType_t timeout) {
                     LOG_MB8ART_DEBUG_NL("Channel %d data updated", i);
                 }
                 if (sensorBits & mb8art::SENSOR_ERROR_BITS[i]) {
-                    LOG_MB8ART_WARN_NL("Channel %d error detected", i);
+                    LOG_MB8ART_WARN_LIMITED(logLimiters[mb8art::LogSite::CHANNEL_ERROR],
+                                            "Channel %d error detected", i);
                 }
             }
         }
@@ -137,14 +157,19 @@ IDeviceInstance::DeviceError MB8ART::waitForData(TickType_t timeout) {
         return IDeviceInstance::DeviceError::SUCCESS;
     }
 
+    ageSilentChannels(static_cast<uint8_t>(activeChannelMask));
+
     // Timeout occurred - track consecutive failures for automatic offline detection
     consecutiveTimeouts++;
-    LOG_MB8ART_WARN_NL("Timeout waiting for sensor data (attempt %d/%d, mask: 0x%04X)",
-                       consecutiveTimeouts, OFFLINE_THRESHOLD, interleavedUpdateMask);
+    busMetrics.dataTimeout();
+    LOG_MB8ART_WARN_LIMITED(logLimiters[mb8art::LogSite::DATA_TIMEOUT],
+                            "Timeout waiting for sensor data (attempt %d/%d, mask: 0x%04X)",
+                            consecutiveTimeouts, OFFLINE_THRESHOLD, interleavedUpdateMask);
 
     // Auto-set offline flag after threshold reached
     if (consecutiveTimeouts >= OFFLINE_THRESHOLD && !statusFlags.moduleOffline) {
         statusFlags.moduleOffline = 1;
+        busMetrics.wentOffline();
         LOG_MB8ART_ERROR_NL("Module marked OFFLINE after %d consecutive timeouts",
                            consecutiveTimeouts);
     }
@@ -162,7 +187,7 @@ IDeviceInstance::DeviceResult<void> MB8ART::processData() {
             continue;
         }
 
-        if (sensorReadings[i].isTemperatureValid && sensorReadings[i].lastCommandSuccess) {
+        if (sensorState.isValid(i) && sensorState.isCommandOk(i)) {
             anyDataProcessed = true;
         }
     }
@@ -183,7 +208,9 @@ IDeviceInstance::DeviceResult<void> MB8ART::requestData() {
     
     // Check if device is offline
     if (statusFlags.moduleOffline) {
-        LOG_MB8ART_ERROR_NL("Cannot request data - device is offline");
+        LOG_MB8ART_ERROR_LIMITED(logLimiters[mb8art::LogSite::OFFLINE],
+                                 "Cannot request data - device is offline");
+        ageSilentChannels(static_cast<uint8_t>(activeChannelMask));
         return IDeviceInstance::DeviceResult<void>(IDeviceInstance::DeviceError::COMMUNICATION_ERROR);
     }
 
@@ -209,7 +236,7 @@ IDeviceInstance::DeviceResult<void> MB8ART::requestData() {
 
     // Clear bits for active channels (interleaved format)
     if (xSensorEventGroup) {
-        MB8ART_SRP_EVENT_GROUP_CLEAR_BITS(xSensorEventGroup, interleavedMask);
+        commitSensorEventBits(0, interleavedMask);
     }
     
     // Request all temperatures at once (batch read)
@@ -231,7 +258,8 @@ IDeviceInstance::DeviceResult<void> MB8ART::configureMeasurementRange(mb8art::Me
     }
     
     if (statusFlags.moduleOffline) {
-        LOG_MB8ART_ERROR_NL("Cannot configure measurement range - device is offline");
+        LOG_MB8ART_ERROR_LIMITED(logLimiters[mb8art::LogSite::OFFLINE],
+                                 "Cannot configure measurement range - device is offline");
         return IDeviceInstance::DeviceResult<void>(IDeviceInstance::DeviceError::COMMUNICATION_ERROR);
     }
 
@@ -240,6 +268,7 @@ IDeviceInstance::DeviceResult<void> MB8ART::configureMeasurementRange(mb8art::Me
     uint16_t dataToWrite = static_cast<uint16_t>(range);
     
     // Use synchronous write from base class
+    mb8art::UntrackedTransaction untracked(busMetrics);
     auto result = writeSingleRegister(MEASUREMENT_RANGE_REGISTER, dataToWrite);
 
     if (result.isOk()) {
@@ -263,7 +292,8 @@ IDeviceInstance::DeviceResult<void> MB8ART::configureChannelMode(uint8_t channel
     }
     
     if (statusFlags.moduleOffline) {
-        LOG_MB8ART_ERROR_NL("Cannot configure channel - device is offline");
+        LOG_MB8ART_ERROR_LIMITED(logLimiters[mb8art::LogSite::OFFLINE],
+                                 "Cannot configure channel - device is offline");
         return IDeviceInstance::DeviceResult<void>(IDeviceInstance::DeviceError::COMMUNICATION_ERROR);
     }
 
@@ -287,6 +317,7 @@ IDeviceInstance::DeviceResult<void> MB8ART::configureChannelMode(uint8_t channel
     }
 
     // Use synchronous write from base class
+    mb8art::UntrackedTransaction untracked(busMetrics);
     auto result = writeSingleRegister(registerAddress, mode);
 
     if (result.isOk()) {
@@ -294,8 +325,8 @@ IDeviceInstance::DeviceResult<void> MB8ART::configureChannelMode(uint8_t channel
         channelConfigs[channel].subType = subType;
         
         // Mark sensor as requiring update
-        sensorReadings[channel].lastCommandSuccess = true;
-        sensorReadings[channel].isStateConfirmed = false;
+        sensorState.setCommandOk(channel, true);
+        sensorState.setConfirmed(channel, false);
         
         LOG_MB8ART_DEBUG_NL("Channel %d configured: Mode=%s, SubType=%s", 
                           channel,
@@ -307,7 +338,7 @@ IDeviceInstance::DeviceResult<void> MB8ART::configureChannelMode(uint8_t channel
     }
 
     LOG_MB8ART_ERROR_NL("Failed to configure channel");
-    sensorReadings[channel].lastCommandSuccess = false;
+    sensorState.setCommandOk(channel, false);
     return IDeviceInstance::DeviceResult<void>(IDeviceInstance::DeviceError::COMMUNICATION_ERROR);
 }
 
@@ -321,6 +352,7 @@ IDeviceInstance::DeviceResult<void> MB8ART::configureAllChannels(mb8art::Channel
     
     // Use writeMultipleRegisters for batch writing
     std::vector<uint16_t> values(DEFAULT_NUMBER_OF_SENSORS, config);
+    mb8art::UntrackedTransaction untracked(busMetrics);
     auto result = writeMultipleRegisters(CHANNEL_CONFIG_REGISTER_START, values);
     
     if (result.isOk()) {
@@ -363,6 +395,7 @@ IDeviceInstance::DeviceResult<void> MB8ART::configureChannelRange(uint8_t startC
     // Use writeMultipleRegisters for batch writing
     uint16_t startRegister = static_cast<uint16_t>(CHANNEL_CONFIG_REGISTER_START + startChannel);
     std::vector<uint16_t> values(channelCount, config);
+    mb8art::UntrackedTransaction untracked(busMetrics);
     auto result = writeMultipleRegisters(startRegister, values);
     
     if (result.isOk()) {
@@ -405,9 +438,12 @@ IDeviceInstance::DeviceResult<void> MB8ART::requestAllData() {
     
     // Request connection status first (optional)
     // Read discrete inputs for connection status
-    auto result = readDiscreteInputs(CONNECTION_STATUS_START_REGISTER, DEFAULT_NUMBER_OF_SENSORS);
+    mb8art::RegisterRequest statusRequest = mb8art::registerRequest(mb8art::RegisterId::CONNECTION_STATUS);
+    auto result = readDiscreteInputs(statusRequest.address, statusRequest.count);
+    busMetrics.requestQueued(result.isOk());
     if (!result.isOk()) {
-        LOG_MB8ART_WARN_NL("Failed to request connection status");
+        LOG_MB8ART_WARN_LIMITED(logLimiters[mb8art::LogSite::REQUEST_FAILED],
+                                "Failed to request connection status");
     }
     vTaskDelay(pdMS_TO_TICKS(20));
     
@@ -440,7 +476,15 @@ IDeviceInstance::DeviceResult<void> MB8ART::reqTemperatures(int numberOfSensors,
 
     // Read all sensor temperatures in one batch - 8 registers starting at 0
     // Use SENSOR priority (safety-critical data)
-    auto result = readInputRegistersWithPriority(0, count, esp32Modbus::SENSOR);
+    mb8art::RegisterRequest request = mb8art::registerRequest(mb8art::RegisterId::TEMPERATURES);
+    uint32_t requestedUs = getLatencyTimeUs() | 1;  // 0 means none
+    pendingRequestUs.store(requestedUs, std::memory_order_relaxed);
+    if (traceBuffer != nullptr) {
+        traceTransaction(mb8art::TraceKind::REQUEST, request.functionCode,
+                         request.address, 0, nullptr, count * 2, requestedUs);
+    }
+    auto result = readInputRegistersWithPriority(request.address, count, esp32Modbus::SENSOR);
+    busMetrics.requestQueued(result.isOk());
 
     MB8ART_PERF_END(req_temps, "Request temperatures");
     
@@ -449,7 +493,9 @@ IDeviceInstance::DeviceResult<void> MB8ART::reqTemperatures(int numberOfSensors,
         // LOG_MB8ART_DEBUG_NL("Temperature request sent for %d sensors", count);
         return IDeviceInstance::DeviceResult<void>();
     } else {
-        LOG_MB8ART_ERROR_NL("Failed to request temperatures");
+        pendingRequestUs.store(0, std::memory_order_relaxed);
+        LOG_MB8ART_ERROR_LIMITED(logLimiters[mb8art::LogSite::REQUEST_FAILED],
+                                 "Failed to request temperatures");
         return IDeviceInstance::DeviceResult<void>(IDeviceInstance::DeviceError::COMMUNICATION_ERROR);
     }
 }
@@ -474,7 +520,7 @@ IDeviceInstance::DeviceResult<std::vector<float>> MB8ART::getData(IDeviceInstanc
             for (int i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
                 if (channelConfigs[i].mode != static_cast<uint16_t>(mb8art::ChannelMode::DEACTIVATED)) {
                     activeCount++;
-                    if (sensorReadings[i].isTemperatureValid) {
+                    if (sensorState.isValid(i)) {
                         validCount++;
                     }
                 }
@@ -495,15 +541,22 @@ IDeviceInstance::DeviceResult<std::vector<float>> MB8ART::getData(IDeviceInstanc
             // Divider is PER-CHANNEL based on sensor type:
             // - PT1000 + HIGH_RES: hundredths (÷100)
             // - PT100 (any mode): tenths (÷10) - PT100 does NOT support HIGH_RES
+            // - Voltage/current: range-dependent (see getDataScaleDivider)
+            // - Analog channels with an engineering scale: mapped units
             // - All others: tenths (÷10)
             std::vector<float> temperatures;
             temperatures.reserve(DEFAULT_NUMBER_OF_SENSORS);
 
             for (int i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
                 if (channelConfigs[i].mode != static_cast<uint16_t>(mb8art::ChannelMode::DEACTIVATED)) {
+                    if (engineeringScales[i].isEnabled() && isAnalogChannel(i)) {
+                        temperatures.push_back(static_cast<float>(engineeringValues[i]) /
+                                               engineeringScales[i].divider);
+                        continue;
+                    }
                     float divider = static_cast<float>(getDataScaleDivider(
                         IDeviceInstance::DeviceDataType::TEMPERATURE, i));
-                    temperatures.push_back(sensorReadings[i].temperature / divider);
+                    temperatures.push_back(sensorState.temperature[i] / divider);
                 }
             }
             
@@ -534,7 +587,7 @@ IDeviceInstance::DeviceResult<std::vector<int16_t>> MB8ART::getDataRaw(IDeviceIn
 
             for (int i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
                 if (channelConfigs[i].mode != static_cast<uint16_t>(mb8art::ChannelMode::DEACTIVATED)) {
-                    temperatures.push_back(sensorReadings[i].temperature);
+                    temperatures.push_back(sensorState.temperature[i]);
                 }
             }
 
@@ -563,36 +616,20 @@ int16_t MB8ART::getDataScaleDivider(IDeviceInstance::DeviceDataType dataType, ui
     switch (dataType) {
         case IDeviceInstance::DeviceDataType::TEMPERATURE: {
             // Per-channel scaling based on input type and resolution mode (register 76)
-            // See HARDWARE.md for full documentation
-            //
-            // Resolution behavior:
+            // See HARDWARE.md for full documentation and mb8art::CHANNEL_MODES:
             // - Thermocouples: Always tenths (÷10), not affected by register 76
             // - PT/RTD (PT100, PT1000, CU50, CU100): Follow register 76
             //   - LOW_RES (0): tenths (÷10)
             //   - HIGH_RES (1): hundredths (÷100)
-            // - Voltage/Current: Assumed tenths (÷10)
+            // - Voltage: per range, see VOLTAGE_RANGE_SCALES (value / divider = mV)
+            // - Current: hundredths of mA (÷100)
+            // - Deactivated: tenths
 
             if (channel >= DEFAULT_NUMBER_OF_SENSORS) {
                 return 10;  // Default for invalid channel
             }
-
-            // Thermocouples always output tenths regardless of resolution mode
-            if (channelConfigs[channel].mode == static_cast<uint16_t>(mb8art::ChannelMode::THERMOCOUPLE)) {
-                return 10;
-            }
-
-            // PT/RTD inputs follow the resolution register
-            if (channelConfigs[channel].mode == static_cast<uint16_t>(mb8art::ChannelMode::PT_INPUT)) {
-                return (currentRange == mb8art::MeasurementRange::HIGH_RES) ? 100 : 10;
-            }
-
-            // Current channels: hundredths (processCurrentData returns hundredths of mA)
-            if (channelConfigs[channel].mode == static_cast<uint16_t>(mb8art::ChannelMode::CURRENT)) {
-                return 100;
-            }
-
-            // Voltage and deactivated channels: tenths
-            return 10;
+            return mb8art::channelScale(channelConfigs[channel].mode, channelConfigs[channel].subType,
+                                        currentRange).divider;
         }
         default:
             return 1;
@@ -0,0 +1,98 @@
+#ifndef MB8ART_EVENT_BITS_H
+#define MB8ART_EVENT_BITS_H
+
+#include <stdint.h>
+
+/**
+ * @file MB8ARTEventBits.h
+ * @brief Coalescing of sensor event-group updates
+ *
+ * Each xEventGroupSetBits / xEventGroupClearBits is a kernel entry (critical
+ * section, waiter list walk). Per frame the driver used to issue an error
+ * clear, an update set, an error set and an alarm clear/set - each through
+ * an out-of-line, null-checking wrapper.
+ *
+ * SensorEventPublisher folds a frame's changes into at most one clear and
+ * one set. It also remembers which "level" bits (error and alarm bits, set
+ * and cleared only by the driver) are currently published, so clearing a
+ * level bit that is already clear costs no kernel call. Update bits are
+ * edge bits consumers clear themselves; they are always passed through.
+ *
+ * The published levels are a superset of the level bits that may be set in
+ * the group: sets are recorded before the kernel call, clears only after it
+ * (finish()) and only when no other commit overlapped - an overlapping set
+ * can land after our clear, so the bit stays "maybe set" and the next clear
+ * of it goes through to the kernel.
+ *
+ * Pure bookkeeping - the caller issues the kernel calls between prepare()
+ * and finish(), so this runs on the host as well. Not thread-safe: callers
+ * serialize prepare()/finish()/forget() with their own lock (MB8ART uses
+ * channelStateMux) but must not hold it across the kernel calls.
+ */
+
+namespace mb8art {
+
+struct EventBitsCommit {
+    uint32_t toClear;        // 0 = no xEventGroupClearBits needed
+    uint32_t toSet;          // 0 = no xEventGroupSetBits needed
+    uint32_t levelsCleared;  // Level bits this commit clears (finish() unpublishes them)
+    uint32_t ticket;         // prepare() sequence number
+    bool contended;          // Another commit was in flight at prepare()
+};
+
+class SensorEventPublisher {
+public:
+    explicit SensorEventPublisher(uint32_t levelBitMask)
+        : levelMask(levelBitMask), published(0), prepared(0), inFlight(0) {}
+
+    /**
+     * @brief Reduce a requested change to the kernel calls it needs
+     *
+     * Bits in both masks end up set (clear is issued first). Call finish()
+     * with the result once the kernel calls are done.
+     */
+    EventBitsCommit prepare(uint32_t toSet, uint32_t toClear) {
+        EventBitsCommit commit;
+        toClear &= ~toSet;
+        uint32_t levelsToClear = toClear & levelMask;
+        published |= toSet & levelMask;
+
+        // Level bits only need clearing if they may be set
+        commit.toClear = (toClear & ~levelMask) | (levelsToClear & published);
+        commit.toSet = toSet;
+        commit.levelsCleared = levelsToClear;
+        commit.ticket = ++prepared;
+        commit.contended = (inFlight != 0);
+        inFlight++;
+        return commit;
+    }
+
+    /**
+     * @brief Retire a commit after its kernel calls
+     */
+    void finish(const EventBitsCommit& commit) {
+        inFlight--;
+        if (!commit.contended && commit.ticket == prepared) {
+            published &= ~commit.levelsCleared;
+        }
+    }
+
+    /**
+     * @brief Record that bits were cleared outside prepare() (e.g. group reset)
+     */
+    void forget(uint32_t clearedBits) {
+        published &= ~clearedBits;
+    }
+
+    uint32_t getPublishedLevels() const { return published; }
+
+private:
+    const uint32_t levelMask;
+    uint32_t published;
+    uint32_t prepared;
+    uint8_t inFlight;
+};
+
+} // namespace mb8art
+
+#endif // MB8ART_EVENT_BITS_H
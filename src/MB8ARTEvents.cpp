@@ -27,28 +27,14 @@ void MB8ART::updateEventBits(EventBits_t updateBitsToSet,
     // Single event group with interleaved bits - no shifting needed!
     // Bits are already in correct positions from SENSOR_UPDATE_BITS/SENSOR_ERROR_BITS arrays
 
-    // Handle error bits - clear first, then set
-    if (errorBitsToClear) {
-        MB8ART_SRP_EVENT_GROUP_CLEAR_BITS(xSensorEventGroup, errorBitsToClear);
-        LOG_MB8ART_DEBUG_NL("Clearing error bits: 0x%04X", errorBitsToClear);
-    }
-
-    // Handle update bits
-    if (updateBitsToSet) {
-        MB8ART_SRP_EVENT_GROUP_SET_BITS(xSensorEventGroup, updateBitsToSet);
-        LOG_MB8ART_DEBUG_NL("Setting update bits: 0x%04X", updateBitsToSet);
-    }
-
-    if (errorBitsToSet) {
-        MB8ART_SRP_EVENT_GROUP_SET_BITS(xSensorEventGroup, errorBitsToSet);
-        LOG_MB8ART_DEBUG_NL("Setting error bits: 0x%04X", errorBitsToSet);
-    }
+    // Fold the frame's alarm transitions in, then publish everything with at
+    // most one clear (errors/alarms that went away) and one set
+    EventBits_t alarmBitsToSet = 0;
+    EventBits_t alarmBitsToClear = 0;
+    collectAlarmBits(alarmBitsToSet, alarmBitsToClear);
 
-    // Notify the data receiver task about errors
-    if (errorBitsToSet && dataReceiverTask) {
-        xTaskNotify(dataReceiverTask, DATA_ERROR_BIT, eSetBits);
-        LOG_MB8ART_DEBUG_NL("Notified data receiver task about errors");
-    }
+    commitSensorEventBits(updateBitsToSet | errorBitsToSet | alarmBitsToSet,
+                          errorBitsToClear | alarmBitsToClear);
 
     LOG_MB8ART_DEBUG_NL("Event bits updated - update: 0x%04X, error set: 0x%04X, error clear: 0x%04X",
                        updateBitsToSet, errorBitsToSet, errorBitsToClear);
@@ -60,7 +46,7 @@ void MB8ART::updateEventBits(EventBits_t updateBitsToSet,
 void MB8ART::clearUpdateEventBits(uint32_t bitsToClear) {
     if (xSensorEventGroup) {
         // Bits are already in interleaved positions
-        MB8ART_SRP_EVENT_GROUP_CLEAR_BITS(xSensorEventGroup, bitsToClear);
+        commitSensorEventBits(0, bitsToClear);
         LOG_MB8ART_DEBUG_NL("Cleared update bits: 0x%04X", bitsToClear);
     }
 }
@@ -71,7 +57,7 @@ void MB8ART::clearUpdateEventBits(uint32_t bitsToClear) {
 void MB8ART::clearErrorEventBits(uint32_t bitsToClear) {
     if (xSensorEventGroup) {
         // Bits are already in interleaved positions
-        MB8ART_SRP_EVENT_GROUP_CLEAR_BITS(xSensorEventGroup, bitsToClear);
+        commitSensorEventBits(0, bitsToClear);
         LOG_MB8ART_DEBUG_NL("Cleared error bits: 0x%04X", bitsToClear);
     }
 }
@@ -79,7 +65,7 @@ void MB8ART::clearErrorEventBits(uint32_t bitsToClear) {
 void MB8ART::setUpdateEventBits(uint32_t bitsToSet) {
     if (xSensorEventGroup) {
         // Bits are already in interleaved positions
-        MB8ART_SRP_EVENT_GROUP_SET_BITS(xSensorEventGroup, bitsToSet);
+        commitSensorEventBits(bitsToSet, 0);
         LOG_MB8ART_DEBUG_NL("Set update bits: 0x%04X", bitsToSet);
     }
 }
@@ -87,7 +73,7 @@ void MB8ART::setUpdateEventBits(uint32_t bitsToSet) {
 void MB8ART::setErrorEventBits(uint32_t bitsToSet) {
     if (xSensorEventGroup) {
         // Bits are already in interleaved positions
-        MB8ART_SRP_EVENT_GROUP_SET_BITS(xSensorEventGroup, bitsToSet);
+        commitSensorEventBits(bitsToSet, 0);
         LOG_MB8ART_DEBUG_NL("Set error bits: 0x%04X", bitsToSet);
     }
 }
@@ -110,17 +96,11 @@ void MB8ART::updateSensorEventBits(uint8_t sensorIndex, bool isValid, bool hasEr
     uint32_t updateBit = mb8art::SENSOR_UPDATE_BITS[sensorIndex];
     uint32_t errorBit = mb8art::SENSOR_ERROR_BITS[sensorIndex];
 
-    if (isValid) {
-        setUpdateEventBits(updateBit);
-        if (!hasError) {
-            clearErrorEventBits(errorBit);
-        }
-    } else {
-        clearUpdateEventBits(updateBit);
-    }
-
-    if (hasError) {
-        setErrorEventBits(errorBit);
+    // One commit instead of up to three wrapper calls
+    EventBits_t toSet = (isValid ? updateBit : 0) | (hasError ? errorBit : 0);
+    EventBits_t toClear = (isValid ? 0 : updateBit) | ((isValid && !hasError) ? errorBit : 0);
+    if (xSensorEventGroup) {
+        commitSensorEventBits(toSet, toClear);
     }
 }
 
@@ -132,25 +112,23 @@ void MB8ART::clearDataEventBits() {
     // ESP32 requires a spinlock for critical sections
     static portMUX_TYPE clearDataMutex = portMUX_INITIALIZER_UNLOCKED;
 
-    // Use critical section to prevent race conditions
-    taskENTER_CRITICAL(&clearDataMutex);
-
-    // Build interleaved mask from active channel mask
+    // Build interleaved mask from active channel mask under the lock only;
+    // the event-group calls below are kernel entries and run outside it
     // activeChannelMask uses simple bits (0-7), need to convert to interleaved format
+    taskENTER_CRITICAL(&clearDataMutex);
     uint32_t interleavedMask = 0;
     for (uint8_t i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
         if (activeChannelMask & (1 << i)) {
             interleavedMask |= mb8art::SENSOR_UPDATE_BITS[i] | mb8art::SENSOR_ERROR_BITS[i];
         }
     }
+    taskEXIT_CRITICAL(&clearDataMutex);
 
     // Clear all active channel bits from sensor event group
-    MB8ART_SRP_EVENT_GROUP_CLEAR_BITS(xSensorEventGroup, interleavedMask);
+    commitSensorEventBits(0, interleavedMask);
 
     // Clear task communication bits
-    MB8ART_SRP_EVENT_GROUP_CLEAR_BITS(xTaskEventGroup, DATA_READY_BIT | DATA_ERROR_BIT);
-
-    taskEXIT_CRITICAL(&clearDataMutex);
+    MB8ART_EVENT_GROUP_CLEAR_BITS_FAST(xTaskEventGroup, DATA_READY_BIT | DATA_ERROR_BIT);
 
     LOG_MB8ART_DEBUG_NL("Cleared event bits for active channels (mask: 0x%04X)", interleavedMask);
 }
@@ -0,0 +1,348 @@
+#ifndef MB8ART_EXPORT_H
+#define MB8ART_EXPORT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include "MB8ARTQuality.h"
+#include "MB8ARTMetrics.h"
+#include "MB8ARTChannelModes.h"
+
+/**
+ * @file MB8ARTExport.h
+ * @brief Compact readings + bus metrics export into a caller buffer
+ *
+ * Two encodings of the same ExportFrame, both heap-free and bounded by the
+ * caller's buffer:
+ *
+ * - CBOR (RFC 8949), integer keys, ~160 bytes for a full module - for an
+ *   MQTT bridge publishing every cycle
+ * - Prometheus text exposition, ~2 KB - for an HTTP /metrics page
+ *
+ * CBOR layout (map):
+ *   0: Modbus address          1: tag (text)           2: uptime ms
+ *   3: channels, array of 8: null (deactivated) or
+ *      [value, quality code, age ms, mode, divider]
+ *      value / divider = °C for THERMOCOUPLE/PT_INPUT, the engineering unit
+ *      for VOLTAGE/CURRENT (ExportChannel::divider)
+ *   4: metrics, array in BusMetrics field order (see encodeCbor)
+ *   5: online (bool)
+ *
+ * Both encoders return 0 if the frame does not fit; nothing partial is
+ * reported as success.
+ */
+
+namespace mb8art {
+
+struct ExportChannel {
+    int32_t value = 0;
+    int16_t divider = BINDING_TEMPERATURE_DIVIDER;  // value / divider = °C or engineering units
+    QualityCode code = QualityCode::BAD_NO_DATA;
+    uint32_t ageMs = 0;
+    uint8_t mode = 0;               // ChannelMode, 0 = deactivated
+};
+
+struct ExportFrame {
+    uint8_t address = 0;
+    const char* tag = "";
+    uint32_t uptimeMs = 0;
+    ExportChannel channels[8];
+    BusMetrics metrics;
+};
+
+/**
+ * @brief Minimal CBOR writer over a fixed buffer
+ */
+class CborWriter {
+public:
+    CborWriter(uint8_t* buffer, size_t size) : out(buffer), end(buffer + size), start(buffer), failed(false) {}
+
+    void uint(uint32_t value) { head(0, value); }
+    void sint(int32_t value) {
+        if (value >= 0) {
+            head(0, static_cast<uint32_t>(value));
+        } else {
+            head(1, static_cast<uint32_t>(-(value + 1)));
+        }
+    }
+    void text(const char* s) {
+        size_t length = strlen(s);
+        head(3, static_cast<uint32_t>(length));
+        bytes(reinterpret_cast<const uint8_t*>(s), length);
+    }
+    void array(uint32_t count) { head(4, count); }
+    void map(uint32_t count) { head(5, count); }
+    void boolean(bool value) { byte(value ? 0xF5 : 0xF4); }
+    void null() { byte(0xF6); }
+
+    // Bytes written, 0 after an overflow
+    size_t size() const { return failed ? 0 : static_cast<size_t>(out - start); }
+
+private:
+    void head(uint8_t major, uint32_t value) {
+        uint8_t type = static_cast<uint8_t>(major << 5);
+        if (value < 24) {
+            byte(type | static_cast<uint8_t>(value));
+        } else if (value <= 0xFF) {
+            byte(type | 24);
+            byte(static_cast<uint8_t>(value));
+        } else if (value <= 0xFFFF) {
+            byte(type | 25);
+            byte(static_cast<uint8_t>(value >> 8));
+            byte(static_cast<uint8_t>(value));
+        } else {
+            byte(type | 26);
+            for (int shift = 24; shift >= 0; shift -= 8) {
+                byte(static_cast<uint8_t>(value >> shift));
+            }
+        }
+    }
+    void byte(uint8_t b) {
+        if (out < end) {
+            *out++ = b;
+        } else {
+            failed = true;
+        }
+    }
+    void bytes(const uint8_t* data, size_t length) {
+        if (static_cast<size_t>(end - out) >= length) {
+            memcpy(out, data, length);
+            out += length;
+        } else {
+            failed = true;
+        }
+    }
+
+    uint8_t* out;
+    uint8_t* end;
+    uint8_t* start;
+    bool failed;
+};
+
+/**
+ * @brief Encode a frame as CBOR
+ * @return Bytes written, 0 if the buffer is too small
+ */
+inline size_t encodeCbor(const ExportFrame& frame, uint8_t* out, size_t size) {
+    CborWriter w(out, size);
+    w.map(6);
+    w.uint(0); w.uint(frame.address);
+    w.uint(1); w.text(frame.tag != nullptr ? frame.tag : "");
+    w.uint(2); w.uint(frame.uptimeMs);
+
+    w.uint(3);
+    w.array(8);
+    for (const ExportChannel& channel : frame.channels) {
+        if (channel.mode == 0) {
+            w.null();
+            continue;
+        }
+        w.array(5);
+        w.sint(channel.value);
+        w.uint(static_cast<uint8_t>(channel.code));
+        w.uint(channel.ageMs);
+        w.uint(channel.mode);
+        w.sint(channel.divider);
+    }
+
+    const BusMetrics& m = frame.metrics;
+    const uint32_t counters[] = {
+        m.framesOk, m.crcErrors, m.timeouts, m.exceptions, m.otherErrors,
+        m.dataTimeouts, m.retries, m.requestsQueued, m.requestsRejected,
+        m.inFlight, m.inFlightHighWater, m.cacheHits, m.cacheMisses,
+        m.onlineTransitions, m.offlineTransitions, m.consecutiveTimeouts,
+        m.rtt.count, m.rtt.p50Us, m.rtt.p90Us, m.rtt.p99Us, m.rtt.maxUs
+    };
+    w.uint(4);
+    w.array(sizeof(counters) / sizeof(counters[0]));
+    for (uint32_t value : counters) {
+        w.uint(value);
+    }
+
+    w.uint(5); w.boolean(m.online);
+    return w.size();
+}
+
+/**
+ * @brief snprintf-append into a fixed buffer
+ */
+class TextWriter {
+public:
+    TextWriter(char* buffer, size_t size)
+        : out(buffer), capacity(size), used(0), lineStart(0), failed(size == 0) {
+        if (size > 0) {
+            buffer[0] = '\0';
+        }
+    }
+
+#if defined(__GNUC__)
+    __attribute__((format(printf, 2, 3)))
+#endif
+    void print(const char* format, ...) {
+        if (failed) {
+            return;
+        }
+        va_list args;
+        va_start(args, format);
+        int written = vsnprintf(out + used, capacity - used, format, args);
+        va_end(args);
+        if (written < 0 || static_cast<size_t>(written) >= capacity - used) {
+            fail();
+            return;
+        }
+        used += static_cast<size_t>(written);
+        if (written > 0 && out[used - 1] == '\n') {
+            lineStart = used;
+        }
+    }
+
+    // Label value with \\, \" and \n escaped (exposition format)
+    void escaped(const char* s) {
+        for (; !failed && *s != '\0'; s++) {
+            if (*s == '\\' || *s == '"') {
+                put('\\');
+                put(*s);
+            } else if (*s == '\n') {
+                put('\\');
+                put('n');
+            } else {
+                put(*s);
+            }
+        }
+    }
+
+    // Length without the terminator, 0 after an overflow
+    size_t size() const { return failed ? 0 : used; }
+
+private:
+    void put(char c) {
+        if (failed) {
+            return;
+        }
+        if (used + 1 >= capacity) {
+            fail();
+            return;
+        }
+        out[used++] = c;
+        out[used] = '\0';
+    }
+    void fail() {
+        failed = true;
+        used = lineStart;
+        out[used] = '\0';  // Drop the partial line
+    }
+
+    char* out;
+    size_t capacity;
+    size_t used;
+    size_t lineStart;
+    bool failed;
+};
+
+/**
+ * @brief Format a frame as Prometheus text exposition
+ *
+ * Metric names are prefixed mb8art_ and labelled with the module address
+ * and tag (escaped). Each value is scaled by its channel's divider:
+ * temperatures in °C, analog channels in their engineering units. When
+ * several modules share a page, concatenate the outputs with
+ * includeTypes = false after the first.
+ *
+ * @return Length written (excluding the terminator), 0 if the buffer is too small
+ */
+inline size_t formatPrometheus(const ExportFrame& frame, char* out, size_t size, bool includeTypes = true) {
+    TextWriter w(out, size);
+    const char* tag = frame.tag != nullptr ? frame.tag : "";
+    const BusMetrics& m = frame.metrics;
+
+    // Writes `mb8art_<name>{address="..",tag=".."`; the caller closes the label set
+    auto begin = [&](const char* name) {
+        w.print("mb8art_%s{address=\"%u\",tag=\"", name, frame.address);
+        w.escaped(tag);
+        w.print("\"");
+    };
+    // Usable channel values of the given modes, scaled by each channel's divider
+    auto values = [&](const char* name, uint8_t modeA, uint8_t modeB) {
+        if (includeTypes) {
+            w.print("# TYPE mb8art_%s gauge\n", name);
+        }
+        for (uint8_t ch = 0; ch < 8; ch++) {
+            const ExportChannel& channel = frame.channels[ch];
+            if ((channel.mode == modeA || channel.mode == modeB) && isQualityUsable(channel.code)) {
+                char formatted[24];
+                formatFixedPoint(formatted, sizeof(formatted), channel.value, channel.divider);
+                begin(name);
+                w.print(",channel=\"%u\"} %s\n", ch, formatted);
+            }
+        }
+    };
+
+    values("temperature_celsius", static_cast<uint8_t>(ChannelMode::THERMOCOUPLE),
+           static_cast<uint8_t>(ChannelMode::PT_INPUT));
+    values("channel_value", static_cast<uint8_t>(ChannelMode::VOLTAGE),
+           static_cast<uint8_t>(ChannelMode::CURRENT));
+    if (includeTypes) {
+        w.print("# TYPE mb8art_channel_quality gauge\n");
+    }
+    for (uint8_t ch = 0; ch < 8; ch++) {
+        const ExportChannel& channel = frame.channels[ch];
+        if (channel.mode != 0) {
+            begin("channel_quality");
+            w.print(",channel=\"%u\"} %u\n", ch, static_cast<uint8_t>(channel.code));
+        }
+    }
+
+    static const struct {
+        const char* name;
+        bool counter;
+    } series[] = {
+        {"frames_ok_total", true}, {"crc_errors_total", true}, {"timeouts_total", true},
+        {"exceptions_total", true}, {"other_errors_total", true}, {"data_timeouts_total", true},
+        {"retries_total", true}, {"requests_queued_total", true}, {"requests_rejected_total", true},
+        {"requests_in_flight", false}, {"requests_in_flight_high_water", false},
+        {"status_cache_hits_total", true}, {"status_cache_misses_total", true},
+        {"online_transitions_total", true}, {"offline_transitions_total", true},
+        {"consecutive_timeouts", false}, {"online", false},
+    };
+    const uint32_t counters[] = {
+        m.framesOk, m.crcErrors, m.timeouts, m.exceptions, m.otherErrors, m.dataTimeouts,
+        m.retries, m.requestsQueued, m.requestsRejected, m.inFlight, m.inFlightHighWater,
+        m.cacheHits, m.cacheMisses, m.onlineTransitions, m.offlineTransitions,
+        m.consecutiveTimeouts, m.online ? 1u : 0u,
+    };
+    static_assert(sizeof(series) / sizeof(series[0]) == sizeof(counters) / sizeof(counters[0]),
+                  "Prometheus series out of sync");
+    for (size_t i = 0; i < sizeof(counters) / sizeof(counters[0]); i++) {
+        if (includeTypes) {
+            w.print("# TYPE mb8art_%s %s\n", series[i].name, series[i].counter ? "counter" : "gauge");
+        }
+        begin(series[i].name);
+        w.print("} %lu\n", static_cast<unsigned long>(counters[i]));
+    }
+
+    // Bucket-resolution percentiles of the request -> response latency (no
+    // running sum is kept, so this is a labelled gauge rather than a summary)
+    if (includeTypes) {
+        w.print("# TYPE mb8art_rtt_microseconds gauge\n");
+    }
+    const struct {
+        const char* quantile;
+        uint32_t value;
+    } rtt[] = {{"0.5", m.rtt.p50Us}, {"0.9", m.rtt.p90Us}, {"0.99", m.rtt.p99Us}, {"1", m.rtt.maxUs}};
+    for (const auto& q : rtt) {
+        begin("rtt_microseconds");
+        w.print(",quantile=\"%s\"} %lu\n", q.quantile, static_cast<unsigned long>(q.value));
+    }
+    if (includeTypes) {
+        w.print("# TYPE mb8art_rtt_samples_total counter\n");
+    }
+    begin("rtt_samples_total");
+    w.print("} %lu\n", static_cast<unsigned long>(m.rtt.count));
+    return w.size();
+}
+
+} // namespace mb8art
+
+#endif // MB8ART_EXPORT_H
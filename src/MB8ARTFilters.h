@@ -0,0 +1,279 @@
+#ifndef MB8ART_FILTERS_H
+#define MB8ART_FILTERS_H
+
+#include <stdint.h>
+
+/**
+ * @file MB8ARTFilters.h
+ * @brief Fixed-point per-channel filter chain for MB8ART readings
+ *
+ * Each channel owns one ChannelFilter (static storage inside the MB8ART
+ * instance, no heap). The chain is:
+ *
+ *   raw -> [median 3/5] -> [EMA | Kalman] -> filtered
+ *
+ * The median stage removes single-sample spikes, the smoothing stage
+ * removes noise. All arithmetic is integer; values are in the channel's
+ * native fixed-point unit (tenths/hundredths °C, see getDataScaleDivider).
+ *
+ * A SpikeRejector runs before the chain and drops implausible samples
+ * (slew-rate limit, confirm-on-next-frame for large jumps) so they never
+ * reach the filter or the stored reading. The channel is held as
+ * UNCERTAIN_REJECTED instead; its update bit is still set, since the frame
+ * arrived.
+ */
+
+namespace mb8art {
+
+enum class MedianWindow : uint8_t {
+    NONE = 0,
+    MEDIAN_3 = 3,
+    MEDIAN_5 = 5
+};
+
+enum class SmoothingFilter : uint8_t {
+    NONE = 0,
+    EMA = 1,     // Exponential moving average
+    KALMAN = 2   // 1-D random-walk Kalman filter
+};
+
+struct FilterConfig {
+    MedianWindow median = MedianWindow::NONE;
+    SmoothingFilter smoothing = SmoothingFilter::NONE;
+    uint8_t emaAlphaQ8 = 64;     // EMA weight of new sample, alpha = value/256 (1-255)
+    uint16_t kalmanQ = 4;        // Process noise variance (counts²)
+    uint16_t kalmanR = 100;      // Measurement noise variance (counts²)
+
+    bool isEnabled() const {
+        return median != MedianWindow::NONE || smoothing != SmoothingFilter::NONE;
+    }
+
+    bool isValid() const {
+        if (median != MedianWindow::NONE && median != MedianWindow::MEDIAN_3 &&
+            median != MedianWindow::MEDIAN_5) {
+            return false;
+        }
+        switch (smoothing) {
+            case SmoothingFilter::NONE:   return true;
+            case SmoothingFilter::EMA:    return emaAlphaQ8 != 0;
+            case SmoothingFilter::KALMAN: return kalmanR != 0;
+            default:                      return false;
+        }
+    }
+};
+
+/**
+ * @brief Filter state for one channel (~28 bytes)
+ *
+ * Not thread-safe by itself - MB8ART serializes configure()/apply().
+ */
+class ChannelFilter {
+public:
+    void configure(const FilterConfig& newConfig) {
+        config = newConfig;
+        reset();
+    }
+
+    const FilterConfig& getConfig() const { return config; }
+
+    void reset() {
+        medianCount = 0;
+        medianHead = 0;
+        primed = false;
+        stateQ8 = 0;
+        covarianceQ8 = 0;
+    }
+
+    /**
+     * @brief Feed one sample and return the filtered value
+     * @param value Sample in native fixed-point units
+     */
+    int16_t apply(int16_t value) {
+        if (!config.isEnabled()) {
+            return value;
+        }
+
+        int16_t x = applyMedian(value);
+
+        switch (config.smoothing) {
+            case SmoothingFilter::EMA:    return applyEma(x);
+            case SmoothingFilter::KALMAN: return applyKalman(x);
+            default:                      return x;
+        }
+    }
+
+private:
+    static int16_t roundQ8(int32_t q8) {
+        // Symmetric rounding, Q8 -> integer
+        int32_t v = (q8 >= 0) ? (q8 + 128) >> 8 : -((-q8 + 128) >> 8);
+        if (v > INT16_MAX) return INT16_MAX;
+        if (v < INT16_MIN) return INT16_MIN;
+        return static_cast<int16_t>(v);
+    }
+
+    static int16_t median3(int16_t a, int16_t b, int16_t c) {
+        if (a > b) { int16_t t = a; a = b; b = t; }
+        if (b > c) { b = c; }
+        return (a > b) ? a : b;
+    }
+
+    int16_t applyMedian(int16_t value) {
+        uint8_t window = static_cast<uint8_t>(config.median);
+        if (window == 0) {
+            return value;
+        }
+
+        medianBuffer[medianHead] = value;
+        medianHead = (medianHead + 1 < window) ? medianHead + 1 : 0;
+        if (medianCount < window) {
+            medianCount++;
+        }
+
+        if (medianCount == 3 && window == 3) {
+            return median3(medianBuffer[0], medianBuffer[1], medianBuffer[2]);
+        }
+
+        // General case (median of 5, or a window still filling):
+        // insertion sort on a copy, at most 10 compares
+        int16_t sorted[5];
+        for (uint8_t i = 0; i < medianCount; i++) {
+            int16_t v = medianBuffer[i];
+            uint8_t j = i;
+            while (j > 0 && sorted[j - 1] > v) {
+                sorted[j] = sorted[j - 1];
+                j--;
+            }
+            sorted[j] = v;
+        }
+        return sorted[medianCount / 2];
+    }
+
+    int16_t applyEma(int16_t value) {
+        int32_t xQ8 = static_cast<int32_t>(value) * 256;
+        if (!primed) {
+            stateQ8 = xQ8;
+            primed = true;
+        } else {
+            stateQ8 += (static_cast<int32_t>(config.emaAlphaQ8) * (xQ8 - stateQ8)) / 256;
+        }
+        return roundQ8(stateQ8);
+    }
+
+    int16_t applyKalman(int16_t value) {
+        int32_t zQ8 = static_cast<int32_t>(value) * 256;
+        if (!primed) {
+            stateQ8 = zQ8;
+            covarianceQ8 = static_cast<int32_t>(config.kalmanR) * 256;
+            primed = true;
+            return value;
+        }
+
+        // Predict: P += Q
+        int32_t p = covarianceQ8 + static_cast<int32_t>(config.kalmanQ) * 256;
+        // Gain: K = P / (P + R), Q16
+        int32_t r = static_cast<int32_t>(config.kalmanR) * 256;
+        int32_t gainQ16 = static_cast<int32_t>((static_cast<int64_t>(p) << 16) / (p + r));
+        // Update: x += K (z - x), P = (1 - K) P
+        stateQ8 += static_cast<int32_t>((static_cast<int64_t>(gainQ16) * (zQ8 - stateQ8)) >> 16);
+        covarianceQ8 = static_cast<int32_t>((static_cast<int64_t>(65536 - gainQ16) * p) >> 16);
+
+        return roundQ8(stateQ8);
+    }
+
+    FilterConfig config;
+    int32_t stateQ8 = 0;        // EMA / Kalman estimate (Q24.8)
+    int32_t covarianceQ8 = 0;   // Kalman error covariance (Q24.8)
+    int16_t medianBuffer[5] = {};
+    uint8_t medianCount = 0;
+    uint8_t medianHead = 0;
+    bool primed = false;
+};
+
+struct RejectionConfig {
+    uint16_t maxSlewPerSecond = 0;  // Max plausible change in counts/s (0 = disabled)
+    uint16_t jumpThreshold = 0;     // Jumps above this need a confirming frame (0 = disabled)
+
+    bool isEnabled() const { return maxSlewPerSecond != 0 || jumpThreshold != 0; }
+};
+
+enum class RejectReason : uint8_t {
+    NONE = 0,         // Sample accepted
+    SLEW_RATE = 1,    // Changed faster than maxSlewPerSecond
+    UNCONFIRMED = 2   // Large jump, held until the next frame confirms it
+};
+
+/**
+ * @brief Outlier rejection for one channel (~12 bytes)
+ *
+ * Compares each sample against the last accepted one. Slew-rate rejects
+ * recover naturally: the allowed delta grows with the time since the last
+ * accepted sample. A jump is confirmed when the next frame lands within half
+ * the jump of the held candidate - a real step change passes one frame late,
+ * a single glitched frame never passes.
+ */
+class SpikeRejector {
+public:
+    void configure(const RejectionConfig& newConfig) {
+        config = newConfig;
+        reset();
+    }
+
+    const RejectionConfig& getConfig() const { return config; }
+
+    void reset() {
+        primed = false;
+        pendingValid = false;
+    }
+
+    /**
+     * @param value Sample in native fixed-point units
+     * @param elapsedMs Time since the last accepted sample
+     */
+    RejectReason check(int16_t value, uint32_t elapsedMs) {
+        if (!config.isEnabled() || !primed) {
+            accept(value);
+            return RejectReason::NONE;
+        }
+
+        int32_t delta = static_cast<int32_t>(value) - lastAccepted;
+        if (delta < 0) delta = -delta;
+
+        if (config.maxSlewPerSecond != 0) {
+            int64_t allowed = (static_cast<int64_t>(config.maxSlewPerSecond) * elapsedMs) / 1000;
+            if (delta > allowed) {
+                pendingValid = false;
+                return RejectReason::SLEW_RATE;
+            }
+        }
+
+        if (config.jumpThreshold != 0 && delta > config.jumpThreshold) {
+            int32_t fromPending = static_cast<int32_t>(value) - pending;
+            if (fromPending < 0) fromPending = -fromPending;
+            if (!pendingValid || fromPending > delta / 2) {
+                pending = value;
+                pendingValid = true;
+                return RejectReason::UNCONFIRMED;
+            }
+        }
+
+        accept(value);
+        return RejectReason::NONE;
+    }
+
+private:
+    void accept(int16_t value) {
+        lastAccepted = value;
+        primed = true;
+        pendingValid = false;
+    }
+
+    RejectionConfig config;
+    int16_t lastAccepted = 0;
+    int16_t pending = 0;
+    bool primed = false;
+    bool pendingValid = false;
+};
+
+} // namespace mb8art
+
+#endif // MB8ART_FILTERS_H
@@ -0,0 +1,424 @@
+#ifndef MB8ART_HISTORY_H
+#define MB8ART_HISTORY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <atomic>
+#include "MB8ARTQuality.h"
+
+/**
+ * @file MB8ARTHistory.h
+ * @brief Compressed in-RAM history of 8-channel readings
+ *
+ * Storage is split into fixed-size blocks used as a ring; the oldest block
+ * is recycled when the ring is full. Each block starts with a keyframe so it
+ * decodes on its own:
+ *
+ *   keyframe:  tick (u32 LE) | valid mask (u8) | 8 × value (i16 LE)
+ *              | 8 × quality code (u8)                                  29 bytes
+ *   frame:     varint(tickDelta << 2 | qualityChanged << 1 | maskChanged)
+ *              [| mask] [| changed-quality mask | code per changed channel]
+ *              then varint(zigzag(value - previous)) per valid channel
+ *
+ * Slowly changing temperatures encode to ~1 byte per channel-sample plus
+ * 1-2 bytes of tick per frame; quality codes cost nothing while they hold.
+ *
+ * Single writer (the MB8ART processing task). Readers need no lock: every
+ * block carries a sequence number, and a reader drops any frame whose block
+ * was recycled while it was being decoded.
+ *
+ * @code
+ * static mb8art::StaticHistory<64> history;   // 64 × 256 B = 16 KB
+ * mb8art->attachHistory(&history);
+ * ...
+ * mb8art::HistoryFrame frame;
+ * auto reader = history.reader();
+ * while (reader.next(frame)) { ... }
+ * @endcode
+ */
+
+namespace mb8art {
+
+struct HistoryFrame {
+    uint32_t tick;        // xTaskGetTickCount() when the frame was decoded
+    uint8_t validMask;    // Bit n set = values[n] is a valid reading
+    int16_t values[8];    // Native fixed-point units, as in SensorReading
+    QualityCode quality[8];
+};
+
+class HistoryBuffer {
+public:
+    static constexpr uint8_t CHANNELS = 8;
+    static constexpr uint16_t KEYFRAME_SIZE = 4 + 1 + CHANNELS * 2 + CHANNELS;
+    static constexpr uint16_t MAX_FRAME_SIZE = 5 + 1 + 1 + CHANNELS + CHANNELS * 3;
+
+    struct BlockInfo {
+        std::atomic<uint32_t> sequence{0};  // 0 = empty / being rewritten
+        std::atomic<uint16_t> used{0};      // Bytes of complete frames
+        std::atomic<uint16_t> frames{0};
+    };
+
+    class Reader {
+    public:
+        /**
+         * @brief Decode the next frame, oldest first
+         * @return false when no further complete frame is available
+         */
+        bool next(HistoryFrame& out) {
+            while (true) {
+                if (!inBlock && !enterNextBlock()) {
+                    return false;
+                }
+
+                const BlockInfo& info = owner->blocks[block];
+                uint16_t used = info.used.load(std::memory_order_acquire);
+                if (offset >= used) {
+                    // Current block exhausted - continue only if a newer one exists
+                    inBlock = false;
+                    continue;
+                }
+
+                HistoryFrame frame = state;
+                uint16_t nextOffset = offset;
+                if (!owner->decodeFrame(block, nextOffset, used, frame)) {
+                    inBlock = false;
+                    continue;
+                }
+
+                // Block recycled under us - the bytes just read are not trustworthy
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (info.sequence.load(std::memory_order_acquire) != sequence) {
+                    inBlock = false;
+                    continue;
+                }
+
+                state = frame;
+                offset = nextOffset;
+                out = frame;
+                return true;
+            }
+        }
+
+    private:
+        friend class HistoryBuffer;
+        explicit Reader(const HistoryBuffer* buffer) : owner(buffer) {
+            memset(&state, 0, sizeof(state));
+        }
+
+        bool enterNextBlock() {
+            uint16_t candidate;
+            uint32_t candidateSequence;
+            if (!started) {
+                candidate = owner->oldestBlock.load(std::memory_order_acquire);
+                candidateSequence = owner->blocks[candidate].sequence.load(std::memory_order_acquire);
+                if (candidateSequence == 0) {
+                    return false;
+                }
+                started = true;
+            } else {
+                candidate = (block + 1 < owner->blockCount) ? block + 1 : 0;
+                candidateSequence = owner->blocks[candidate].sequence.load(std::memory_order_acquire);
+                // Only move forward in time; a gap means the writer lapped us
+                if (candidateSequence == 0 || candidateSequence <= sequence) {
+                    return false;
+                }
+            }
+            block = candidate;
+            sequence = candidateSequence;
+            offset = 0;
+            inBlock = true;
+            return true;
+        }
+
+        const HistoryBuffer* owner;
+        HistoryFrame state;
+        uint32_t sequence = 0;
+        uint16_t block = 0;
+        uint16_t offset = 0;
+        bool started = false;
+        bool inBlock = false;
+    };
+
+    HistoryBuffer(uint8_t* storage, BlockInfo* blockInfo, uint16_t numBlocks, uint16_t bytesPerBlock)
+        : data(storage), blocks(blockInfo), blockCount(numBlocks), blockSize(bytesPerBlock) {
+        // BlockInfo entries start zeroed (empty); nothing to touch here so
+        // StaticHistory can pass storage that is not constructed yet
+    }
+
+    HistoryBuffer(const HistoryBuffer&) = delete;
+    HistoryBuffer& operator=(const HistoryBuffer&) = delete;
+
+    void clear() {
+        for (uint16_t i = 0; i < blockCount; i++) {
+            blocks[i].sequence.store(0, std::memory_order_relaxed);
+            blocks[i].used.store(0, std::memory_order_relaxed);
+            blocks[i].frames.store(0, std::memory_order_relaxed);
+        }
+        writeBlock = 0;
+        nextSequence = 1;
+        lastTick = 0;
+        lastMask = 0;
+        memset(lastValues, 0, sizeof(lastValues));
+        totalFrames = 0;
+        totalBytes = 0;
+        oldestBlock.store(0, std::memory_order_release);
+    }
+
+    /**
+     * @brief Append one frame (called once per decoded temperature response)
+     * @param values CHANNELS values; entries outside validMask are ignored
+     * @param quality Optional CHANNELS quality codes, nullptr records GOOD
+     */
+    void append(uint32_t tick, uint8_t validMask, const int16_t* values,
+                const QualityCode* quality = nullptr) {
+        BlockInfo& info = blocks[writeBlock];
+        uint16_t used = info.used.load(std::memory_order_relaxed);
+        uint32_t tickDelta = tick - lastTick;
+
+        if (info.sequence.load(std::memory_order_relaxed) == 0 ||
+            used + MAX_FRAME_SIZE > blockSize || tickDelta > 0x3FFFFFFFu) {
+            startBlock(tick, validMask, values, quality);
+            return;
+        }
+
+        uint8_t* out = data + static_cast<size_t>(writeBlock) * blockSize + used;
+        uint8_t* p = out;
+        bool maskChanged = (validMask != lastMask);
+        uint8_t qualityMask = 0;
+        for (uint8_t ch = 0; ch < CHANNELS; ch++) {
+            if (codeAt(quality, ch) != lastQuality[ch]) {
+                qualityMask |= static_cast<uint8_t>(1u << ch);
+            }
+        }
+        p = writeVarint(p, (tickDelta << 2) | (qualityMask != 0 ? 2u : 0u) | (maskChanged ? 1u : 0u));
+        if (maskChanged) {
+            *p++ = validMask;
+        }
+        if (qualityMask != 0) {
+            *p++ = qualityMask;
+            for (uint8_t ch = 0; ch < CHANNELS; ch++) {
+                if (qualityMask & (1u << ch)) {
+                    lastQuality[ch] = codeAt(quality, ch);
+                    *p++ = static_cast<uint8_t>(lastQuality[ch]);
+                }
+            }
+        }
+        for (uint8_t ch = 0; ch < CHANNELS; ch++) {
+            if (validMask & (1u << ch)) {
+                int32_t delta = static_cast<int32_t>(values[ch]) - lastValues[ch];
+                p = writeVarint(p, zigzag(delta));
+                lastValues[ch] = values[ch];
+            }
+        }
+
+        lastTick = tick;
+        lastMask = validMask;
+        uint16_t written = static_cast<uint16_t>(p - out);
+        totalFrames++;
+        totalBytes += written;
+        info.frames.store(info.frames.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        info.used.store(used + written, std::memory_order_release);  // Publish the frame
+    }
+
+    Reader reader() const { return Reader(this); }
+
+    uint32_t getTotalFrames() const { return totalFrames; }
+    uint32_t getTotalEncodedBytes() const { return totalBytes; }
+    size_t getCapacityBytes() const { return static_cast<size_t>(blockCount) * blockSize; }
+
+    /**
+     * @brief Frames currently retained (oldest blocks may have been recycled)
+     */
+    uint32_t getStoredFrames() const {
+        uint32_t frames = 0;
+        for (uint16_t i = 0; i < blockCount; i++) {
+            if (blocks[i].sequence.load(std::memory_order_acquire) != 0) {
+                frames += blocks[i].frames.load(std::memory_order_relaxed);
+            }
+        }
+        return frames;
+    }
+
+private:
+    static QualityCode codeAt(const QualityCode* quality, uint8_t ch) {
+        return (quality != nullptr) ? quality[ch] : QualityCode::GOOD;
+    }
+
+    static uint32_t zigzag(int32_t v) {
+        return (static_cast<uint32_t>(v) << 1) ^ static_cast<uint32_t>(v >> 31);
+    }
+
+    static int32_t unzigzag(uint32_t v) {
+        return static_cast<int32_t>(v >> 1) ^ -static_cast<int32_t>(v & 1);
+    }
+
+    static uint8_t* writeVarint(uint8_t* p, uint32_t v) {
+        while (v >= 0x80) {
+            *p++ = static_cast<uint8_t>(v | 0x80);
+            v >>= 7;
+        }
+        *p++ = static_cast<uint8_t>(v);
+        return p;
+    }
+
+    static bool readVarint(const uint8_t* base, uint16_t& offset, uint16_t limit, uint32_t& v) {
+        v = 0;
+        for (uint8_t shift = 0; shift < 35; shift += 7) {
+            if (offset >= limit) {
+                return false;
+            }
+            uint8_t byte = base[offset++];
+            v |= static_cast<uint32_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void startBlock(uint32_t tick, uint8_t validMask, const int16_t* values,
+                    const QualityCode* quality) {
+        // Move to the next block unless the current one is still empty
+        if (blocks[writeBlock].sequence.load(std::memory_order_relaxed) != 0) {
+            writeBlock = (writeBlock + 1 < blockCount) ? writeBlock + 1 : 0;
+        }
+
+        BlockInfo& info = blocks[writeBlock];
+        bool recycling = info.sequence.load(std::memory_order_relaxed) != 0;
+
+        // Invalidate before overwriting so concurrent readers drop the block
+        info.sequence.store(0, std::memory_order_relaxed);
+        info.used.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        if (recycling) {
+            uint16_t oldest = (writeBlock + 1 < blockCount) ? writeBlock + 1 : 0;
+            oldestBlock.store(oldest, std::memory_order_release);
+        }
+
+        // Keyframe: invalid channels keep their last known value so deltas
+        // stay small when they come back
+        for (uint8_t ch = 0; ch < CHANNELS; ch++) {
+            if (validMask & (1u << ch)) {
+                lastValues[ch] = values[ch];
+            }
+        }
+        uint8_t* p = data + static_cast<size_t>(writeBlock) * blockSize;
+        p[0] = static_cast<uint8_t>(tick);
+        p[1] = static_cast<uint8_t>(tick >> 8);
+        p[2] = static_cast<uint8_t>(tick >> 16);
+        p[3] = static_cast<uint8_t>(tick >> 24);
+        p[4] = validMask;
+        for (uint8_t ch = 0; ch < CHANNELS; ch++) {
+            uint16_t v = static_cast<uint16_t>(lastValues[ch]);
+            p[5 + ch * 2] = static_cast<uint8_t>(v);
+            p[6 + ch * 2] = static_cast<uint8_t>(v >> 8);
+            lastQuality[ch] = codeAt(quality, ch);
+            p[5 + CHANNELS * 2 + ch] = static_cast<uint8_t>(lastQuality[ch]);
+        }
+
+        lastTick = tick;
+        lastMask = validMask;
+        totalFrames++;
+        totalBytes += KEYFRAME_SIZE;
+        info.frames.store(1, std::memory_order_relaxed);
+        info.used.store(KEYFRAME_SIZE, std::memory_order_release);
+        info.sequence.store(nextSequence++, std::memory_order_release);
+    }
+
+    bool decodeFrame(uint16_t block, uint16_t& offset, uint16_t used, HistoryFrame& frame) const {
+        const uint8_t* base = data + static_cast<size_t>(block) * blockSize;
+
+        if (offset == 0) {
+            if (used < KEYFRAME_SIZE) {
+                return false;
+            }
+            frame.tick = static_cast<uint32_t>(base[0]) |
+                         (static_cast<uint32_t>(base[1]) << 8) |
+                         (static_cast<uint32_t>(base[2]) << 16) |
+                         (static_cast<uint32_t>(base[3]) << 24);
+            frame.validMask = base[4];
+            for (uint8_t ch = 0; ch < CHANNELS; ch++) {
+                frame.values[ch] = static_cast<int16_t>(base[5 + ch * 2] |
+                                                        (base[6 + ch * 2] << 8));
+                frame.quality[ch] = static_cast<QualityCode>(base[5 + CHANNELS * 2 + ch]);
+            }
+            offset = KEYFRAME_SIZE;
+            return true;
+        }
+
+        uint32_t header;
+        if (!readVarint(base, offset, used, header)) {
+            return false;
+        }
+        frame.tick += header >> 2;
+        if (header & 1) {
+            if (offset >= used) {
+                return false;
+            }
+            frame.validMask = base[offset++];
+        }
+        if (header & 2) {
+            if (offset >= used) {
+                return false;
+            }
+            uint8_t qualityMask = base[offset++];
+            for (uint8_t ch = 0; ch < CHANNELS; ch++) {
+                if (qualityMask & (1u << ch)) {
+                    if (offset >= used) {
+                        return false;
+                    }
+                    frame.quality[ch] = static_cast<QualityCode>(base[offset++]);
+                }
+            }
+        }
+        for (uint8_t ch = 0; ch < CHANNELS; ch++) {
+            if (frame.validMask & (1u << ch)) {
+                uint32_t encoded;
+                if (!readVarint(base, offset, used, encoded)) {
+                    return false;
+                }
+                frame.values[ch] = static_cast<int16_t>(frame.values[ch] + unzigzag(encoded));
+            }
+        }
+        return true;
+    }
+
+    uint8_t* data;
+    BlockInfo* blocks;
+    uint16_t blockCount;
+    uint16_t blockSize;
+
+    // Writer state
+    uint16_t writeBlock = 0;
+    uint32_t nextSequence = 1;
+    uint32_t lastTick = 0;
+    uint8_t lastMask = 0;
+    int16_t lastValues[CHANNELS] = {};
+    QualityCode lastQuality[CHANNELS] = {};
+    uint32_t totalFrames = 0;
+    uint32_t totalBytes = 0;
+    std::atomic<uint16_t> oldestBlock{0};
+};
+
+/**
+ * @brief History with inline storage - declare static or global, no heap
+ * @tparam Blocks Number of blocks in the ring (recycled one at a time)
+ * @tparam BlockSize Bytes per block; larger blocks amortize the keyframe
+ */
+template <uint16_t Blocks, uint16_t BlockSize = 256>
+class StaticHistory : public HistoryBuffer {
+    static_assert(Blocks >= 2, "StaticHistory needs at least 2 blocks");
+    static_assert(BlockSize >= HistoryBuffer::KEYFRAME_SIZE + HistoryBuffer::MAX_FRAME_SIZE,
+                  "StaticHistory block too small");
+public:
+    StaticHistory() : HistoryBuffer(storage, blockInfo, Blocks, BlockSize) {}
+
+private:
+    uint8_t storage[static_cast<size_t>(Blocks) * BlockSize];
+    HistoryBuffer::BlockInfo blockInfo[Blocks];
+};
+
+} // namespace mb8art
+
+#endif // MB8ART_HISTORY_H
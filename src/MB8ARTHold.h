@@ -0,0 +1,158 @@
+#ifndef MB8ART_HOLD_H
+#define MB8ART_HOLD_H
+
+#include <stdint.h>
+#include "MB8ARTQuality.h"
+
+/**
+ * @file MB8ARTHold.h
+ * @brief Last-good-value hold with age-graded quality during outages
+ *
+ * Without a hold policy a channel error or bus timeout invalidates the bound
+ * value immediately. With one, the last good value is kept and its quality
+ * degrades with age:
+ *
+ *   age < uncertainAfterMs  -> GOOD
+ *   age < badAfterMs        -> UNCERTAIN
+ *   otherwise               -> BAD (bindings are invalidated)
+ *
+ * Optionally the held value follows the recent slope for at most
+ * extrapolateMs, then stays flat until it turns BAD.
+ *
+ * Values are in binding units (tenths of °C, or the engineering value for
+ * mapped analog channels), i.e. exactly what bound pointers receive - full
+ * int32_t, like AnalogValue, so a mapped value is never clipped.
+ */
+
+namespace mb8art {
+
+struct HoldPolicy {
+    uint32_t uncertainAfterMs = 0;  // Age at which a held value becomes UNCERTAIN
+    uint32_t badAfterMs = 0;        // Age at which it becomes BAD, 0 disables the hold
+    uint32_t extrapolateMs = 0;     // Follow the recent slope for at most this long, 0 = flat hold
+
+    bool isEnabled() const { return badAfterMs != 0; }
+};
+
+/**
+ * @brief Per-channel state published by the decode path on every frame
+ */
+struct ChannelSnapshot {
+    int32_t value = 0;          // Last good value (binding units)
+    int32_t slopePerMin = 0;    // Smoothed slope, binding units per minute
+    uint32_t sampleMs = 0;      // Time of the last good sample
+    HoldPolicy policy;
+    QualityCode code = QualityCode::BAD_NO_DATA;  // Status of the most recent frame
+    bool hasSample = false;     // At least one good sample since reset
+    bool current = false;       // The most recent frame produced that sample
+};
+
+/**
+ * @brief What a consumer should use right now
+ */
+struct HeldReading {
+    int32_t value = 0;
+    ReadingQuality quality = ReadingQuality::BAD;
+    QualityCode code = QualityCode::BAD_NO_DATA;
+    bool held = false;          // Value is older than the latest frame / poll interval
+    bool extrapolated = false;  // value includes a slope projection
+    uint32_t ageMs = 0;         // Time since the last good sample
+};
+
+/**
+ * @brief Fold a good sample into the snapshot (writer side)
+ */
+inline void recordGoodSample(ChannelSnapshot& snapshot, int32_t value, QualityCode code,
+                             uint32_t nowMs) {
+    if (snapshot.hasSample) {
+        uint32_t dt = nowMs - snapshot.sampleMs;
+        // Only estimate the slope across regular polling, not across an outage
+        bool contiguous = snapshot.current && dt != 0 &&
+                          (!snapshot.policy.isEnabled() || dt < snapshot.policy.badAfterMs);
+        if (contiguous) {
+            // 64-bit: a full-range delta × 60000 does not fit int32_t
+            int64_t instant = (static_cast<int64_t>(value) - snapshot.value) * 60000 /
+                              static_cast<int64_t>(dt);
+            int64_t slope = snapshot.slopePerMin + (instant - snapshot.slopePerMin) / 4;
+            snapshot.slopePerMin = static_cast<int32_t>(slope > INT32_MAX ? INT32_MAX :
+                                                        (slope < INT32_MIN ? INT32_MIN : slope));
+        } else {
+            snapshot.slopePerMin = 0;
+        }
+    }
+    snapshot.value = value;
+    snapshot.sampleMs = nowMs;
+    snapshot.code = code;
+    snapshot.hasSample = true;
+    snapshot.current = true;
+}
+
+/**
+ * @brief Record that the latest frame produced no usable sample (writer side)
+ * @return true if the snapshot changed
+ */
+inline bool recordMissedSample(ChannelSnapshot& snapshot, QualityCode code) {
+    if (!snapshot.current && snapshot.code == code) {
+        return false;
+    }
+    snapshot.current = false;
+    snapshot.code = code;
+    return true;
+}
+
+/**
+ * @brief Grade a snapshot at nowMs (reader side, pure)
+ */
+inline HeldReading evaluateHold(const ChannelSnapshot& snapshot, uint32_t nowMs) {
+    HeldReading reading;
+    reading.code = snapshot.code;
+    reading.quality = qualitySeverity(snapshot.code);
+    if (!snapshot.hasSample) {
+        reading.quality = ReadingQuality::BAD;
+        return reading;
+    }
+
+    const HoldPolicy& policy = snapshot.policy;
+    reading.value = snapshot.value;
+    reading.ageMs = nowMs - snapshot.sampleMs;
+    reading.held = !snapshot.current;
+
+    // No hold, or a channel that was switched off: the latest frame's status stands
+    if (!policy.isEnabled() || snapshot.code == QualityCode::BAD_DEACTIVATED) {
+        return reading;
+    }
+
+    reading.held = reading.held || reading.ageMs >= policy.uncertainAfterMs;
+    if (reading.ageMs >= policy.badAfterMs) {
+        reading.quality = ReadingQuality::BAD;
+        // Keep the fault reason if there is one, otherwise the value simply aged out
+        reading.code = (qualitySeverity(snapshot.code) == ReadingQuality::BAD)
+                       ? snapshot.code : QualityCode::BAD_TIMEOUT;
+        return reading;
+    }
+    if (!reading.held) {
+        reading.quality = ReadingQuality::GOOD;
+        return reading;
+    }
+    if (reading.ageMs < policy.uncertainAfterMs) {
+        reading.quality = ReadingQuality::GOOD;
+        reading.code = QualityCode::GOOD_HELD;
+        return reading;
+    }
+    reading.quality = ReadingQuality::UNCERTAIN;
+    reading.code = QualityCode::UNCERTAIN_HELD;
+
+    if (policy.extrapolateMs != 0 && snapshot.slopePerMin != 0) {
+        uint32_t span = (reading.ageMs < policy.extrapolateMs) ? reading.ageMs : policy.extrapolateMs;
+        int64_t projected = snapshot.value + static_cast<int64_t>(snapshot.slopePerMin) * span / 60000;
+        reading.value = static_cast<int32_t>(projected > INT32_MAX ? INT32_MAX :
+                                             (projected < INT32_MIN ? INT32_MIN : projected));
+        reading.extrapolated = true;
+        reading.code = QualityCode::UNCERTAIN_EXTRAPOLATED;
+    }
+    return reading;
+}
+
+} // namespace mb8art
+
+#endif // MB8ART_HOLD_H
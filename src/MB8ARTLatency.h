@@ -0,0 +1,160 @@
+#ifndef MB8ART_LATENCY_H
+#define MB8ART_LATENCY_H
+
+#include <stdint.h>
+#include <atomic>
+
+/**
+ * @file MB8ARTLatency.h
+ * @brief Log-bucketed latency histograms with lock-free readout
+ *
+ * Durations are recorded in microseconds. Each power of two is split into
+ * four buckets, so a bucket is at most 25 % wide relative to its lower
+ * bound; 0..3 us get exact buckets and everything from ~14.7 s up shares
+ * the last one. 92 buckets, 376 bytes per histogram.
+ *
+ * Recording is two relaxed atomic increments plus a max update; readers
+ * take relaxed loads and may see a sample counted in one field but not yet
+ * another - fine for percentiles over thousands of frames.
+ */
+
+namespace mb8art {
+
+/**
+ * @brief Phases of a temperature read
+ *
+ * Bus start is not observable from the driver (QueuedModbusDevice sends
+ * from its own queue), so queueing delay and wire time are one phase.
+ */
+enum class LatencyStage : uint8_t {
+    REQUEST_TO_RESPONSE = 0,  // Request enqueued -> response handed to the driver
+    DECODE,                   // Response received -> values, bindings and events published
+    END_TO_END,               // Request enqueued -> decode complete
+    COUNT
+};
+
+/**
+ * @brief Percentiles in microseconds (bucket upper bounds, max is exact)
+ */
+struct LatencySummary {
+    uint32_t count = 0;
+    uint32_t p50Us = 0;
+    uint32_t p90Us = 0;
+    uint32_t p99Us = 0;
+    uint32_t maxUs = 0;
+};
+
+class LatencyHistogram {
+public:
+    static constexpr uint8_t SUB_BUCKET_BITS = 2;
+    static constexpr uint8_t MAX_EXPONENT = 24;  // Values >= 2^24 us share the top bucket
+    static constexpr uint8_t BUCKETS = (MAX_EXPONENT - 1) * (1 << SUB_BUCKET_BITS);
+
+    constexpr LatencyHistogram() : buckets(), total(0), maximum(0) {}
+
+    void record(uint32_t us) {
+        buckets[bucketFor(us)].fetch_add(1, std::memory_order_relaxed);
+        total.fetch_add(1, std::memory_order_relaxed);
+        uint32_t current = maximum.load(std::memory_order_relaxed);
+        while (us > current &&
+               !maximum.compare_exchange_weak(current, us, std::memory_order_relaxed)) {
+        }
+    }
+
+    void reset() {
+        for (uint8_t i = 0; i < BUCKETS; i++) {
+            buckets[i].store(0, std::memory_order_relaxed);
+        }
+        total.store(0, std::memory_order_relaxed);
+        maximum.store(0, std::memory_order_relaxed);
+    }
+
+    uint32_t count() const { return total.load(std::memory_order_relaxed); }
+    uint32_t max() const { return maximum.load(std::memory_order_relaxed); }
+
+    /**
+     * @param permille 0..1000 (500 = median, 990 = p99)
+     * @return Upper bound of the bucket holding that rank, capped at max()
+     */
+    uint32_t percentile(uint16_t permille) const {
+        uint32_t counts[BUCKETS];
+        uint32_t n = 0;
+        for (uint8_t i = 0; i < BUCKETS; i++) {
+            counts[i] = buckets[i].load(std::memory_order_relaxed);
+            n += counts[i];
+        }
+        return capped(percentileOf(counts, n, permille), maximum.load(std::memory_order_relaxed));
+    }
+
+    LatencySummary summary() const {
+        uint32_t counts[BUCKETS];
+        LatencySummary s;
+        for (uint8_t i = 0; i < BUCKETS; i++) {
+            counts[i] = buckets[i].load(std::memory_order_relaxed);
+            s.count += counts[i];
+        }
+        s.maxUs = maximum.load(std::memory_order_relaxed);
+        s.p50Us = capped(percentileOf(counts, s.count, 500), s.maxUs);
+        s.p90Us = capped(percentileOf(counts, s.count, 900), s.maxUs);
+        s.p99Us = capped(percentileOf(counts, s.count, 990), s.maxUs);
+        return s;
+    }
+
+    static uint8_t bucketFor(uint32_t us) {
+        if (us < (1u << SUB_BUCKET_BITS)) {
+            return static_cast<uint8_t>(us);
+        }
+        uint8_t exponent = 31 - static_cast<uint8_t>(__builtin_clz(us));
+        if (exponent >= MAX_EXPONENT) {
+            return BUCKETS - 1;
+        }
+        uint32_t sub = (us >> (exponent - SUB_BUCKET_BITS)) & ((1u << SUB_BUCKET_BITS) - 1);
+        return static_cast<uint8_t>((exponent - 1) * (1 << SUB_BUCKET_BITS) + sub);
+    }
+
+    // Largest value that maps to the bucket
+    static uint32_t bucketUpperBound(uint8_t bucket) {
+        if (bucket < (1 << SUB_BUCKET_BITS)) {
+            return bucket;
+        }
+        if (bucket >= BUCKETS - 1) {
+            return UINT32_MAX;
+        }
+        uint8_t exponent = bucket / (1 << SUB_BUCKET_BITS) + 1;
+        uint32_t sub = bucket % (1 << SUB_BUCKET_BITS);
+        uint32_t width = 1u << (exponent - SUB_BUCKET_BITS);
+        return (1u << exponent) + (sub + 1) * width - 1;
+    }
+
+private:
+    static uint32_t percentileOf(const uint32_t* counts, uint32_t n, uint16_t permille) {
+        if (n == 0) {
+            return 0;
+        }
+        // Rank of the sample at the requested quantile (1-based, rounded up)
+        uint32_t rank = static_cast<uint32_t>((static_cast<uint64_t>(n) * permille + 999) / 1000);
+        if (rank == 0) {
+            rank = 1;
+        }
+        uint32_t seen = 0;
+        for (uint8_t i = 0; i < BUCKETS; i++) {
+            seen += counts[i];
+            if (seen >= rank) {
+                return bucketUpperBound(i);
+            }
+        }
+        return bucketUpperBound(BUCKETS - 1);
+    }
+
+    static uint32_t capped(uint32_t value, uint32_t maxUs) {
+        return value < maxUs ? value : maxUs;
+    }
+
+    std::atomic<uint32_t> buckets[BUCKETS];
+    std::atomic<uint32_t> total;
+    std::atomic<uint32_t> maximum;
+};
+
+} // namespace mb8art
+
+#endif // MB8ART_LATENCY_H
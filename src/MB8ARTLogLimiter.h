@@ -0,0 +1,146 @@
+#ifndef MB8ART_LOG_LIMITER_H
+#define MB8ART_LOG_LIMITER_H
+
+#include <stdint.h>
+#include <atomic>
+
+/**
+ * @file MB8ARTLogLimiter.h
+ * @brief Per-site token-bucket log rate limiting with suppression counts
+ *
+ * Each log site (sensor error on channel 3, Modbus error, data timeout, ...)
+ * owns a bucket of `burst` tokens refilled at one token per `intervalMs`.
+ * A message that finds no token is counted instead of logged; the next
+ * message that gets through reports how many were dropped in between
+ * ("... (47 suppressed)").
+ *
+ * The bucket is kept as a single theoretical-arrival time (GCRA), so a
+ * decision is one relaxed load and one CAS - no spinlock, and every MB8ART
+ * instance has its own table, so modules never throttle each other.
+ * Times are milliseconds; wraparound and long idle periods are handled.
+ */
+
+namespace mb8art {
+
+enum class LogSite : uint8_t {
+    SENSOR_ERROR = 0,       // + channel: handleSensorError (8 sites)
+    MODBUS_ERROR = 8,       // handleModbusError (error line and hint)
+    INVALID_RESPONSE,       // Response without data
+    CONNECTION_LOST,        // handleDisconnection
+    DATA_TIMEOUT,           // waitForData timed out
+    CHANNEL_ERROR,          // waitForData saw channel error bits
+    OFFLINE,                // Request or configuration refused while offline
+    REQUEST_FAILED,         // Read request could not be queued
+    COUNT
+};
+
+inline LogSite sensorErrorSite(uint8_t channel) {
+    return static_cast<LogSite>(static_cast<uint8_t>(LogSite::SENSOR_ERROR) + (channel & 0x07));
+}
+
+struct LogRate {
+    uint32_t intervalMs;    // One token per interval; 0 = unlimited
+    uint8_t burst;          // Bucket size; 0 = site muted
+};
+
+// Defaults: sensor errors once per 30 s per channel (as before), the rest a
+// burst of 3 then one per 10 s; channel errors can arrive for all 8 at once
+inline LogRate defaultLogRate(LogSite site) {
+    return static_cast<uint8_t>(site) < static_cast<uint8_t>(LogSite::MODBUS_ERROR) ? LogRate{30000, 1}
+         : site == LogSite::CHANNEL_ERROR ? LogRate{10000, 8}
+         : LogRate{10000, 3};
+}
+
+class LogLimiter {
+public:
+    constexpr LogLimiter() : intervalMs(10000), burst(3), tat(0), suppressed(0) {}
+
+    LogLimiter(const LogLimiter&) = delete;
+    LogLimiter& operator=(const LogLimiter&) = delete;
+
+    void configure(const LogRate& rate) {
+        intervalMs.store(rate.intervalMs, std::memory_order_relaxed);
+        burst.store(rate.burst, std::memory_order_relaxed);
+    }
+
+    LogRate getRate() const {
+        return LogRate{intervalMs.load(std::memory_order_relaxed), burst.load(std::memory_order_relaxed)};
+    }
+
+    /**
+     * @brief Take a token
+     * @param nowMs Current time in milliseconds
+     * @param suppressedOut Set to the messages suppressed since the last
+     *        allowed one (only when returning true)
+     * @return true if the caller should log
+     */
+    bool allow(uint32_t nowMs, uint32_t& suppressedOut) {
+        uint32_t interval = intervalMs.load(std::memory_order_relaxed);
+        uint8_t size = burst.load(std::memory_order_relaxed);
+        if (size == 0) {
+            suppressed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (interval != 0) {
+            uint32_t window = interval * size;
+            uint32_t current = tat.load(std::memory_order_relaxed);
+            for (;;) {
+                // How far the bucket is ahead of now; beyond the window means
+                // the arrival time is in the past (or stale after a wrap).
+                // 0 is reserved for an unused bucket
+                uint32_t ahead = current - nowMs;
+                if (current == 0 || ahead > window) {
+                    ahead = 0;
+                }
+                if (ahead + interval > window) {
+                    suppressed.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+                uint32_t next = nowMs + ahead + interval;
+                if (tat.compare_exchange_weak(current, next != 0 ? next : 1,
+                                              std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+        }
+        suppressedOut = suppressed.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Suppressed since the last allowed message (not reset)
+    uint32_t pendingSuppressed() const { return suppressed.load(std::memory_order_relaxed); }
+
+    void reset() {
+        tat.store(0, std::memory_order_relaxed);
+        suppressed.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint32_t> intervalMs;
+    std::atomic<uint8_t> burst;
+    std::atomic<uint32_t> tat;          // Theoretical arrival time of the next token
+    std::atomic<uint32_t> suppressed;
+};
+
+/**
+ * @brief One limiter per LogSite, initialised with defaultLogRate()
+ */
+class LogLimiterTable {
+public:
+    LogLimiterTable() {
+        for (uint8_t i = 0; i < SITES; i++) {
+            limiters[i].configure(defaultLogRate(static_cast<LogSite>(i)));
+        }
+    }
+
+    LogLimiter& operator[](LogSite site) { return limiters[static_cast<uint8_t>(site)]; }
+    const LogLimiter& operator[](LogSite site) const { return limiters[static_cast<uint8_t>(site)]; }
+
+private:
+    static constexpr uint8_t SITES = static_cast<uint8_t>(LogSite::COUNT);
+    LogLimiter limiters[SITES];
+};
+
+} // namespace mb8art
+
+#endif // MB8ART_LOG_LIMITER_H
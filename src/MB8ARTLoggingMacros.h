@@ -111,6 +111,70 @@
 #define LOG_MB8ART_VERBOSE(...) MB8ART_LOG_V(__VA_ARGS__)
 #define LOG_MB8ART_VERBOSE_VAR(msg, var) MB8ART_LOG_V(msg, var)
 
+// =============================================================================
+// Deferred logging (MB8ART_DEFERRED_LOG=1, see MB8ARTDeferredLog.h)
+// =============================================================================
+// The _NL variants capture format pointer + arguments into a ring and return;
+// MB8ARTSharedResources::startDeferredLogTask() formats and writes them.
+// MB8ART_LOG_WRITE_NOW always logs synchronously (used by the drain side).
+#include "MB8ARTDeferredLog.h"
+
+#ifdef USE_CUSTOM_LOGGER
+    #define MB8ART_LOG_WRITE_NOW(level, ...) LOG_WRITE(level, MB8ART_LOG_TAG, __VA_ARGS__)
+#else
+    #define MB8ART_LOG_WRITE_NOW(level, ...) ESP_LOG_LEVEL_LOCAL(level, MB8ART_LOG_TAG, __VA_ARGS__)
+#endif
+
+#if MB8ART_DEFERRED_LOG
+    #define MB8ART_LOG_DEFERRED(level, ...) \
+        do { \
+            if (false) { mb8art::deferredLogFormatCheck(__VA_ARGS__); } \
+            mb8art::DeferredLog::write(static_cast<uint8_t>(level), \
+                                       static_cast<uint32_t>(xTaskGetTickCount()), __VA_ARGS__); \
+        } while(0)
+
+    #undef LOG_MB8ART_ERROR_NL
+    #undef LOG_MB8ART_ERROR_VAR_NL
+    #undef LOG_MB8ART_WARN_NL
+    #undef LOG_MB8ART_WARN_VAR_NL
+    #undef LOG_MB8ART_INFO_NL
+    #undef LOG_MB8ART_INFO_VAR_NL
+    #define LOG_MB8ART_ERROR_NL(...) MB8ART_LOG_DEFERRED(MB8ART_LOG_LEVEL_E, __VA_ARGS__)
+    #define LOG_MB8ART_ERROR_VAR_NL(msg, var) MB8ART_LOG_DEFERRED(MB8ART_LOG_LEVEL_E, msg, var)
+    #define LOG_MB8ART_WARN_NL(...) MB8ART_LOG_DEFERRED(MB8ART_LOG_LEVEL_W, __VA_ARGS__)
+    #define LOG_MB8ART_WARN_VAR_NL(msg, var) MB8ART_LOG_DEFERRED(MB8ART_LOG_LEVEL_W, msg, var)
+    #define LOG_MB8ART_INFO_NL(...) MB8ART_LOG_DEFERRED(MB8ART_LOG_LEVEL_I, __VA_ARGS__)
+    #define LOG_MB8ART_INFO_VAR_NL(msg, var) MB8ART_LOG_DEFERRED(MB8ART_LOG_LEVEL_I, msg, var)
+    #ifdef MB8ART_DEBUG
+        #undef LOG_MB8ART_DEBUG_NL
+        #undef LOG_MB8ART_DEBUG_VAR_NL
+        #define LOG_MB8ART_DEBUG_NL(...) MB8ART_LOG_DEFERRED(MB8ART_LOG_LEVEL_D, __VA_ARGS__)
+        #define LOG_MB8ART_DEBUG_VAR_NL(msg, var) MB8ART_LOG_DEFERRED(MB8ART_LOG_LEVEL_D, msg, var)
+    #endif
+#endif
+
+// =============================================================================
+// Rate-limited logging (see MB8ARTLogLimiter.h)
+// =============================================================================
+// limiter: an mb8art::LogLimiter lvalue, e.g. logLimiters[LogSite::DATA_TIMEOUT].
+// Messages suppressed since the last one that got through are appended as
+// " (N suppressed)".
+#define MB8ART_LOG_LIMITED(logMacro, limiter, format, ...) \
+    do { \
+        uint32_t _suppressed = 0; \
+        if ((limiter).allow(static_cast<uint32_t>(pdTICKS_TO_MS(xTaskGetTickCount())), _suppressed)) { \
+            if (_suppressed > 0) { \
+                logMacro(format " (%lu suppressed)", ##__VA_ARGS__, \
+                         static_cast<unsigned long>(_suppressed)); \
+            } else { \
+                logMacro(format, ##__VA_ARGS__); \
+            } \
+        } \
+    } while(0)
+
+#define LOG_MB8ART_ERROR_LIMITED(limiter, ...) MB8ART_LOG_LIMITED(LOG_MB8ART_ERROR_NL, limiter, __VA_ARGS__)
+#define LOG_MB8ART_WARN_LIMITED(limiter, ...) MB8ART_LOG_LIMITED(LOG_MB8ART_WARN_NL, limiter, __VA_ARGS__)
+
 // =============================================================================
 // Feature-specific debug flags (enabled when MB8ART_DEBUG is defined)
 // =============================================================================
@@ -132,21 +196,34 @@
 // =============================================================================
 // Performance timing macros
 // =============================================================================
-#ifdef MB8ART_DEBUG_TIMING
-    #define MB8ART_PERF_START(name) TickType_t _perf_start_##name = xTaskGetTickCount()
+// START/END pairs feed named counters in MB8ARTProfiler.h (cycle counter,
+// count/total/max, dump with MB8ART::logProfile()). A START without END is
+// recorded when the scope exits. MB8ART_DEBUG_TIMING additionally logs
+// each END at debug level.
+#include "MB8ARTProfiler.h"
+
+#if MB8ART_PROFILER
+    #ifdef MB8ART_DEBUG_TIMING
+        #define MB8ART_PERF_TRACE(msg, ticks) \
+            MB8ART_LOG_D("%s took %lu us", msg, \
+                         static_cast<unsigned long>(mb8art::Profiler::ticksToUs(ticks)))
+    #else
+        #define MB8ART_PERF_TRACE(msg, ticks) ((void)(ticks))
+    #endif
+
+    #define MB8ART_PERF_START(name) \
+        mb8art::ProfileTimer _perf_##name(MB8ART_PROFILE_COUNTER(#name))
     #define MB8ART_PERF_END(name, msg) \
         do { \
-            TickType_t _perf_elapsed_##name = xTaskGetTickCount() - _perf_start_##name; \
-            MB8ART_LOG_D("%s took %d ms", msg, pdTICKS_TO_MS(_perf_elapsed_##name)); \
+            uint32_t _perf_ticks_##name = _perf_##name.stop(); \
+            MB8ART_PERF_TRACE(msg, _perf_ticks_##name); \
         } while(0)
     #define MB8ART_PERF_END_WARN(name, msg, threshold_ms) \
         do { \
-            TickType_t _perf_elapsed_##name = xTaskGetTickCount() - _perf_start_##name; \
-            if (pdTICKS_TO_MS(_perf_elapsed_##name) > threshold_ms) { \
-                MB8ART_LOG_W("%s took %d ms (threshold: %d ms)", \
-                           msg, pdTICKS_TO_MS(_perf_elapsed_##name), threshold_ms); \
-            } else { \
-                MB8ART_LOG_D("%s took %d ms", msg, pdTICKS_TO_MS(_perf_elapsed_##name)); \
+            uint32_t _perf_us_##name = mb8art::Profiler::ticksToUs(_perf_##name.stop()); \
+            if (_perf_us_##name > (threshold_ms) * 1000UL) { \
+                MB8ART_LOG_W("%s took %lu us (threshold: %d ms)", \
+                             msg, static_cast<unsigned long>(_perf_us_##name), threshold_ms); \
             } \
         } while(0)
 #else
@@ -0,0 +1,192 @@
+#ifndef MB8ART_METRICS_H
+#define MB8ART_METRICS_H
+
+#include <stdint.h>
+#include <atomic>
+#include "MB8ARTLatency.h"
+
+/**
+ * @file MB8ARTMetrics.h
+ * @brief Per-device bus health counters, always on
+ *
+ * Every counter is a relaxed 32-bit atomic bumped where the event already
+ * happens (response handler, error handler, request and poll paths), so
+ * the cost is one uncontended add per event. A snapshot is a set of relaxed
+ * loads - counters may be a frame apart from each other, never torn.
+ */
+
+namespace mb8art {
+
+// Outcome of one Modbus transaction as seen by the driver
+enum class BusEvent : uint8_t {
+    FRAME_OK = 0,   // Response delivered
+    CRC_ERROR,
+    TIMEOUT,        // No response from the module
+    EXCEPTION,      // Module answered with a Modbus exception
+    OTHER_ERROR     // Invalid response, queue full, not initialised, ...
+};
+
+/**
+ * @brief Snapshot returned by MB8ART::getMetrics()
+ */
+struct BusMetrics {
+    uint32_t framesOk = 0;
+    uint32_t crcErrors = 0;
+    uint32_t timeouts = 0;              // Bus timeouts reported by the Modbus layer
+    uint32_t exceptions = 0;
+    uint32_t otherErrors = 0;
+    uint32_t dataTimeouts = 0;          // waitForData() gave up
+    uint32_t retries = 0;               // Re-attempted requests (init probe)
+    uint32_t requestsQueued = 0;        // Polling requests handed to the Modbus queue
+    uint32_t requestsRejected = 0;      // ... refused by the queue
+    uint16_t inFlight = 0;              // Polling requests awaiting response or error
+    uint16_t inFlightHighWater = 0;
+    uint32_t cacheHits = 0;             // Connection status served from cache
+    uint32_t cacheMisses = 0;
+    uint32_t onlineTransitions = 0;     // Offline -> online
+    uint32_t offlineTransitions = 0;    // Online -> offline
+    uint8_t consecutiveTimeouts = 0;
+    bool online = false;
+    LatencySummary rtt;                 // Temperature request -> response (us)
+};
+
+class BusMetricsCounters {
+public:
+    constexpr BusMetricsCounters()
+        : framesOk(0), crcErrors(0), timeouts(0), exceptions(0), otherErrors(0),
+          dataTimeouts(0), retries(0), requestsQueued(0), requestsRejected(0),
+          inFlight(0), inFlightHighWater(0), cacheHits(0), cacheMisses(0),
+          onlineTransitions(0), offlineTransitions(0), untracked(0) {}
+
+    BusMetricsCounters(const BusMetricsCounters&) = delete;
+    BusMetricsCounters& operator=(const BusMetricsCounters&) = delete;
+
+    /**
+     * @param settlesRequest The event answers a request counted by
+     *        requestQueued() - false for synchronous and config reads
+     */
+    void record(BusEvent event, bool settlesRequest) {
+        switch (event) {
+            case BusEvent::FRAME_OK:    bump(framesOk); break;
+            case BusEvent::CRC_ERROR:   bump(crcErrors); break;
+            case BusEvent::TIMEOUT:     bump(timeouts); break;
+            case BusEvent::EXCEPTION:   bump(exceptions); break;
+            case BusEvent::OTHER_ERROR: bump(otherErrors); break;
+        }
+        if (!settlesRequest) {
+            return;
+        }
+        // Never below zero: a late reply may follow a reset()
+        uint32_t current = inFlight.load(std::memory_order_relaxed);
+        while (current > 0 &&
+               !inFlight.compare_exchange_weak(current, current - 1, std::memory_order_relaxed)) {
+        }
+    }
+
+    void requestQueued(bool accepted) {
+        if (!accepted) {
+            bump(requestsRejected);
+            return;
+        }
+        bump(requestsQueued);
+        uint32_t depth = inFlight.fetch_add(1, std::memory_order_relaxed) + 1;
+        uint32_t high = inFlightHighWater.load(std::memory_order_relaxed);
+        while (depth > high &&
+               !inFlightHighWater.compare_exchange_weak(high, depth, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * @brief Synchronous/config transactions in progress (see UntrackedTransaction)
+     *
+     * Errors carry no function code. One that arrives while such a
+     * transaction runs is taken to be its own and settles no polling request.
+     */
+    void untrackedStarted() { untracked.fetch_add(1, std::memory_order_relaxed); }
+    void untrackedFinished() { untracked.fetch_sub(1, std::memory_order_relaxed); }
+
+    // An error now answers a polling request: one is in flight and nothing untracked runs
+    bool errorSettlesRequest() const {
+        return load(untracked) == 0 && load(inFlight) != 0;
+    }
+
+    void dataTimeout() { bump(dataTimeouts); }
+    void retry() { bump(retries); }
+    void cacheLookup(bool hit) { bump(hit ? cacheHits : cacheMisses); }
+    void wentOnline() { bump(onlineTransitions); }
+    void wentOffline() { bump(offlineTransitions); }
+
+    // Fills the counter fields; the device adds state and RTT
+    void snapshot(BusMetrics& out) const {
+        out.framesOk = load(framesOk);
+        out.crcErrors = load(crcErrors);
+        out.timeouts = load(timeouts);
+        out.exceptions = load(exceptions);
+        out.otherErrors = load(otherErrors);
+        out.dataTimeouts = load(dataTimeouts);
+        out.retries = load(retries);
+        out.requestsQueued = load(requestsQueued);
+        out.requestsRejected = load(requestsRejected);
+        out.inFlight = saturate16(load(inFlight));
+        out.inFlightHighWater = saturate16(load(inFlightHighWater));
+        out.cacheHits = load(cacheHits);
+        out.cacheMisses = load(cacheMisses);
+        out.onlineTransitions = load(onlineTransitions);
+        out.offlineTransitions = load(offlineTransitions);
+    }
+
+    // Zero the counters; requests still in flight keep counting down
+    void reset() {
+        std::atomic<uint32_t>* all[] = {&framesOk, &crcErrors, &timeouts, &exceptions, &otherErrors,
+                                        &dataTimeouts, &retries, &requestsQueued, &requestsRejected,
+                                        &cacheHits, &cacheMisses, &onlineTransitions,
+                                        &offlineTransitions};
+        for (std::atomic<uint32_t>* counter : all) {
+            counter->store(0, std::memory_order_relaxed);
+        }
+        inFlightHighWater.store(inFlight.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+private:
+    static void bump(std::atomic<uint32_t>& counter) { counter.fetch_add(1, std::memory_order_relaxed); }
+    static uint32_t load(const std::atomic<uint32_t>& counter) { return counter.load(std::memory_order_relaxed); }
+    static uint16_t saturate16(uint32_t v) { return v > 0xFFFF ? 0xFFFF : static_cast<uint16_t>(v); }
+
+    std::atomic<uint32_t> framesOk;
+    std::atomic<uint32_t> crcErrors;
+    std::atomic<uint32_t> timeouts;
+    std::atomic<uint32_t> exceptions;
+    std::atomic<uint32_t> otherErrors;
+    std::atomic<uint32_t> dataTimeouts;
+    std::atomic<uint32_t> retries;
+    std::atomic<uint32_t> requestsQueued;
+    std::atomic<uint32_t> requestsRejected;
+    std::atomic<uint32_t> inFlight;
+    std::atomic<uint32_t> inFlightHighWater;
+    std::atomic<uint32_t> cacheHits;
+    std::atomic<uint32_t> cacheMisses;
+    std::atomic<uint32_t> onlineTransitions;
+    std::atomic<uint32_t> offlineTransitions;
+    std::atomic<uint32_t> untracked;
+};
+
+/**
+ * @brief Scope of one synchronous or configuration transaction
+ */
+class UntrackedTransaction {
+public:
+    explicit UntrackedTransaction(BusMetricsCounters& counters) : counters(counters) {
+        counters.untrackedStarted();
+    }
+    ~UntrackedTransaction() { counters.untrackedFinished(); }
+
+    UntrackedTransaction(const UntrackedTransaction&) = delete;
+    UntrackedTransaction& operator=(const UntrackedTransaction&) = delete;
+
+private:
+    BusMetricsCounters& counters;
+};
+
+} // namespace mb8art
+
+#endif // MB8ART_METRICS_H
@@ -27,16 +27,11 @@ void MB8ART::clearPendingResponses() {
     LOG_MB8ART_DEBUG_NL("Ready for fresh responses");
 }
 
-void MB8ART::processModbusResponse(uint8_t functionCode, const uint8_t* data, uint16_t length) {
-    LOG_MB8ART_DEBUG_NL("Modbus response received: FC=%d, Length=%d", functionCode, length);
-
-    if (modbusResponseCallback) {
-        modbusResponseCallback(functionCode, data, length);
-    }
-}
-
-void MB8ART::registerModbusResponseCallback(std::function<void(uint8_t, const uint8_t*, uint16_t)> callback) {
+void MB8ART::registerModbusResponseCallback(mb8art::ModbusResponseCallback callback, void* context) {
+    taskENTER_CRITICAL(&channelStateMux);
     modbusResponseCallback = callback;
+    modbusResponseCallbackContext = context;
+    taskEXIT_CRITICAL(&channelStateMux);
 }
 
 
@@ -58,6 +53,31 @@ void MB8ART::handleModbusResponse(uint8_t functionCode, uint16_t startingAddress
                                  const uint8_t* data, size_t length) {
     // Update response time on ANY successful response (passive monitoring)
     lastResponseTime = xTaskGetTickCount();
+    uint32_t receivedUs = getLatencyTimeUs();
+    if (traceBuffer != nullptr) {
+        // Round trip is known for the temperature read (the only stamped request)
+        bool temperatureRead = functionCode == static_cast<uint8_t>(esp32Modbus::FunctionCode::READ_INPUT_REGISTER) &&
+                               startingAddress == TEMPERATURE_REGISTER_START;
+        traceTransaction(mb8art::TraceKind::RESPONSE, functionCode, startingAddress, 0,
+                         data, length, receivedUs,
+                         temperatureRead ? pendingRequestUs.load(std::memory_order_relaxed) : 0);
+    }
+
+    // Raw-frame tap sees every response before it is decoded
+    if (modbusResponseCallback != nullptr) {
+        mb8art::ModbusFrame frame = {functionCode, startingAddress, data,
+                                     static_cast<uint16_t>(length),
+                                     static_cast<uint32_t>(pdTICKS_TO_MS(lastResponseTime))};
+        invokeModbusResponseCallback(frame);
+    }
+
+    // Only the polling reads (connection status, temperatures) are counted in flight
+    const mb8art::RegisterDescriptor& statusReg = mb8art::registerDescriptor(mb8art::RegisterId::CONNECTION_STATUS);
+    const mb8art::RegisterDescriptor& temperatureReg = mb8art::registerDescriptor(mb8art::RegisterId::TEMPERATURES);
+    bool pollingResponse =
+        (functionCode == statusReg.functionCode && startingAddress == statusReg.address) ||
+        (functionCode == temperatureReg.functionCode && startingAddress == temperatureReg.address);
+    busMetrics.record(mb8art::BusEvent::FRAME_OK, pollingResponse);
 
     // Reset timeout counter - module is responsive
     consecutiveTimeouts = 0;
@@ -68,11 +88,12 @@ void MB8ART::handleModbusResponse(uint8_t functionCode, uint16_t startingAddress
     // Clear offline flag if it was set (device is back online)
     if (statusFlags.moduleOffline) {
         statusFlags.moduleOffline = 0;
+        busMetrics.wentOnline();
         LOG_MB8ART_INFO_NL("Module back ONLINE - received valid response");
     }
 
     if (data == nullptr || length == 0) {
-        LOG_MB8ART_ERROR_NL("Invalid response data");
+        LOG_MB8ART_ERROR_LIMITED(logLimiters[mb8art::LogSite::INVALID_RESPONSE], "Invalid response data");
         return;
     }
 
@@ -90,196 +111,27 @@ void MB8ART::handleModbusResponse(uint8_t functionCode, uint16_t startingAddress
     }
 
     switch (fc) {
-        case esp32Modbus::FunctionCode::READ_HOLD_REGISTER: {
-            MB8ART_LOG_CRITICAL_ENTRY("READ_HOLD_REGISTER processing");
-            
+        case esp32Modbus::FunctionCode::READ_HOLD_REGISTER:
+        case esp32Modbus::FunctionCode::READ_DISCR_INPUT:
+        case esp32Modbus::FunctionCode::READ_INPUT_REGISTER: {
+            MB8ART_LOG_CRITICAL_ENTRY("Register response processing");
+            bool holding = fc == esp32Modbus::FunctionCode::READ_HOLD_REGISTER;
+
             // Any successful read response indicates the device is responsive
-            setInitializationBit(InitBits::DEVICE_RESPONSIVE);
-            
-            // Check if this is a batch read response (7 registers starting at 70)
-            if (startingAddress == 70 && length == 14) {  // 7 registers * 2 bytes
-                LOG_MB8ART_DEBUG_NL("Processing batch configuration data");
-                
-                // Parse all values from the batch (starting at register 70)
-                // RS485 Address (register 70) - bytes 0-1
-                uint16_t rawAddress = (data[0] << 8) | data[1];
-                moduleSettings.rs485Address = rawAddress & 0xFF;  // Only low byte is used
-                LOG_MB8ART_DEBUG_NL("RS485 address: %d (raw: 0x%04X)", moduleSettings.rs485Address, rawAddress);
-                
-                // Baud rate (register 71) - bytes 2-3
-                uint16_t rawBaud = (data[2] << 8) | data[3];
-                moduleSettings.baudRate = rawBaud & 0xFF;  // Only low byte is used
-                LOG_MB8ART_DEBUG_NL("Baud rate code: %d (raw: 0x%04X)", moduleSettings.baudRate, rawBaud);
-                
-                // Parity (register 72) - bytes 4-5
-                uint16_t rawParity = (data[4] << 8) | data[5];
-                moduleSettings.parity = rawParity & 0xFF;  // Only low byte is used
-                LOG_MB8ART_DEBUG_NL("Parity code: %d (raw: 0x%04X)", moduleSettings.parity, rawParity);
-                
-                // Skip reserved registers 73-74 (bytes 6-9)
-                
-                // Measurement range - MB8ART device quirk:
-                // In batch reads, the value appears at register 75 (bytes 10-11)
-                // even though single register reads show it at register 76
-                uint16_t rawRange = (data[10] << 8) | data[11];  // Register 75
-                currentRange = static_cast<mb8art::MeasurementRange>(rawRange & 0x01);
-                LOG_MB8ART_DEBUG_NL("Measurement range from reg 75: %d (raw: 0x%04X)", (int)currentRange, rawRange);
-                
-                // Log what's at register 76 for debugging
-                LOG_MB8ART_DEBUG_NL("Value at reg 76: 0x%04X", (data[12] << 8) | data[13]);
-                
-                LOG_MB8ART_DEBUG_NL("Batch config received - Range: %s, Addr: %d, Baud: %s",
-                                  (currentRange == mb8art::MeasurementRange::HIGH_RES) ? "HIGH_RES" : "LOW_RES",
-                                  moduleSettings.rs485Address,
-                                  baudRateToString(getBaudRateEnum(moduleSettings.baudRate)).c_str());
-                
-                // Set initialization bit for measurement range
-                setInitializationBit(InitBits::MEASUREMENT_RANGE);
-                MB8ART_SRP_EVENT_GROUP_SET_BITS(xTaskEventGroup, DATA_READY_BIT);
-                
-                MB8ART_LOG_CRITICAL_EXIT("READ_HOLD_REGISTER processing (batch)");
-                break;  // Exit switch - IMPORTANT!
+            if (holding) {
+                setInitializationBit(InitBits::DEVICE_RESPONSIVE);
             }
-            
-            // Continue with existing single-register handlers...
-            switch (startingAddress) {
-                case CONNECTION_STATUS_START_REGISTER: {
-                    // Connection status register - used during probe
-                    LOG_MB8ART_DEBUG_NL("Connection status register response received");
-                    if (!statusFlags.initialized) {
-                        setInitializationBit(InitBits::DEVICE_RESPONSIVE);
-                    }
-                    break;
-                }
-                
-                case MEASUREMENT_RANGE_REGISTER: {
-                    if (validatePacketLength(length, EXPECTED_MEASUREMENT_RANGE_PACKET_LENGTH, "Measurement Range")) {
-                        uint16_t rawRange = (data[0] << 8) | data[1];
-                        currentRange = static_cast<mb8art::MeasurementRange>(rawRange & 0x01);
-                        LOG_MB8ART_DEBUG_NL("Measurement Range successfully read: %s",
-                                         (currentRange == mb8art::MeasurementRange::HIGH_RES) ? "HIGH_RES" : "LOW_RES");
-                        
-                        // Only set the MEASUREMENT_RANGE init bit during initialization
-                        if (!statusFlags.initialized) {
-                            setInitializationBit(InitBits::MEASUREMENT_RANGE);
-                        }
-                        
-                        MB8ART_SRP_EVENT_GROUP_SET_BITS(xTaskEventGroup, DATA_READY_BIT);
-                    }
-                    break;
-                }
-
-                case CHANNEL_CONFIG_REGISTER_START ... (CHANNEL_CONFIG_REGISTER_START + DEFAULT_NUMBER_OF_SENSORS - 1): {
-                    uint8_t channelStart = startingAddress - CHANNEL_CONFIG_REGISTER_START;
-                    LOG_MB8ART_DEBUG_NL("Channel configuration packet received, starting at channel %d, length=%d", 
-                                       channelStart, length);
-                    if (length % 2 == 0 && (channelStart + length / 2) <= DEFAULT_NUMBER_OF_SENSORS) {
-                        for (uint8_t i = 0; i < length / 2; i++) {
-                            uint8_t channel = channelStart + i;
-                            uint16_t rawConfig = (data[i * 2] << 8) | data[i * 2 + 1];
-                            processChannelConfig(channel, rawConfig);
-                        }
-                        
-                        // During initialization, handle both single and multi-channel reads
-                        if (!statusFlags.initialized) {
-                            // Mark channels as configured
-                            int numChannels = length / 2;
-                            for (int ch = 0; ch < numChannels; ch++) {
-                                channelsConfiguredDuringInit |= (1 << (channelStart + ch));
-                            }
-                            
-                            LOG_MB8ART_DEBUG_NL("Configured %d channel(s) starting at %d during init", 
-                                               numChannels, channelStart);
-                            
-                            // Check if we've received all 8 channels
-                            if (channelsConfiguredDuringInit == 0xFF) {  // All 8 bits set
-                                LOG_MB8ART_DEBUG_NL("All channels configured during init (0x%02X)", 
-                                                  channelsConfiguredDuringInit);
-                                setInitializationBit(InitBits::CHANNEL_CONFIG);
-                            } else {
-                                LOG_MB8ART_DEBUG_NL("Channels configured so far: 0x%02X", 
-                                                   channelsConfiguredDuringInit);
-                            }
-                        } else if (channelStart == 0 && length == (DEFAULT_NUMBER_OF_SENSORS * 2)) {
-                            // All channels in one response (normal operation)
-                            LOG_MB8ART_DEBUG_NL("All %d channels configured in single response", DEFAULT_NUMBER_OF_SENSORS);
-                            setInitializationBit(InitBits::CHANNEL_CONFIG);
-                            MB8ART_SRP_EVENT_GROUP_SET_BITS(xTaskEventGroup, DATA_READY_BIT);
-                        } else if (channelStart + length / 2 == DEFAULT_NUMBER_OF_SENSORS) {
-                            // Multi-packet that completes at channel 8
-                            LOG_MB8ART_DEBUG_NL("Channel configuration complete (multi-packet)");
-                            setInitializationBit(InitBits::CHANNEL_CONFIG);
-                        }
-                    } else {
-                        LOG_MB8ART_WARN_NL("Invalid channel config packet: start=%d, length=%d", 
-                                          channelStart, length);
-                    }
-                    break;
-                }
-
-                case RS485_ADDRESS_REGISTER: {
-                    LOG_MB8ART_DEBUG_NL("RS485 Address packet received, length=%d", length);
-                    if (validatePacketLength(length, EXPECTED_RS485_PACKET_LENGTH, "RS485 Address")) {
-                        uint16_t rs485AddressSetting = (data[0] << 8) | data[1];
-                        moduleSettings.rs485Address = rs485AddressSetting;
-                        LOG_MB8ART_DEBUG_NL("RS485 Address successfully read: %d", rs485AddressSetting);
-                        MB8ART_SRP_EVENT_GROUP_SET_BITS(xTaskEventGroup, DATA_READY_BIT);
-                    }
-                    break;
-                }
-
-                case BAUD_RATE_REGISTER: {
-                    LOG_MB8ART_DEBUG_NL("Baud Rate packet received, length=%d", length);
-                    if (validatePacketLength(length, EXPECTED_BAUD_RATE_PACKET_LENGTH, "Baud Rate")) {
-                        uint16_t rawBaudRate = (data[0] << 8) | data[1];
-                        if (rawBaudRate <= MAX_BAUD_RATE_VALUE) {
-                            moduleSettings.baudRate = rawBaudRate;
-                            LOG_MB8ART_DEBUG_NL("RS485 Baud Rate successfully read: %s",
-                                             baudRateToString(getBaudRateEnum(rawBaudRate)).c_str());
-                            MB8ART_SRP_EVENT_GROUP_SET_BITS(xTaskEventGroup, DATA_READY_BIT);
-                        } else {
-                            LOG_MB8ART_ERROR_NL("Invalid Baud Rate value: %d", rawBaudRate);
-                        }
-                    }
-                    break;
-                }
-
-                case PARITY_REGISTER: {
-                    LOG_MB8ART_DEBUG_NL("Parity packet received, length=%d", length);
-                    if (validatePacketLength(length, EXPECTED_PARITY_PACKET_LENGTH, "Parity")) {
-                        uint16_t rawParity = (data[0] << 8) | data[1];
-                        if (rawParity <= MAX_PARITY_VALUE) {
-                            moduleSettings.parity = rawParity;
-                            LOG_MB8ART_DEBUG_NL("RS485 Parity successfully read: %s",
-                                             parityToString(getParityEnum(rawParity)).c_str());
-                            MB8ART_SRP_EVENT_GROUP_SET_BITS(xTaskEventGroup, DATA_READY_BIT);
-                        } else {
-                            LOG_MB8ART_ERROR_NL("Invalid Parity value: %d", rawParity);
-                        }
-                    }
-                    break;
-                }
-
-                case MODULE_TEMPERATURE_REGISTER: {
-                    LOG_MB8ART_DEBUG_NL("Module temperature packet received, length=%d", length);
-                    if (validatePacketLength(length, EXPECTED_MODULE_TEMP_PACKET_LENGTH, "Module Temperature")) {
-                        uint16_t rawTemperature = (data[0] << 8) | data[1];
-                        float moduleTemperature = rawTemperature * 0.1f;
-                        moduleSettings.moduleTemperature = moduleTemperature;
-                        moduleSettings.isTemperatureValid = true;
-                        LOG_MB8ART_DEBUG_NL("Module Temperature successfully read: %.1f°C", moduleTemperature);
-                        MB8ART_SRP_EVENT_GROUP_SET_BITS(xTaskEventGroup, DATA_READY_BIT);
-                    }
-                    break;
-                }
 
-                default:
-                    LOG_MB8ART_WARN_NL("Unhandled holding register: 0x%04X", startingAddress);
-                    break;
+            const mb8art::RegisterDescriptor* reg = mb8art::findRegister(functionCode, startingAddress, length);
+            if (reg == nullptr) {
+                LOG_MB8ART_WARN_NL("Unhandled response: FC=%d, address=%d", functionCode, startingAddress);
+            } else if (dispatchRegisterResponse(*reg, data, length, startingAddress, true) &&
+                       reg->id == mb8art::RegisterId::TEMPERATURES) {
+                recordReadLatency(receivedUs);
             }
-            
+
             // Check if all initialization is complete (silently during init)
-            if (!statusFlags.initialized && xInitEventGroup) {
+            if (holding && !statusFlags.initialized && xInitEventGroup) {
                 EventBits_t bits = MB8ART_SRP_EVENT_GROUP_GET_BITS(xInitEventGroup);
                 bool allSet = (bits & InitBits::ALL_BITS) == InitBits::ALL_BITS;
                 
@@ -295,93 +147,7 @@ void MB8ART::handleModbusResponse(uint8_t functionCode, uint16_t startingAddress
                 }
             }
 
-            MB8ART_LOG_CRITICAL_EXIT("READ_HOLD_REGISTER processing");
-            break;
-        }
-
-        case esp32Modbus::FunctionCode::READ_DISCR_INPUT: {
-            if (startingAddress == CONNECTION_STATUS_START_REGISTER) {
-                LOG_MB8ART_DEBUG_NL("Connection status data received!");
-                handleConnectionStatus(data, length);
-            } else {
-                LOG_MB8ART_WARN_NL("Unhandled READ_DISCR_INPUT starting address: %d", startingAddress);
-            }
-            break;
-        }
-
-        case esp32Modbus::FunctionCode::READ_INPUT_REGISTER: {
-            switch (startingAddress) {
-                case TEMPERATURE_REGISTER_START: { // Address range for temperature data
-                    MB8ART_PERF_START(temp_processing);
-
-                    // Update global timestamp for fast path
-                    lastGlobalDataUpdate = xTaskGetTickCount();
-
-                    LOG_MB8ART_DEBUG_NL("Temperature data packet received, length=%d", length);
-
-                    // Confirm the current measurement range
-                    LOG_MB8ART_DEBUG_NL("Current Measurement Range: %s",
-                                     (currentRange == mb8art::MeasurementRange::HIGH_RES) ? "HIGH_RES" : "LOW_RES");
-
-                    // Validate packet length
-                    if (!validatePacketLength(length, EXPECTED_TEMPERATURE_PACKET_LENGTH, "Temperature Data")) {
-                        // Set error bits for all sensors (interleaved format)
-                        MB8ART_SRP_EVENT_GROUP_SET_BITS(xSensorEventGroup, mb8art::ALL_SENSOR_ERROR_BITS);
-                        
-                        // Notify tasks of error
-                        if (xTaskEventGroup) {
-                            MB8ART_SRP_EVENT_GROUP_SET_BITS(xTaskEventGroup, DATA_ERROR_BIT);
-                        }
-                        if (dataReceiverTask) {
-                            xTaskNotify(dataReceiverTask, DATA_ERROR_BIT, eSetBits);
-                        }
-                        return;
-                    }
-
-                    EventBits_t updateBitsToSet = 0;
-                    EventBits_t errorBitsToSet = 0;
-                    EventBits_t errorBitsToClear = 0;
-                    char statusBuffer[256];  // Thread-local buffer for thread safety
-                    statusBuffer[0] = '\0';  // Clear buffer
-                    
-                    processTemperatureData(data, length, updateBitsToSet, errorBitsToSet, 
-                                          errorBitsToClear, statusBuffer, sizeof(statusBuffer));
-                    
-                    updateEventBits(updateBitsToSet, errorBitsToSet, errorBitsToClear);
-                    
-                    // Notify waiting tasks if we have valid data
-                    if (updateBitsToSet) {
-                        // Set event bit for any waiting tasks
-                        if (xTaskEventGroup) {
-                            MB8ART_SRP_EVENT_GROUP_SET_BITS(xTaskEventGroup, DATA_READY_BIT);
-                        }
-                        
-                        // Direct notification to data receiver
-                        notifyDataReceiver();
-                    }
-                    
-                    if (errorBitsToSet) {
-                        if (xTaskEventGroup) {
-                            MB8ART_SRP_EVENT_GROUP_SET_BITS(xTaskEventGroup, DATA_ERROR_BIT);
-                        }
-                        if (dataReceiverTask) {
-                            xTaskNotify(dataReceiverTask, DATA_ERROR_BIT, eSetBits);
-                        }
-                    }
-                    
-                    // Only log if there's something to log
-                    if (statusBuffer[0] != '\0') {
-                        LOG_MB8ART_DEBUG_NL("%s", statusBuffer);
-                    }
-                    
-                    MB8ART_PERF_END(temp_processing, "Temperature processing");
-                    break;
-                }
-                
-                default:
-                    LOG_MB8ART_WARN_NL("Unhandled READ_INPUT_REGISTER starting address: %d", startingAddress);
-                    break;
-            }
+            MB8ART_LOG_CRITICAL_EXIT("Register response processing");
             break;
         }
 
@@ -429,13 +195,277 @@ void MB8ART::handleModbusResponse(uint8_t functionCode, uint16_t startingAddress
 
 
 
-// Spinlock for thread-safe access to error log throttle array
-static portMUX_TYPE errorLogThrottleMutex = portMUX_INITIALIZER_UNLOCKED;
+// ============================================================================
+// Register map dispatch
+// ============================================================================
+
+static_assert(mb8art::RegisterInit::MEASUREMENT_RANGE == MB8ART::InitBits::MEASUREMENT_RANGE &&
+              mb8art::RegisterInit::CHANNEL_CONFIG == MB8ART::InitBits::CHANNEL_CONFIG &&
+              mb8art::RegisterInit::DEVICE_RESPONSIVE == MB8ART::InitBits::DEVICE_RESPONSIVE,
+              "RegisterInit out of sync with MB8ART::InitBits");
+
+// Indexed by mb8art::RegisterId
+const MB8ART::RegisterDecoder MB8ART::REGISTER_DECODERS[] = {
+    &MB8ART::decodeConnectionStatus,    // CONNECTION_STATUS
+    &MB8ART::decodeTemperatures,        // TEMPERATURES
+    &MB8ART::decodeEquipmentStatus,     // EQUIPMENT_STATUS
+    &MB8ART::decodeModuleTemperature,   // MODULE_TEMPERATURE
+    &MB8ART::decodeProductVersion,      // PRODUCT_VERSION
+    &MB8ART::decodeModuleBatch,         // MODULE_BATCH
+    &MB8ART::decodeRs485Address,        // RS485_ADDRESS
+    &MB8ART::decodeBaudRate,            // BAUD_RATE
+    &MB8ART::decodeParity,              // PARITY
+    &MB8ART::decodeMeasurementRange,    // MEASUREMENT_RANGE
+    &MB8ART::decodeChannelConfig,       // CHANNEL_CONFIG
+};
+
+bool MB8ART::dispatchRegisterResponse(const mb8art::RegisterDescriptor& reg, const uint8_t* data, size_t length,
+                                      uint16_t address, bool signalWaiters) {
+    static_assert(sizeof(REGISTER_DECODERS) / sizeof(REGISTER_DECODERS[0]) ==
+                  static_cast<size_t>(mb8art::RegisterId::COUNT),
+                  "REGISTER_DECODERS must have one decoder per RegisterId");
+
+    if ((reg.flags & mb8art::RegisterFlags::OWN_LENGTH) == 0 &&
+        !validatePacketLength(length, mb8art::registerResponseBytes(reg), reg.name)) {
+        return false;
+    }
+
+    RegisterDecoder decoder = REGISTER_DECODERS[static_cast<uint8_t>(reg.id)];
+    if (!(this->*decoder)(data, length, address)) {
+        return false;
+    }
+
+    if (reg.initBits != 0) {
+        setInitializationBit(reg.initBits);
+    }
+    if (signalWaiters && (reg.flags & mb8art::RegisterFlags::SIGNAL_READY) && xTaskEventGroup) {
+        MB8ART_SRP_EVENT_GROUP_SET_BITS(xTaskEventGroup, DATA_READY_BIT);
+    }
+    return true;
+}
+
+bool MB8ART::decodeConnectionStatus(const uint8_t* data, size_t length, uint16_t address) {
+    (void)address;
+    LOG_MB8ART_DEBUG_NL("Connection status data received!");
+    handleConnectionStatus(data, length);
+    return true;
+}
+
+bool MB8ART::decodeTemperatures(const uint8_t* data, size_t length, uint16_t address) {
+    (void)address;
+    MB8ART_PERF_START(temp_processing);
+
+    // Update global timestamp for fast path
+    lastGlobalDataUpdate = xTaskGetTickCount();
+
+    LOG_MB8ART_DEBUG_NL("Temperature data packet received, length=%d", length);
+
+    // Confirm the current measurement range
+    LOG_MB8ART_DEBUG_NL("Current Measurement Range: %s",
+                     (currentRange == mb8art::MeasurementRange::HIGH_RES) ? "HIGH_RES" : "LOW_RES");
+
+    // Validate packet length
+    if (!validatePacketLength(length, EXPECTED_TEMPERATURE_PACKET_LENGTH, "Temperature Data")) {
+        // Set error bits for all sensors (interleaved format)
+        commitSensorEventBits(mb8art::ALL_SENSOR_ERROR_BITS, 0);
+        
+        // Notify tasks of error
+        MB8ART_EVENT_GROUP_SET_BITS_FAST(xTaskEventGroup, DATA_ERROR_BIT);
+        if (dataReceiverTask) {
+            xTaskNotify(dataReceiverTask, DATA_ERROR_BIT, eSetBits);
+        }
+        return false;
+    }
+
+    EventBits_t updateBitsToSet = 0;
+    EventBits_t errorBitsToSet = 0;
+    EventBits_t errorBitsToClear = 0;
+    char statusBuffer[256];  // Thread-local buffer for thread safety
+    statusBuffer[0] = '\0';  // Clear buffer
+    
+    processTemperatureData(data, length, updateBitsToSet, errorBitsToSet, 
+                          errorBitsToClear, statusBuffer, sizeof(statusBuffer));
+    
+    updateEventBits(updateBitsToSet, errorBitsToSet, errorBitsToClear);
+    
+    // DATA_READY and DATA_ERROR for waiting tasks in one kernel call
+    EventBits_t taskBits = (updateBitsToSet ? DATA_READY_BIT : 0) |
+                           (errorBitsToSet ? DATA_ERROR_BIT : 0);
+    if (taskBits) {
+        MB8ART_EVENT_GROUP_SET_BITS_FAST(xTaskEventGroup, taskBits);
+    }
+
+    // Direct notification to data receiver
+    if (updateBitsToSet) {
+        notifyDataReceiver();
+    }
+    if (errorBitsToSet && dataReceiverTask) {
+        xTaskNotify(dataReceiverTask, DATA_ERROR_BIT, eSetBits);
+    }
+    
+    // Only log if there's something to log
+    if (statusBuffer[0] != '\0') {
+        LOG_MB8ART_DEBUG_NL("%s", statusBuffer);
+    }
+
+    MB8ART_PERF_END(temp_processing, "Temperature processing");
+    return true;
+}
+
+bool MB8ART::decodeEquipmentStatus(const uint8_t* data, size_t length, uint16_t address) {
+    (void)length;
+    (void)address;
+    moduleSettings.equipmentStatus = mb8art::registerWord(data, 0);
+    LOG_MB8ART_DEBUG_NL("Equipment status: 0x%04X", moduleSettings.equipmentStatus);
+    return true;
+}
+
+bool MB8ART::decodeModuleTemperature(const uint8_t* data, size_t length, uint16_t address) {
+    (void)length;
+    (void)address;
+    // Signed tenths of °C (the module is rated down to -20 °C)
+    int16_t rawTemperature = static_cast<int16_t>(mb8art::registerWord(data, 0));
+    moduleSettings.moduleTemperature = rawTemperature * 0.1f;
+    moduleSettings.isTemperatureValid = true;
+    LOG_MB8ART_DEBUG_NL("Module Temperature successfully read: %.1f°C", moduleSettings.moduleTemperature);
+    return true;
+}
+
+bool MB8ART::decodeProductVersion(const uint8_t* data, size_t length, uint16_t address) {
+    (void)length;
+    (void)address;
+    moduleSettings.productVersion = mb8art::registerWord(data, 0);
+    LOG_MB8ART_DEBUG_NL("Product version: HW %d, SW %d",
+                       mb8art::productHardwareVersion(moduleSettings.productVersion),
+                       mb8art::productSoftwareVersion(moduleSettings.productVersion));
+    return true;
+}
+
+bool MB8ART::decodeModuleBatch(const uint8_t* data, size_t length, uint16_t address) {
+    (void)length;
+    LOG_MB8ART_DEBUG_NL("Processing batch configuration data");
+
+    // Registers 70-72, each through its own decoder; reserved 73-74 skipped.
+    // An out-of-range baud rate or parity is logged but does not fail the
+    // batch - the measurement range is what initialization waits for
+    decodeRs485Address(data, 2, address);
+    decodeBaudRate(data + 2, 2, address + 1);
+    decodeParity(data + 4, 2, address + 2);
+
+    // Measurement range - MB8ART device quirk:
+    // In batch reads, the value appears at register 75 (bytes 10-11)
+    // even though single register reads show it at register 76
+    LOG_MB8ART_DEBUG_NL("Value at reg 76: 0x%04X", mb8art::registerWord(data, 6));
+    bool ok = decodeMeasurementRange(data + 10, 2, address + 5);
+
+    LOG_MB8ART_DEBUG_NL("Batch config received - Range: %s, Addr: %d, Baud: %s",
+                      (currentRange == mb8art::MeasurementRange::HIGH_RES) ? "HIGH_RES" : "LOW_RES",
+                      moduleSettings.rs485Address,
+                      baudRateToString(getBaudRateEnum(moduleSettings.baudRate)).c_str());
+    return ok;
+}
+
+bool MB8ART::decodeRs485Address(const uint8_t* data, size_t length, uint16_t address) {
+    (void)length;
+    (void)address;
+    uint16_t rawAddress = mb8art::registerWord(data, 0);
+    moduleSettings.rs485Address = rawAddress & 0xFF;  // Only low byte is used
+    LOG_MB8ART_DEBUG_NL("RS485 Address successfully read: %d (raw: 0x%04X)", moduleSettings.rs485Address, rawAddress);
+    return true;
+}
+
+bool MB8ART::decodeBaudRate(const uint8_t* data, size_t length, uint16_t address) {
+    (void)length;
+    (void)address;
+    uint16_t rawBaudRate = mb8art::registerWord(data, 0);
+    if (rawBaudRate > MAX_BAUD_RATE_VALUE) {
+        LOG_MB8ART_ERROR_NL("Invalid Baud Rate value: %d", rawBaudRate);
+        return false;
+    }
+    moduleSettings.baudRate = rawBaudRate;
+    LOG_MB8ART_DEBUG_NL("RS485 Baud Rate successfully read: %s",
+                     baudRateToString(getBaudRateEnum(rawBaudRate)).c_str());
+    return true;
+}
+
+bool MB8ART::decodeParity(const uint8_t* data, size_t length, uint16_t address) {
+    (void)length;
+    (void)address;
+    uint16_t rawParity = mb8art::registerWord(data, 0);
+    if (rawParity > MAX_PARITY_VALUE) {
+        LOG_MB8ART_ERROR_NL("Invalid Parity value: %d", rawParity);
+        return false;
+    }
+    moduleSettings.parity = rawParity;
+    LOG_MB8ART_DEBUG_NL("RS485 Parity successfully read: %s",
+                     parityToString(getParityEnum(rawParity)).c_str());
+    return true;
+}
+
+bool MB8ART::decodeMeasurementRange(const uint8_t* data, size_t length, uint16_t address) {
+    (void)length;
+    (void)address;
+    uint16_t rawRange = mb8art::registerWord(data, 0);
+    currentRange = static_cast<mb8art::MeasurementRange>(rawRange & 0x01);
+    LOG_MB8ART_DEBUG_NL("Measurement Range successfully read: %s (raw: 0x%04X)",
+                     (currentRange == mb8art::MeasurementRange::HIGH_RES) ? "HIGH_RES" : "LOW_RES", rawRange);
+    return true;
+}
+
+bool MB8ART::decodeChannelConfig(const uint8_t* data, size_t length, uint16_t address) {
+    uint8_t channelStart = address - CHANNEL_CONFIG_REGISTER_START;
+    LOG_MB8ART_DEBUG_NL("Channel configuration packet received, starting at channel %d, length=%d", 
+                       channelStart, length);
+    if (length == 0 || length % 2 != 0 || (channelStart + length / 2) > DEFAULT_NUMBER_OF_SENSORS) {
+        LOG_MB8ART_WARN_NL("Invalid channel config packet: start=%d, length=%d", 
+                          channelStart, length);
+        return false;
+    }
+
+    for (uint8_t i = 0; i < length / 2; i++) {
+        processChannelConfig(channelStart + i, mb8art::registerWord(data, i));
+    }
+    
+    // During initialization, handle both single and multi-channel reads
+    if (!statusFlags.initialized) {
+        // Mark channels as configured
+        int numChannels = length / 2;
+        for (int ch = 0; ch < numChannels; ch++) {
+            channelsConfiguredDuringInit |= (1 << (channelStart + ch));
+        }
+        
+        LOG_MB8ART_DEBUG_NL("Configured %d channel(s) starting at %d during init", 
+                           numChannels, channelStart);
+        
+        // Check if we've received all 8 channels
+        if (channelsConfiguredDuringInit == 0xFF) {  // All 8 bits set
+            LOG_MB8ART_DEBUG_NL("All channels configured during init (0x%02X)", 
+                              channelsConfiguredDuringInit);
+            setInitializationBit(InitBits::CHANNEL_CONFIG);
+        } else {
+            LOG_MB8ART_DEBUG_NL("Channels configured so far: 0x%02X", 
+                               channelsConfiguredDuringInit);
+        }
+    } else if (channelStart == 0 && length == (DEFAULT_NUMBER_OF_SENSORS * 2)) {
+        // All channels in one response (normal operation)
+        LOG_MB8ART_DEBUG_NL("All %d channels configured in single response", DEFAULT_NUMBER_OF_SENSORS);
+        setInitializationBit(InitBits::CHANNEL_CONFIG);
+        MB8ART_SRP_EVENT_GROUP_SET_BITS(xTaskEventGroup, DATA_READY_BIT);
+    } else if (channelStart + length / 2 == DEFAULT_NUMBER_OF_SENSORS) {
+        // Multi-packet that completes at channel 8
+        LOG_MB8ART_DEBUG_NL("Channel configuration complete (multi-packet)");
+        setInitializationBit(InitBits::CHANNEL_CONFIG);
+    }
+    return true;
+}
+
+
+
 
 // Implementation of handleSensorError with char buffer
 void MB8ART::handleSensorError(int sensorIndex, char* statusBuffer, size_t bufferSize, int& offset) {
-    sensorReadings[sensorIndex].isTemperatureValid = false;
-    sensorReadings[sensorIndex].Error = true;
+    sensorState.setValid(sensorIndex, false);
+    sensorState.setError(sensorIndex, true);
 
     // Mark sensor as disconnected on error
     setSensorConnected(sensorIndex, false);
@@ -449,49 +479,27 @@ void MB8ART::handleSensorError(int sensorIndex, char* statusBuffer, size_t buffe
         }
     }
 
-    // Throttle error logging to once per 30 seconds per channel to prevent log flooding
-    // Thread-safe access to static throttle array
-    static uint32_t lastErrorLogTime[DEFAULT_NUMBER_OF_SENSORS] = {0};
-    uint32_t now = xTaskGetTickCount();
-
-    taskENTER_CRITICAL(&errorLogThrottleMutex);
-    bool shouldLog = (now - lastErrorLogTime[sensorIndex] > pdMS_TO_TICKS(30000));
-    if (shouldLog) {
-        lastErrorLogTime[sensorIndex] = now;
-    }
-    taskEXIT_CRITICAL(&errorLogThrottleMutex);
-
-    if (shouldLog) {
-        LOG_MB8ART_ERROR_NL("Sensor %d: Error encountered", sensorIndex);
-    }
+    // Rate limited per channel and per instance (default once per 30 s)
+    LOG_MB8ART_ERROR_LIMITED(logLimiters[mb8art::sensorErrorSite(sensorIndex)],
+                             "Sensor %d: Error encountered", sensorIndex);
 }
 
 
 
 
 bool MB8ART::validateChannelConfig(uint8_t channelMode, uint8_t subType) {
-    if (channelMode > static_cast<uint8_t>(mb8art::ChannelMode::CURRENT)) {
+    if (mb8art::findChannelMode(channelMode) == nullptr) {
         LOG_MB8ART_ERROR_NL("Invalid channel mode: 0x%02X", channelMode);
         return false;
     }
 
-    static const std::unordered_map<mb8art::ChannelMode, uint8_t> maxSubTypes = {
-        {mb8art::ChannelMode::THERMOCOUPLE, static_cast<uint8_t>(mb8art::ThermocoupleType::TYPE_N)},
-        {mb8art::ChannelMode::PT_INPUT, static_cast<uint8_t>(mb8art::PTType::CU100)},
-        {mb8art::ChannelMode::VOLTAGE, static_cast<uint8_t>(mb8art::VoltageRange::V_1)},
-        {mb8art::ChannelMode::CURRENT, static_cast<uint8_t>(mb8art::CurrentRange::MA_4_TO_20)},
-        {mb8art::ChannelMode::DEACTIVATED, 0}
-    };
-
-    auto mode = static_cast<mb8art::ChannelMode>(channelMode);
-    auto it = maxSubTypes.find(mode);
-    if (it != maxSubTypes.end() && subType <= it->second) {
+    if (mb8art::findSubType(channelMode, subType) != nullptr) {
         return true;
     }
 
     LOG_MB8ART_ERROR_NL("Invalid subtype 0x%02X for mode %s", 
                         subType, 
-                        mb8art::channelModeToString(mode));
+                        mb8art::channelModeToString(static_cast<mb8art::ChannelMode>(channelMode)));
     return false;
 }
 
@@ -499,19 +507,22 @@ bool MB8ART::validateChannelConfig(uint8_t channelMode, uint8_t subType) {
 
 
 bool MB8ART::hasModbusResponseCallback() const {
-    return static_cast<bool>(modbusResponseCallback);
+    return modbusResponseCallback != nullptr;
 }
 
 
 
 
-void MB8ART::invokeModbusResponseCallback(uint8_t functionCode, const uint8_t* data, uint16_t length) const {
- 
-    LOG_MB8ART_DEBUG_NL("Inside MB8ART::invokeModbusResponseCallback...");
-    LOG_MB8ART_DEBUG_NL("modbusResponseCallback is set: %s", modbusResponseCallback ? "Yes" : "No");
-
-    if (modbusResponseCallback) {
-        modbusResponseCallback(functionCode, data, length);
+void MB8ART::invokeModbusResponseCallback(const mb8art::ModbusFrame& frame) const {
+    // Callback and context are registered as a pair - snapshot them together
+    // so a concurrent re-registration never mixes one's callback with the
+    // other's context. The callback runs outside the lock.
+    taskENTER_CRITICAL(&channelStateMux);
+    mb8art::ModbusResponseCallback callback = modbusResponseCallback;
+    void* context = modbusResponseCallbackContext;
+    taskEXIT_CRITICAL(&channelStateMux);
+    if (callback != nullptr) {
+        callback(context, frame);
     }
 }
 
@@ -530,47 +541,67 @@ bool MB8ART::validatePacketLength(size_t receivedLength, size_t expectedLength,
 
 
 
-void MB8ART::handleModbusError(ModbusError error) {
-    // Record error with automatic categorization for diagnostics
-    auto category = modbus::ModbusErrorTracker::categorizeError(error);
-    modbus::ModbusErrorTracker::recordError(getServerAddress(), category);
-
-    // Use the helper for consistent, descriptive error messages
-    LOG_MB8ART_ERROR_NL("Modbus error: %s (0x%02X)",
-                        getModbusErrorString(error),
-                        static_cast<int>(error));
+static mb8art::BusEvent classifyBusError(ModbusError error) {
+    switch (error) {
+        case ModbusError::TIMEOUT:
+            return mb8art::BusEvent::TIMEOUT;
+        case ModbusError::CRC_ERROR:
+            return mb8art::BusEvent::CRC_ERROR;
+        case ModbusError::ILLEGAL_FUNCTION:
+        case ModbusError::ILLEGAL_DATA_ADDRESS:
+        case ModbusError::ILLEGAL_DATA_VALUE:
+        case ModbusError::SLAVE_DEVICE_FAILURE:
+            return mb8art::BusEvent::EXCEPTION;
+        default:
+            return mb8art::BusEvent::OTHER_ERROR;
+    }
+}
 
-    // Device-specific handling for certain errors
-    switch(error) {
+static const char* modbusErrorHint(ModbusError error) {
+    // Device-specific advice; other errors are described by getModbusErrorString()
+    switch (error) {
         case ModbusError::TIMEOUT:
-            // Additional timeout-specific logic
-            LOG_MB8ART_ERROR_NL("Device may be offline - check power and connections");
-            break;
-        
+            return " - device may be offline, check power and connections";
         case ModbusError::CRC_ERROR:
-            // Additional CRC error handling
-            LOG_MB8ART_ERROR_NL("Check RS485 wiring and termination resistors");
-            break;
-            
+            return " - check RS485 wiring and termination resistors";
         case ModbusError::ILLEGAL_DATA_ADDRESS:
-            // Handle invalid register address
-            LOG_MB8ART_ERROR_NL("Invalid register address - check device documentation");
-            break;
-            
+            return " - invalid register address, check device documentation";
         case ModbusError::SLAVE_DEVICE_FAILURE:
-            // Device reported internal error
-            LOG_MB8ART_ERROR_NL("Device reported internal failure - may need reset");
-            break;
-            
+            return " - device reported internal failure, may need reset";
         default:
-            // Other errors already have descriptions from getModbusErrorString()
-            break;
+            return "";
     }
-    
+}
+
+void MB8ART::handleModbusError(ModbusError error) {
+    // Errors carry no function code. One that answers an outstanding polling
+    // read ends it: take the temperature read's stamp, so a later error (or a
+    // late reply) is never timed against the same request. Errors of
+    // synchronous/config reads leave both the stamp and the in-flight count.
+    bool pollingError = busMetrics.errorSettlesRequest();
+    uint32_t requestedUs = pollingError ? pendingRequestUs.exchange(0, std::memory_order_relaxed) : 0;
+    if (traceBuffer != nullptr) {
+        // The error name rides along as payload so decoders need no copy of ModbusError
+        const char* name = getModbusErrorString(error);
+        traceTransaction(mb8art::TraceKind::ERROR, 0, 0, static_cast<uint8_t>(error),
+                         reinterpret_cast<const uint8_t*>(name), name != nullptr ? strlen(name) : 0,
+                         getLatencyTimeUs(), requestedUs);
+    }
+
+    busMetrics.record(classifyBusError(error), pollingError);
+
+    // Record error with automatic categorization for diagnostics
+    auto category = modbus::ModbusErrorTracker::categorizeError(error);
+    modbus::ModbusErrorTracker::recordError(getServerAddress(), category);
+
     // Set error bits for all sensors (interleaved format)
     setErrorEventBits(mb8art::ALL_SENSOR_ERROR_BITS);
-}
 
+    // One rate-limited line with the hint; a dead bus would otherwise log
+    // two lines per poll
+    LOG_MB8ART_ERROR_LIMITED(logLimiters[mb8art::LogSite::MODBUS_ERROR], "Modbus error: %s (0x%02X)%s",
+                             getModbusErrorString(error), static_cast<int>(error), modbusErrorHint(error));
+}
 
 
 
@@ -605,11 +636,8 @@ void MB8ART::handleConnectionStatus(const uint8_t* data, size_t length) {
         }
     }
 
-    if (errorBitsToSet) {
-        setErrorEventBits(errorBitsToSet);
-    }
-    if (errorBitsToClear) {
-        clearErrorEventBits(errorBitsToClear);
+    if ((errorBitsToSet | errorBitsToClear) && xSensorEventGroup) {
+        commitSensorEventBits(errorBitsToSet, errorBitsToClear);
     }
     
     // Update cache timestamp since we just received fresh connection status
@@ -620,11 +648,12 @@ void MB8ART::handleConnectionStatus(const uint8_t* data, size_t length) {
 
 
 void MB8ART::handleDisconnection() {
-    LOG_MB8ART_ERROR_NL("Device connection lost: %d", getServerAddress());
+    LOG_MB8ART_ERROR_LIMITED(logLimiters[mb8art::LogSite::CONNECTION_LOST],
+                             "Device connection lost: %d", getServerAddress());
     setErrorEventBits(mb8art::ALL_SENSOR_ERROR_BITS);
     for (int i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
-        sensorReadings[i].isTemperatureValid = false;
-        sensorReadings[i].Error = true;
+        sensorState.setValid(i, false);
+        sensorState.setError(i, true);
     }
 }
 
@@ -0,0 +1,245 @@
+#ifndef MB8ART_PROFILER_H
+#define MB8ART_PROFILER_H
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+
+#if defined(ESP_PLATFORM)
+    #include "esp_idf_version.h"
+    #include "esp_cpu.h"
+    #include "esp_rom_sys.h"
+#else
+    #include <chrono>
+#endif
+
+/**
+ * @file MB8ARTProfiler.h
+ * @brief Always-on scoped profiler with a static table of named counters
+ *
+ * Time is read from the CPU cycle counter on target (one register read) and
+ * from std::chrono::steady_clock in nanoseconds on the host. A scope adds its
+ * duration to a named counter (count, total, max) - three relaxed atomic
+ * updates, no logging, no locks. Counters are claimed from a fixed table the
+ * first time a name is used; call sites cache the pointer in a function-local
+ * static, so the name lookup runs once per site.
+ *
+ * The cycle counter wraps after 2^32 cycles (~17.9 s at 240 MHz) and the host
+ * clock after ~4.3 s; longer scopes are not measured correctly.
+ */
+
+// Enable the profiler (0 compiles MB8ART_PERF_* / MB8ART_PROFILE_SCOPE away)
+#ifndef MB8ART_PROFILER
+    #ifdef PROJECT_MB8ART_PROFILER
+        #define MB8ART_PROFILER PROJECT_MB8ART_PROFILER
+    #else
+        #define MB8ART_PROFILER 1
+    #endif
+#endif
+
+// Number of distinct counter names (~16 bytes each)
+#ifndef MB8ART_PROFILER_SLOTS
+    #ifdef PROJECT_MB8ART_PROFILER_SLOTS
+        #define MB8ART_PROFILER_SLOTS PROJECT_MB8ART_PROFILER_SLOTS
+    #else
+        #define MB8ART_PROFILER_SLOTS 16
+    #endif
+#endif
+
+static_assert(MB8ART_PROFILER_SLOTS > 0 && MB8ART_PROFILER_SLOTS <= 255,
+              "MB8ART_PROFILER_SLOTS must be 1..255");
+
+namespace mb8art {
+
+/**
+ * @brief Current time in profiler ticks (CPU cycles on target, ns on host)
+ */
+inline uint32_t profilerTicks() {
+#if defined(ESP_PLATFORM)
+    #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+    return static_cast<uint32_t>(esp_cpu_get_cycle_count());
+    #else
+    return static_cast<uint32_t>(esp_cpu_get_ccount());
+    #endif
+#else
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+inline uint32_t profilerTicksPerUs() {
+#if defined(ESP_PLATFORM)
+    return esp_rom_get_cpu_ticks_per_us();
+#else
+    return 1000;
+#endif
+}
+
+/**
+ * @brief Aggregates for one name, in profiler ticks
+ */
+struct ProfileEntry {
+    const char* name;
+    uint32_t count;
+    uint64_t totalTicks;
+    uint32_t maxTicks;
+};
+
+class ProfileCounter {
+public:
+    constexpr ProfileCounter() : name(nullptr), count(0), totalLow(0), totalHigh(0), maxTicks(0) {}
+
+    void add(uint32_t ticks) {
+        count.fetch_add(1, std::memory_order_relaxed);
+        // 64-bit total from two 32-bit atomics (64-bit atomics take a lock on Xtensa)
+        uint32_t before = totalLow.fetch_add(ticks, std::memory_order_relaxed);
+        if (static_cast<uint32_t>(before + ticks) < before) {
+            totalHigh.fetch_add(1, std::memory_order_relaxed);
+        }
+        uint32_t current = maxTicks.load(std::memory_order_relaxed);
+        while (ticks > current &&
+               !maxTicks.compare_exchange_weak(current, ticks, std::memory_order_relaxed)) {
+        }
+    }
+
+    ProfileEntry read() const {
+        ProfileEntry entry;
+        entry.name = name.load(std::memory_order_acquire);
+        entry.count = count.load(std::memory_order_relaxed);
+        uint32_t high;
+        uint32_t low;
+        do {
+            high = totalHigh.load(std::memory_order_relaxed);
+            low = totalLow.load(std::memory_order_relaxed);
+        } while (high != totalHigh.load(std::memory_order_relaxed));
+        entry.totalTicks = (static_cast<uint64_t>(high) << 32) | low;
+        entry.maxTicks = maxTicks.load(std::memory_order_relaxed);
+        return entry;
+    }
+
+    void reset() {
+        count.store(0, std::memory_order_relaxed);
+        totalLow.store(0, std::memory_order_relaxed);
+        totalHigh.store(0, std::memory_order_relaxed);
+        maxTicks.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    friend class Profiler;
+
+    std::atomic<const char*> name;  // nullptr = free slot
+    std::atomic<uint32_t> count;
+    std::atomic<uint32_t> totalLow;
+    std::atomic<uint32_t> totalHigh;
+    std::atomic<uint32_t> maxTicks;
+};
+
+class Profiler {
+public:
+    static constexpr uint8_t SLOTS = MB8ART_PROFILER_SLOTS;
+
+    /**
+     * @brief Counter for a name, claimed on first use
+     *
+     * name must have static storage duration (a string literal). Names are
+     * compared by content, so one name used in several places shares a
+     * counter. Returns nullptr when the table is full (the scope is then
+     * not recorded).
+     */
+    static ProfileCounter* counter(const char* name) {
+        ProfileCounter* slots = table();
+        for (uint8_t i = 0; i < SLOTS; i++) {
+            const char* current = slots[i].name.load(std::memory_order_acquire);
+            if (current == nullptr) {
+                if (slots[i].name.compare_exchange_strong(current, name, std::memory_order_acq_rel,
+                                                          std::memory_order_acquire)) {
+                    return &slots[i];
+                }
+                // Lost the race - current now holds the winner's name
+            }
+            if (current == name || strcmp(current, name) == 0) {
+                return &slots[i];
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Copy the used counters, in first-use order
+     * @return Number of entries written
+     */
+    static uint8_t snapshot(ProfileEntry* out, uint8_t maxEntries) {
+        ProfileCounter* slots = table();
+        uint8_t n = 0;
+        for (uint8_t i = 0; i < SLOTS && n < maxEntries; i++) {
+            if (slots[i].name.load(std::memory_order_acquire) == nullptr) {
+                break;  // Slots are claimed in order
+            }
+            out[n++] = slots[i].read();
+        }
+        return n;
+    }
+
+    // Zero all counters; names stay registered
+    static void reset() {
+        ProfileCounter* slots = table();
+        for (uint8_t i = 0; i < SLOTS; i++) {
+            slots[i].reset();
+        }
+    }
+
+    static uint32_t ticksToUs(uint64_t ticks) {
+        return static_cast<uint32_t>(ticks / profilerTicksPerUs());
+    }
+
+private:
+    static ProfileCounter* table() {
+        static ProfileCounter slots[SLOTS];
+        return slots;
+    }
+};
+
+/**
+ * @brief Measures from construction to stop() or destruction, once
+ */
+class ProfileTimer {
+public:
+    explicit ProfileTimer(ProfileCounter* target) : counter(target), start(profilerTicks()) {}
+    ~ProfileTimer() { stop(); }
+
+    ProfileTimer(const ProfileTimer&) = delete;
+    ProfileTimer& operator=(const ProfileTimer&) = delete;
+
+    // @return Elapsed ticks (0 if already stopped)
+    uint32_t stop() {
+        if (counter == nullptr) {
+            return 0;
+        }
+        uint32_t elapsed = profilerTicks() - start;
+        counter->add(elapsed);
+        counter = nullptr;
+        return elapsed;
+    }
+
+private:
+    ProfileCounter* counter;
+    uint32_t start;
+};
+
+} // namespace mb8art
+
+// Counter for a literal name, looked up once per call site
+#define MB8ART_PROFILE_COUNTER(name) \
+    ([]() -> mb8art::ProfileCounter* { \
+        static mb8art::ProfileCounter* const _counter = mb8art::Profiler::counter(name); \
+        return _counter; \
+    }())
+
+#if MB8ART_PROFILER
+    #define MB8ART_PROFILE_SCOPE(name) \
+        mb8art::ProfileTimer _profile_scope_##name(MB8ART_PROFILE_COUNTER(#name))
+#else
+    #define MB8ART_PROFILE_SCOPE(name) ((void)0)
+#endif
+
+#endif // MB8ART_PROFILER_H
@@ -0,0 +1,267 @@
+#ifndef MB8ART_PUBLISHER_H
+#define MB8ART_PUBLISHER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include "MB8ARTQuality.h"
+#include "MB8ARTLogLimiter.h"
+#include "MB8ARTExport.h"
+
+/**
+ * @file MB8ARTPublisher.h
+ * @brief Batched, deadband-filtered reading publisher (one message per frame)
+ *
+ * Fed once per decoded frame. Channels whose value moved by at least their
+ * deadband since they were last published, or whose quality code or divider
+ * changed, are batched into one CBOR message encoded in the publisher's own buffer
+ * and handed to a transport callback (e.g. an MQTT client enqueue). Frames
+ * with no change publish nothing.
+ *
+ * Message (CBOR map):
+ *   0: Modbus address   1: sequence   2: time ms
+ *   3: map channel -> [value, quality code, divider], or null once deactivated
+ *   4: true on a full refresh (first message, heartbeat, after a failure)
+ *
+ * Values are absolute fixed point, value / divider = °C or the channel's
+ * engineering unit (as in MB8ARTExport.h); only the set of
+ * channels is delta-coded, so a lost message never corrupts later ones.
+ * Changes held back by the per-topic rate limit are merged into the next
+ * message with their latest values. Every heartbeatMs a full refresh goes
+ * out even without changes.
+ *
+ * Single writer: MB8ART offers frames from the decode path and from
+ * timeouts, never both at once; getStats() may be called from any task.
+ */
+
+namespace mb8art {
+
+// Returns false if the message was not accepted (counted, retried as full refresh)
+typedef bool (*PublishCallback)(void* context, const char* topic, const uint8_t* payload, size_t length);
+
+struct PublisherStats {
+    uint32_t messages = 0;          // Handed to the transport
+    uint32_t bytes = 0;
+    uint32_t channelsPublished = 0; // Channel entries across all messages
+    uint32_t unchangedFrames = 0;   // Nothing beyond the deadband
+    uint32_t rateLimited = 0;       // Frames with changes held back by the rate limit
+    uint32_t failures = 0;          // Transport refused the message
+};
+
+class ReadingPublisher {
+public:
+    static constexpr uint8_t CHANNELS = 8;
+    // Worst case: header 22 + 8 × (key 1 + array 1 + value 5 + code 2 + divider 3) + full flag 2
+    static constexpr size_t BUFFER_BYTES = 120;
+
+    ReadingPublisher(const char* topic, PublishCallback callback, void* context, uint8_t address = 0)
+        : topic(topic), callback(callback), context(context), address(address),
+          heartbeatMs(60000), lastPublishMs(0), sequence(0), publishedMask(0), pendingMask(0),
+          forceFull(true), messages(0), bytes(0), channelsPublished(0), unchangedFrames(0),
+          rateLimited(0), failures(0) {
+        for (uint8_t i = 0; i < CHANNELS; i++) {
+            deadband[i] = 1;
+            lastValue[i] = 0;
+            lastDivider[i] = BINDING_TEMPERATURE_DIVIDER;
+            lastCode[i] = QualityCode::BAD_NO_DATA;
+        }
+        limiter.configure(LogRate{1000, 1});
+    }
+
+    ReadingPublisher(const ReadingPublisher&) = delete;
+    ReadingPublisher& operator=(const ReadingPublisher&) = delete;
+
+    // Minimum change (binding units) that triggers a publish; 0 = every frame
+    void setDeadband(uint8_t channel, uint16_t units) {
+        if (channel < CHANNELS) {
+            deadband[channel] = units;
+        }
+    }
+    void setDeadband(uint16_t units) {
+        for (uint8_t i = 0; i < CHANNELS; i++) {
+            deadband[i] = units;
+        }
+    }
+
+    // Per-topic rate limit: `burst` messages, then one per intervalMs (0 = unlimited)
+    void setRateLimit(uint32_t intervalMs, uint8_t burst = 1) {
+        limiter.configure(LogRate{intervalMs, burst != 0 ? burst : static_cast<uint8_t>(1)});
+    }
+
+    // Full refresh interval, 0 = only on the first message and after failures
+    void setHeartbeat(uint32_t intervalMs) { heartbeatMs = intervalMs; }
+
+    void setAddress(uint8_t moduleAddress) { address = moduleAddress; }
+    const char* getTopic() const { return topic; }
+
+    /**
+     * @brief Offer one decoded frame
+     * @param activeMask Bit per channel that is not deactivated
+     * @param values Binding values, one per channel
+     * @param codes Quality codes, one per channel
+     * @param dividers value / divider = °C or engineering units, one per channel
+     * @return true if a message was published for this frame
+     */
+    bool offerFrame(uint32_t nowMs, uint8_t activeMask, const int32_t* values, const QualityCode* codes,
+                    const int16_t* dividers) {
+        for (uint8_t i = 0; i < CHANNELS; i++) {
+            latestValue[i] = values[i];
+            latestDivider[i] = dividers[i];
+            latestCode[i] = codes[i];
+        }
+        latestActive = activeMask;
+
+        bool heartbeat = heartbeatMs != 0 && lastPublishMs != 0 &&
+                         static_cast<uint32_t>(nowMs - lastPublishMs) >= heartbeatMs;
+        bool full = forceFull || heartbeat;
+        pendingMask |= changedChannels();
+
+        if (!full && pendingMask == 0) {
+            bump(unchangedFrames);
+            return false;
+        }
+
+        uint32_t held = 0;
+        if (!limiter.allow(nowMs, held)) {
+            bump(rateLimited);
+            return false;
+        }
+
+        uint8_t mask = full ? static_cast<uint8_t>(latestActive | publishedMask) : pendingMask;
+        size_t length = encode(nowMs, mask, full);
+        if (length == 0 || !callback(context, topic, buffer, length)) {
+            bump(failures);
+            forceFull = true;  // Receiver state unknown: resend everything
+            return false;
+        }
+
+        // Commit what the receiver now holds
+        for (uint8_t i = 0; i < CHANNELS; i++) {
+            if (mask & (1u << i)) {
+                lastValue[i] = latestValue[i];
+                lastDivider[i] = latestDivider[i];
+                lastCode[i] = latestCode[i];
+            }
+        }
+        publishedMask = static_cast<uint8_t>((publishedMask | (mask & latestActive)) & latestActive);
+        pendingMask = 0;
+        forceFull = false;
+        lastPublishMs = nowMs != 0 ? nowMs : 1;
+        sequence++;
+        bump(messages);
+        bytes.fetch_add(static_cast<uint32_t>(length), std::memory_order_relaxed);
+        channelsPublished.fetch_add(static_cast<uint32_t>(popcount(mask)), std::memory_order_relaxed);
+        return true;
+    }
+
+    PublisherStats getStats() const {
+        PublisherStats stats;
+        stats.messages = messages.load(std::memory_order_relaxed);
+        stats.bytes = bytes.load(std::memory_order_relaxed);
+        stats.channelsPublished = channelsPublished.load(std::memory_order_relaxed);
+        stats.unchangedFrames = unchangedFrames.load(std::memory_order_relaxed);
+        stats.rateLimited = rateLimited.load(std::memory_order_relaxed);
+        stats.failures = failures.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    // Next offerFrame() publishes a full refresh (e.g. after an MQTT reconnect)
+    void requestFullRefresh() { forceFull = true; }
+
+private:
+    uint8_t changedChannels() const {
+        uint8_t changed = 0;
+        for (uint8_t i = 0; i < CHANNELS; i++) {
+            uint8_t bit = static_cast<uint8_t>(1u << i);
+            bool active = (latestActive & bit) != 0;
+            if (active != ((publishedMask & bit) != 0)) {
+                changed |= bit;  // Activated, or deactivated (published as null)
+                continue;
+            }
+            if (!active) {
+                continue;
+            }
+            int64_t delta = static_cast<int64_t>(latestValue[i]) - lastValue[i];
+            uint64_t magnitude = static_cast<uint64_t>(delta < 0 ? -delta : delta);
+            // A new divider rescales the value even if the raw number barely moved
+            if (latestCode[i] != lastCode[i] || latestDivider[i] != lastDivider[i] || magnitude >= deadband[i]) {
+                changed |= bit;
+            }
+        }
+        return changed;
+    }
+
+    size_t encode(uint32_t nowMs, uint8_t mask, bool full) {
+        CborWriter w(buffer, sizeof(buffer));
+        w.map(full ? 5 : 4);
+        w.uint(0); w.uint(address);
+        w.uint(1); w.uint(sequence);
+        w.uint(2); w.uint(nowMs);
+        w.uint(3);
+        w.map(popcount(mask));
+        for (uint8_t i = 0; i < CHANNELS; i++) {
+            if ((mask & (1u << i)) == 0) {
+                continue;
+            }
+            w.uint(i);
+            if (latestActive & (1u << i)) {
+                w.array(3);
+                w.sint(latestValue[i]);
+                w.uint(static_cast<uint8_t>(latestCode[i]));
+                w.sint(latestDivider[i]);
+            } else {
+                w.null();
+            }
+        }
+        if (full) {
+            w.uint(4); w.boolean(true);
+        }
+        return w.size();
+    }
+
+    static uint8_t popcount(uint8_t mask) {
+        uint8_t n = 0;
+        for (; mask != 0; mask &= static_cast<uint8_t>(mask - 1)) {
+            n++;
+        }
+        return n;
+    }
+    static void bump(std::atomic<uint32_t>& counter) { counter.fetch_add(1, std::memory_order_relaxed); }
+
+    const char* topic;
+    PublishCallback callback;
+    void* context;
+    uint8_t address;
+    uint32_t heartbeatMs;
+    LogLimiter limiter;
+
+    // What the receiver last got, per channel
+    int32_t lastValue[CHANNELS];
+    int16_t lastDivider[CHANNELS];
+    QualityCode lastCode[CHANNELS];
+    uint16_t deadband[CHANNELS];
+
+    // Latest frame
+    int32_t latestValue[CHANNELS];
+    int16_t latestDivider[CHANNELS];
+    QualityCode latestCode[CHANNELS];
+    uint8_t latestActive = 0;
+
+    uint32_t lastPublishMs;         // 0 = never
+    uint32_t sequence;
+    uint8_t publishedMask;          // Channels the receiver holds a value for
+    uint8_t pendingMask;            // Changes not yet published (rate limited)
+    bool forceFull;
+    uint8_t buffer[BUFFER_BYTES];
+
+    std::atomic<uint32_t> messages;
+    std::atomic<uint32_t> bytes;
+    std::atomic<uint32_t> channelsPublished;
+    std::atomic<uint32_t> unchangedFrames;
+    std::atomic<uint32_t> rateLimited;
+    std::atomic<uint32_t> failures;
+};
+
+} // namespace mb8art
+
+#endif // MB8ART_PUBLISHER_H
@@ -0,0 +1,67 @@
+#ifndef MB8ART_QUALITY_H
+#define MB8ART_QUALITY_H
+
+#include <stdint.h>
+
+/**
+ * @file MB8ARTQuality.h
+ * @brief Per-sample quality codes (OPC UA style, one byte)
+ *
+ * The top two bits carry the severity (00 GOOD, 01 UNCERTAIN, 10 BAD), the
+ * low six bits say why. Consumers can branch on the severity alone or
+ * report the exact reason without re-deriving it from SensorReading flags
+ * and event bits.
+ */
+
+namespace mb8art {
+
+enum class ReadingQuality : uint8_t {
+    GOOD = 0,
+    UNCERTAIN = 1,
+    BAD = 2
+};
+
+enum class QualityCode : uint8_t {
+    GOOD = 0x00,
+    GOOD_FILTERED = 0x01,           // Accepted sample, smoothed by the filter chain
+    GOOD_HELD = 0x02,               // Last good value, still within the GOOD age
+
+    UNCERTAIN_HELD = 0x40,          // Last good value, aging
+    UNCERTAIN_EXTRAPOLATED = 0x41,  // Last good value projected along its slope
+    UNCERTAIN_REJECTED = 0x42,      // Newest sample dropped by the spike rejector
+
+    BAD_NO_DATA = 0x80,             // No good sample since start/reset
+    BAD_SENSOR_OPEN = 0x81,         // Module reported 0x7530 (open circuit / fault)
+    BAD_OUT_OF_RANGE = 0x82,        // Sample outside the measurable range
+    BAD_DEACTIVATED = 0x83,         // Channel mode is DEACTIVATED
+    BAD_TIMEOUT = 0x84              // No response, or held value aged out
+};
+
+inline ReadingQuality qualitySeverity(QualityCode code) {
+    return static_cast<ReadingQuality>(static_cast<uint8_t>(code) >> 6);
+}
+
+inline bool isQualityUsable(QualityCode code) {
+    return qualitySeverity(code) != ReadingQuality::BAD;
+}
+
+inline const char* qualityCodeToString(QualityCode code) {
+    switch (code) {
+        case QualityCode::GOOD: return "GOOD";
+        case QualityCode::GOOD_FILTERED: return "GOOD_FILTERED";
+        case QualityCode::GOOD_HELD: return "GOOD_HELD";
+        case QualityCode::UNCERTAIN_HELD: return "UNCERTAIN_HELD";
+        case QualityCode::UNCERTAIN_EXTRAPOLATED: return "UNCERTAIN_EXTRAPOLATED";
+        case QualityCode::UNCERTAIN_REJECTED: return "UNCERTAIN_REJECTED";
+        case QualityCode::BAD_NO_DATA: return "BAD_NO_DATA";
+        case QualityCode::BAD_SENSOR_OPEN: return "BAD_SENSOR_OPEN";
+        case QualityCode::BAD_OUT_OF_RANGE: return "BAD_OUT_OF_RANGE";
+        case QualityCode::BAD_DEACTIVATED: return "BAD_DEACTIVATED";
+        case QualityCode::BAD_TIMEOUT: return "BAD_TIMEOUT";
+        default: return "UNKNOWN";
+    }
+}
+
+} // namespace mb8art
+
+#endif // MB8ART_QUALITY_H
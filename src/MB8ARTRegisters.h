@@ -0,0 +1,225 @@
+#ifndef MB8ART_REGISTERS_H
+#define MB8ART_REGISTERS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @file MB8ARTRegisters.h
+ * @brief Compile-time register map: request parameters and response dispatch
+ *
+ * Every register block the driver reads is one REGISTER_MAP line (see
+ * HARDWARE.md): function code, start address, register count, the init bits
+ * a successful decode completes and a few flags. Requests take their address
+ * and count from here, and responses are routed back through a dispatch
+ * array generated from the same table at compile time, indexed by
+ * (function code, start address) - one load, no switch.
+ *
+ * The decoder for each RegisterId is bound in MB8ARTModbus.cpp; adding a
+ * register is a RegisterId, a table line and a decoder.
+ */
+
+namespace mb8art {
+
+// In REGISTER_MAP order - checked below
+enum class RegisterId : uint8_t {
+    CONNECTION_STATUS = 0,  // Discrete inputs 0-7
+    TEMPERATURES,           // Input registers 0-7
+    EQUIPMENT_STATUS,       // 65: bit 4 reset button, bit 0 reset request
+    MODULE_TEMPERATURE,     // 67: tenths of °C
+    PRODUCT_VERSION,        // 68: high byte HW, low byte SW
+    MODULE_BATCH,           // 70-76 in one read (measurement range quirk, see decoder)
+    RS485_ADDRESS,          // 70
+    BAUD_RATE,              // 71
+    PARITY,                 // 72
+    MEASUREMENT_RANGE,      // 76
+    CHANNEL_CONFIG,         // 128-135
+    COUNT
+};
+
+// Modbus function codes used by the map
+static constexpr uint8_t REGISTER_FC_DISCRETE_INPUTS = 2;
+static constexpr uint8_t REGISTER_FC_HOLDING = 3;
+static constexpr uint8_t REGISTER_FC_INPUT = 4;
+
+// Same values as MB8ART::InitBits (checked in MB8ARTModbus.cpp)
+struct RegisterInit {
+    static constexpr uint8_t NONE = 0;
+    static constexpr uint8_t MEASUREMENT_RANGE = (1 << 0);
+    static constexpr uint8_t CHANNEL_CONFIG = (1 << 1);
+    static constexpr uint8_t DEVICE_RESPONSIVE = (1 << 2);
+};
+
+struct RegisterFlags {
+    static constexpr uint8_t NONE = 0;
+    static constexpr uint8_t SPAN = (1 << 0);          // Reads may start at any register of the block
+    static constexpr uint8_t OWN_LENGTH = (1 << 1);    // Decoder checks the length itself
+    static constexpr uint8_t SIGNAL_READY = (1 << 2);  // DATA_READY to waiting tasks after an async decode
+};
+
+struct RegisterDescriptor {
+    RegisterId id;
+    const char* name;
+    uint8_t functionCode;
+    uint16_t address;
+    uint8_t count;              // Registers (or inputs) per read
+    uint8_t initBits;           // RegisterInit bits set after a successful decode
+    uint8_t flags;              // RegisterFlags
+    RegisterId fallback;        // Decoded instead when the length is not count's; COUNT = none
+};
+
+static constexpr RegisterDescriptor REGISTER_MAP[] = {
+    {RegisterId::CONNECTION_STATUS, "connection status", REGISTER_FC_DISCRETE_INPUTS, 0, 8,
+     RegisterInit::NONE, RegisterFlags::NONE, RegisterId::COUNT},
+    {RegisterId::TEMPERATURES, "temperatures", REGISTER_FC_INPUT, 0, 8,
+     RegisterInit::NONE, RegisterFlags::OWN_LENGTH, RegisterId::COUNT},
+    {RegisterId::EQUIPMENT_STATUS, "equipment status", REGISTER_FC_HOLDING, 65, 1,
+     RegisterInit::NONE, RegisterFlags::SIGNAL_READY, RegisterId::COUNT},
+    {RegisterId::MODULE_TEMPERATURE, "module temperature", REGISTER_FC_HOLDING, 67, 1,
+     RegisterInit::NONE, RegisterFlags::SIGNAL_READY, RegisterId::COUNT},
+    {RegisterId::PRODUCT_VERSION, "product version", REGISTER_FC_HOLDING, 68, 1,
+     RegisterInit::NONE, RegisterFlags::SIGNAL_READY, RegisterId::COUNT},
+    {RegisterId::MODULE_BATCH, "module settings", REGISTER_FC_HOLDING, 70, 7,
+     RegisterInit::MEASUREMENT_RANGE, RegisterFlags::SIGNAL_READY, RegisterId::RS485_ADDRESS},
+    {RegisterId::RS485_ADDRESS, "RS485 address", REGISTER_FC_HOLDING, 70, 1,
+     RegisterInit::NONE, RegisterFlags::SIGNAL_READY, RegisterId::COUNT},
+    {RegisterId::BAUD_RATE, "baud rate", REGISTER_FC_HOLDING, 71, 1,
+     RegisterInit::NONE, RegisterFlags::SIGNAL_READY, RegisterId::COUNT},
+    {RegisterId::PARITY, "parity", REGISTER_FC_HOLDING, 72, 1,
+     RegisterInit::NONE, RegisterFlags::SIGNAL_READY, RegisterId::COUNT},
+    {RegisterId::MEASUREMENT_RANGE, "measurement range", REGISTER_FC_HOLDING, 76, 1,
+     RegisterInit::MEASUREMENT_RANGE, RegisterFlags::SIGNAL_READY, RegisterId::COUNT},
+    {RegisterId::CHANNEL_CONFIG, "channel config", REGISTER_FC_HOLDING, 128, 8,
+     RegisterInit::NONE, RegisterFlags::SPAN | RegisterFlags::OWN_LENGTH, RegisterId::COUNT},
+};
+static constexpr size_t REGISTER_COUNT = sizeof(REGISTER_MAP) / sizeof(REGISTER_MAP[0]);
+
+// Largest block, for stack buffers holding one response
+static constexpr uint8_t MAX_REGISTER_BLOCK = 8;
+
+constexpr const RegisterDescriptor& registerDescriptor(RegisterId id) {
+    return REGISTER_MAP[static_cast<uint8_t>(id)];
+}
+
+// Response payload size for a full read of the block
+constexpr size_t registerResponseBytes(const RegisterDescriptor& reg) {
+    return reg.functionCode == REGISTER_FC_DISCRETE_INPUTS ? (reg.count + 7u) / 8u : reg.count * 2u;
+}
+
+// Big-endian register `index` of a response payload
+inline uint16_t registerWord(const uint8_t* data, size_t index) {
+    return static_cast<uint16_t>((data[index * 2] << 8) | data[index * 2 + 1]);
+}
+
+/**
+ * @brief Parameters of the read for one block (or one register of a SPAN block)
+ */
+struct RegisterRequest {
+    uint8_t functionCode;
+    uint16_t address;
+    uint16_t count;
+};
+
+constexpr RegisterRequest registerRequest(RegisterId id) {
+    return RegisterRequest{registerDescriptor(id).functionCode, registerDescriptor(id).address,
+                           registerDescriptor(id).count};
+}
+
+constexpr RegisterRequest registerRequest(RegisterId id, uint8_t offset) {
+    return RegisterRequest{registerDescriptor(id).functionCode,
+                           static_cast<uint16_t>(registerDescriptor(id).address + offset), 1};
+}
+
+// Product version (register 68): 0xHHSS
+constexpr uint8_t productHardwareVersion(uint16_t raw) { return static_cast<uint8_t>(raw >> 8); }
+constexpr uint8_t productSoftwareVersion(uint16_t raw) { return static_cast<uint8_t>(raw & 0xFF); }
+
+// ============================================================================
+// Dispatch array, generated from REGISTER_MAP
+// ============================================================================
+
+static constexpr uint8_t DISPATCH_FIRST_FC = REGISTER_FC_DISCRETE_INPUTS;
+static constexpr uint8_t DISPATCH_FC_COUNT = REGISTER_FC_INPUT - REGISTER_FC_DISCRETE_INPUTS + 1;
+static constexpr uint16_t DISPATCH_ADDRESSES = 136;    // 0 .. last channel config register
+static constexpr uint8_t NO_REGISTER = 0xFF;
+
+namespace detail {
+
+// std::index_sequence is C++14
+template <size_t... I> struct IndexList {};
+template <size_t N, size_t... I> struct MakeIndexList : MakeIndexList<N - 1, N - 1, I...> {};
+template <size_t... I> struct MakeIndexList<0, I...> { typedef IndexList<I...> type; };
+
+constexpr bool registerCovers(const RegisterDescriptor& reg, uint8_t fc, uint16_t address) {
+    return reg.functionCode == fc &&
+           (address == reg.address ||
+            ((reg.flags & RegisterFlags::SPAN) != 0 && address > reg.address && address < reg.address + reg.count));
+}
+
+// First descriptor covering (fc, address); later ones at the same start are fallbacks
+constexpr uint8_t dispatchEntry(uint8_t fc, uint16_t address, size_t i) {
+    return i == REGISTER_COUNT ? NO_REGISTER
+           : registerCovers(REGISTER_MAP[i], fc, address) ? static_cast<uint8_t>(i)
+           : dispatchEntry(fc, address, i + 1);
+}
+
+constexpr uint8_t dispatchSlot(size_t slot) {
+    return dispatchEntry(static_cast<uint8_t>(DISPATCH_FIRST_FC + slot / DISPATCH_ADDRESSES),
+                         static_cast<uint16_t>(slot % DISPATCH_ADDRESSES), 0);
+}
+
+template <typename List> struct DispatchArray;
+template <size_t... I> struct DispatchArray<IndexList<I...> > {
+    static constexpr uint8_t slots[sizeof...(I)] = {dispatchSlot(I)...};
+};
+template <size_t... I> constexpr uint8_t DispatchArray<IndexList<I...> >::slots[sizeof...(I)];
+
+typedef DispatchArray<MakeIndexList<DISPATCH_FC_COUNT * DISPATCH_ADDRESSES>::type> RegisterDispatch;
+
+constexpr bool registerMapOrdered(size_t i) {
+    return i == REGISTER_COUNT ||
+           (static_cast<size_t>(REGISTER_MAP[i].id) == i && registerMapOrdered(i + 1));
+}
+
+// Each block fits a stack buffer, lies inside the dispatch array and is
+// reachable - directly or as its predecessor's fallback
+constexpr bool registerMapValid(size_t i) {
+    return i == REGISTER_COUNT ||
+           (REGISTER_MAP[i].count >= 1 && REGISTER_MAP[i].count <= MAX_REGISTER_BLOCK &&
+            REGISTER_MAP[i].functionCode >= DISPATCH_FIRST_FC &&
+            REGISTER_MAP[i].functionCode < DISPATCH_FIRST_FC + DISPATCH_FC_COUNT &&
+            REGISTER_MAP[i].address + REGISTER_MAP[i].count <= DISPATCH_ADDRESSES &&
+            (dispatchEntry(REGISTER_MAP[i].functionCode, REGISTER_MAP[i].address, 0) == i ||
+             (i > 0 && REGISTER_MAP[i - 1].fallback == REGISTER_MAP[i].id)) &&
+            registerMapValid(i + 1));
+}
+
+} // namespace detail
+
+static_assert(REGISTER_COUNT == static_cast<size_t>(RegisterId::COUNT), "REGISTER_MAP must list every RegisterId");
+static_assert(detail::registerMapOrdered(0), "REGISTER_MAP must be in RegisterId order");
+static_assert(detail::registerMapValid(0), "REGISTER_MAP entry out of range or unreachable");
+
+/**
+ * @brief Descriptor for a response, or nullptr if no block matches
+ * @param length Payload bytes; selects the fallback when it does not match a full block
+ */
+inline const RegisterDescriptor* findRegister(uint8_t functionCode, uint16_t address, size_t length) {
+    if (functionCode < DISPATCH_FIRST_FC || functionCode >= DISPATCH_FIRST_FC + DISPATCH_FC_COUNT ||
+        address >= DISPATCH_ADDRESSES) {
+        return nullptr;
+    }
+    uint8_t index = detail::RegisterDispatch::slots[(functionCode - DISPATCH_FIRST_FC) * DISPATCH_ADDRESSES + address];
+    if (index == NO_REGISTER) {
+        return nullptr;
+    }
+    const RegisterDescriptor* reg = &REGISTER_MAP[index];
+    if (reg->fallback != RegisterId::COUNT && length != registerResponseBytes(*reg)) {
+        reg = &registerDescriptor(reg->fallback);
+    }
+    return reg;
+}
+
+} // namespace mb8art
+
+#endif // MB8ART_REGISTERS_H
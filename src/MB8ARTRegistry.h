@@ -0,0 +1,163 @@
+#ifndef MB8ART_REGISTRY_H
+#define MB8ART_REGISTRY_H
+
+#include <stdint.h>
+#include <atomic>
+
+/**
+ * @file MB8ARTRegistry.h
+ * @brief Lock-free registry of live driver instances
+ *
+ * A fixed array of atomic pointers. Registration claims a free slot with a
+ * compare-exchange, removal clears it the same way; lookups are a bounded
+ * scan of acquire loads, so they are wait-free and never block on a task
+ * that is registering or removing a module.
+ *
+ * Two tasks adding the same instance at once can each claim a slot. After
+ * claiming, an adder rescans and clears every slot holding the instance
+ * except the lowest; the claim and the rescan are seq_cst, so of two racing
+ * adders at least one sees both slots, and exactly one slot survives.
+ *
+ * Lifetime: the registry does not own instances. A pointer returned by a
+ * lookup stays valid as long as the instance does - remove an instance
+ * before destroying it (MB8ART does this in cleanup()) and do not destroy
+ * modules that other tasks may still be using.
+ */
+
+// Maximum number of MB8ART modules registered at the same time
+#ifndef MB8ART_MAX_INSTANCES
+    #ifdef PROJECT_MB8ART_MAX_INSTANCES
+        #define MB8ART_MAX_INSTANCES PROJECT_MB8ART_MAX_INSTANCES
+    #else
+        #define MB8ART_MAX_INSTANCES 4
+    #endif
+#endif
+
+static_assert(MB8ART_MAX_INSTANCES > 0 && MB8ART_MAX_INSTANCES <= 32,
+              "MB8ART_MAX_INSTANCES must be 1..32");
+
+namespace mb8art {
+
+template <typename T, uint8_t Capacity>
+class InstanceRegistry {
+public:
+    // Constant-initialized: safe to use from other static constructors
+    constexpr InstanceRegistry() : slots() {}
+
+    InstanceRegistry(const InstanceRegistry&) = delete;
+    InstanceRegistry& operator=(const InstanceRegistry&) = delete;
+
+    /**
+     * @return true if the instance is registered (already or now), false if full
+     */
+    bool add(T* instance) {
+        if (instance == nullptr) {
+            return false;
+        }
+        if (contains(instance)) {
+            return true;
+        }
+        for (uint8_t i = 0; i < Capacity; i++) {
+            T* expected = nullptr;
+            if (slots[i].compare_exchange_strong(expected, instance,
+                                                 std::memory_order_seq_cst,
+                                                 std::memory_order_relaxed)) {
+                releaseDuplicates(instance);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @return true if the instance was registered
+     */
+    bool remove(T* instance) {
+        if (instance == nullptr) {
+            return false;
+        }
+        bool removed = false;
+        for (uint8_t i = 0; i < Capacity; i++) {
+            T* expected = instance;
+            if (slots[i].compare_exchange_strong(expected, nullptr,
+                                                 std::memory_order_acq_rel,
+                                                 std::memory_order_relaxed)) {
+                removed = true;
+            }
+        }
+        return removed;
+    }
+
+    bool contains(const T* instance) const {
+        for (uint8_t i = 0; i < Capacity; i++) {
+            if (slots[i].load(std::memory_order_acquire) == instance) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @return Registered instance in the lowest slot, nullptr if empty
+     */
+    T* first() const {
+        for (uint8_t i = 0; i < Capacity; i++) {
+            T* instance = slots[i].load(std::memory_order_acquire);
+            if (instance != nullptr) {
+                return instance;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief First registered instance for which match(instance) is true
+     */
+    template <typename Predicate>
+    T* find(Predicate match) const {
+        for (uint8_t i = 0; i < Capacity; i++) {
+            T* instance = slots[i].load(std::memory_order_acquire);
+            if (instance != nullptr && match(*instance)) {
+                return instance;
+            }
+        }
+        return nullptr;
+    }
+
+    uint8_t count() const {
+        uint8_t n = 0;
+        for (uint8_t i = 0; i < Capacity; i++) {
+            if (slots[i].load(std::memory_order_relaxed) != nullptr) {
+                n++;
+            }
+        }
+        return n;
+    }
+
+    static constexpr uint8_t capacity() { return Capacity; }
+
+private:
+    // Keep the lowest slot holding the instance, clear the others
+    void releaseDuplicates(T* instance) {
+        bool kept = false;
+        for (uint8_t i = 0; i < Capacity; i++) {
+            if (slots[i].load(std::memory_order_seq_cst) != instance) {
+                continue;
+            }
+            if (!kept) {
+                kept = true;
+                continue;
+            }
+            T* expected = instance;
+            slots[i].compare_exchange_strong(expected, nullptr,
+                                             std::memory_order_seq_cst,
+                                             std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic<T*> slots[Capacity];
+};
+
+} // namespace mb8art
+
+#endif // MB8ART_REGISTRY_H
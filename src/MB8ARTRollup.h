@@ -0,0 +1,251 @@
+#ifndef MB8ART_ROLLUP_H
+#define MB8ART_ROLLUP_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+/**
+ * @file MB8ARTRollup.h
+ * @brief Multi-resolution min/max/mean rollups for long-horizon trends
+ *
+ * Each accepted sample is folded into one bucket per tier (e.g. 1 s, 1 min,
+ * 1 h). Every tier is a fixed ring of buckets; the oldest bucket is reused
+ * when a new period starts, so ingest is O(number of tiers) and memory is
+ * fixed at 16 bytes per bucket.
+ *
+ * Time is given in whole seconds since boot by the caller (MB8ART uses
+ * esp_timer), so the rollup never wraps in practice.
+ *
+ * Single writer. query() takes no lock: it retries the copy if the writer
+ * started a new bucket meanwhile.
+ *
+ * @code
+ * // 1 min of 1 s, 1 h of 1 min, 1 week of 1 h = 4.6 KB
+ * static mb8art::StaticRollup<60, 60, 168> boilerReturn;
+ * mb8art->attachRollup(3, &boilerReturn);
+ *
+ * mb8art::RollupPoint points[200];
+ * size_t n = boilerReturn.query(now - 7 * 86400, now, 200, points, 200);
+ * @endcode
+ */
+
+namespace mb8art {
+
+struct RollupBucket {
+    uint32_t period;   // Start time / tier resolution (bucket number)
+    int32_t sum;
+    int16_t min;
+    int16_t max;
+    uint16_t count;    // Mean uses the first 65535 samples of a bucket
+};
+
+struct RollupTier {
+    uint32_t resolutionSec;
+    uint16_t capacity;
+    RollupBucket* buckets;
+    uint16_t head;     // Next bucket to write
+    uint16_t size;     // Buckets in use
+};
+
+struct RollupPoint {
+    uint32_t startSec;
+    int16_t min;
+    int16_t max;
+    int16_t mean;      // Rounded to the nearest count
+    uint16_t count;
+};
+
+class RollupSeries {
+public:
+    RollupSeries(RollupTier* tierArray, uint8_t count) : tiers(tierArray), tierCount(count) {}
+
+    RollupSeries(const RollupSeries&) = delete;
+    RollupSeries& operator=(const RollupSeries&) = delete;
+
+    /**
+     * @brief Fold one sample into every tier
+     */
+    void add(uint32_t timeSec, int16_t value) {
+        beginWrite();
+        for (uint8_t t = 0; t < tierCount; t++) {
+            RollupTier& tier = tiers[t];
+            uint32_t period = timeSec / tier.resolutionSec;
+
+            RollupBucket* current = (tier.size != 0) ? &tier.buckets[lastIndex(tier)] : nullptr;
+            if (current != nullptr && current->period == period) {
+                if (value < current->min) current->min = value;
+                if (value > current->max) current->max = value;
+                if (current->count != UINT16_MAX) {
+                    current->sum += value;
+                    current->count++;
+                }
+                continue;
+            }
+
+            // New period: reuse the oldest bucket once the ring is full
+            RollupBucket& bucket = tier.buckets[tier.head];
+            bucket.period = period;
+            bucket.sum = value;
+            bucket.min = value;
+            bucket.max = value;
+            bucket.count = 1;
+            tier.head = (tier.head + 1 < tier.capacity) ? tier.head + 1 : 0;
+            if (tier.size < tier.capacity) {
+                tier.size++;
+            }
+        }
+        endWrite();
+    }
+
+    void clear() {
+        beginWrite();
+        for (uint8_t t = 0; t < tierCount; t++) {
+            tiers[t].head = 0;
+            tiers[t].size = 0;
+        }
+        endWrite();
+    }
+
+    uint8_t getTierCount() const { return tierCount; }
+    uint32_t getTierResolution(uint8_t tier) const {
+        return (tier < tierCount) ? tiers[tier].resolutionSec : 0;
+    }
+
+    /**
+     * @brief Choose the tier for a query
+     *
+     * Returns the finest tier that still has data back to fromSec and needs
+     * at most maxPoints buckets for the range - i.e. never coarser than the
+     * budget requires. Falls back to the coarsest tier.
+     */
+    uint8_t selectTier(uint32_t fromSec, uint32_t toSec, uint16_t maxPoints) const {
+        for (uint8_t t = 0; t < tierCount; t++) {
+            const RollupTier& tier = tiers[t];
+            uint32_t points = toSec / tier.resolutionSec - fromSec / tier.resolutionSec + 1;
+            if (points > maxPoints) {
+                continue;
+            }
+            // A ring that never wrapped holds everything recorded so far
+            if (tier.size < tier.capacity) {
+                return t;
+            }
+            uint32_t oldestPeriod = tier.buckets[tier.head].period;
+            if (oldestPeriod <= fromSec / tier.resolutionSec) {
+                return t;
+            }
+        }
+        return tierCount - 1;
+    }
+
+    /**
+     * @brief Copy buckets overlapping [fromSec, toSec], oldest first
+     * @param maxPoints Point budget; if even the coarsest tier exceeds it,
+     *        the newest maxPoints buckets are returned
+     * @param tierUsed Optional: receives the selected tier index
+     * @return Number of points written to out
+     */
+    size_t query(uint32_t fromSec, uint32_t toSec, uint16_t maxPoints,
+                 RollupPoint* out, size_t outCapacity, uint8_t* tierUsed = nullptr) const {
+        if (tierCount == 0 || out == nullptr || fromSec > toSec || maxPoints == 0) {
+            return 0;
+        }
+        size_t limit = (outCapacity < maxPoints) ? outCapacity : maxPoints;
+
+        uint8_t t;
+        size_t written;
+        uint32_t before;
+        do {
+            before = sequence.load(std::memory_order_acquire);
+            t = selectTier(fromSec, toSec, maxPoints);
+            written = copyRange(tiers[t], fromSec, toSec, out, limit);
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while ((before & 1) != 0 || sequence.load(std::memory_order_relaxed) != before);
+
+        if (tierUsed != nullptr) {
+            *tierUsed = t;
+        }
+        return written;
+    }
+
+private:
+    static uint16_t lastIndex(const RollupTier& tier) {
+        return (tier.head == 0) ? tier.capacity - 1 : tier.head - 1;
+    }
+
+    static size_t copyRange(const RollupTier& tier, uint32_t fromSec, uint32_t toSec,
+                            RollupPoint* out, size_t limit) {
+        uint32_t firstPeriod = fromSec / tier.resolutionSec;
+        uint32_t lastPeriod = toSec / tier.resolutionSec;
+
+        // Count matches first so an over-budget range keeps the newest buckets
+        uint16_t start = (tier.size < tier.capacity) ? 0 : tier.head;
+        size_t matches = 0;
+        for (uint16_t i = 0; i < tier.size; i++) {
+            const RollupBucket& b = tier.buckets[(start + i) % tier.capacity];
+            if (b.period >= firstPeriod && b.period <= lastPeriod) {
+                matches++;
+            }
+        }
+        size_t skip = (matches > limit) ? matches - limit : 0;
+
+        size_t written = 0;
+        for (uint16_t i = 0; i < tier.size && written < limit; i++) {
+            const RollupBucket& b = tier.buckets[(start + i) % tier.capacity];
+            if (b.period < firstPeriod || b.period > lastPeriod) {
+                continue;
+            }
+            if (skip != 0) {
+                skip--;
+                continue;
+            }
+            RollupPoint& p = out[written++];
+            p.startSec = b.period * tier.resolutionSec;
+            p.min = b.min;
+            p.max = b.max;
+            p.count = b.count;
+            int32_t half = b.count / 2;
+            p.mean = static_cast<int16_t>((b.sum >= 0 ? b.sum + half : b.sum - half) / b.count);
+        }
+        return written;
+    }
+
+    void beginWrite() {
+        sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    void endWrite() {
+        std::atomic_thread_fence(std::memory_order_release);
+        sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    RollupTier* tiers;
+    uint8_t tierCount;
+    std::atomic<uint32_t> sequence{0};
+};
+
+/**
+ * @brief Three-tier rollup (1 s / 1 min / 1 h) with inline storage, no heap
+ */
+template <uint16_t SecondBuckets, uint16_t MinuteBuckets, uint16_t HourBuckets>
+class StaticRollup : public RollupSeries {
+    static_assert(SecondBuckets > 0 && MinuteBuckets > 0 && HourBuckets > 0,
+                  "StaticRollup tiers need at least one bucket");
+public:
+    StaticRollup() : RollupSeries(tierStorage, 3) {
+        tierStorage[0] = RollupTier{1, SecondBuckets, seconds, 0, 0};
+        tierStorage[1] = RollupTier{60, MinuteBuckets, minutes, 0, 0};
+        tierStorage[2] = RollupTier{3600, HourBuckets, hours, 0, 0};
+    }
+
+private:
+    RollupTier tierStorage[3];
+    RollupBucket seconds[SecondBuckets];
+    RollupBucket minutes[MinuteBuckets];
+    RollupBucket hours[HourBuckets];
+};
+
+} // namespace mb8art
+
+#endif // MB8ART_ROLLUP_H
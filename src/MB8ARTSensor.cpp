@@ -12,16 +12,16 @@
 
 using namespace mb8art;
 
-// Spinlock for thread-safe access to static log throttle array
-// Currently unused but reserved for future throttled logging feature
-[[maybe_unused]] static portMUX_TYPE logThrottleMutex = portMUX_INITIALIZER_UNLOCKED;
-
 // MB8ART specific methods
 bool MB8ART::requestTemperatures() {
     // Prevent polling if device is offline or not initialized
     if (!statusFlags.initialized || statusFlags.moduleOffline) {
         LOG_MB8ART_DEBUG_NL("requestTemperatures blocked - device %s", 
                            statusFlags.moduleOffline ? "offline" : "not initialized");
+        if (statusFlags.moduleOffline) {
+            // Nobody waits for data while offline - age held values here instead
+            ageSilentChannels(static_cast<uint8_t>(activeChannelMask));
+        }
         return false;
     }
     
@@ -52,9 +52,10 @@ int16_t MB8ART::applyTemperatureCorrection(int16_t temperature) {
 
 void MB8ART::markChannelDeactivated(uint8_t channel, EventBits_t& errorBitsToSet, 
                                    char* statusBuffer, size_t bufferSize, int& offset) {
-    sensorReadings[channel].isTemperatureValid = false;
-    sensorReadings[channel].Error = false;  // deactivated channels are no error
+    sensorState.setValid(channel, false);
+    sensorState.setError(channel, false);  // deactivated channels are no error
     setSensorConnected(channel, false);  // deactivated channels are not connected
+    holdChannel(channel, mb8art::QualityCode::BAD_DEACTIVATED);
     
     int remaining = bufferSize - offset - 1;
     if (remaining > 0) {
@@ -100,21 +101,57 @@ void MB8ART::processTemperatureData(const uint8_t* data, size_t length,
         // alarms when outside temperature was near freezing.
         if (rawData == 0x7530) {
             handleSensorError(i, statusBuffer, bufferSize, offset);
+            resetChannelFilter(i);
+            holdChannel(i, mb8art::QualityCode::BAD_SENSOR_OPEN);
+            evaluateChannelAlarms(i, false, true, 0);
+            // The frame arrived - update bit with the error bit, so waitForData()
+            // does not count a channel fault as a bus timeout
+            updateBitsToSet |= mb8art::SENSOR_UPDATE_BITS[i];
             errorBitsToSet |= mb8art::SENSOR_ERROR_BITS[i];
-            sensorReadings[i].lastCommandSuccess = false;
-            sensorReadings[i].isStateConfirmed = false;
+            sensorState.setCommandOk(i, false);
+            sensorState.setConfirmed(i, false);
             continue;
         }
 
         // Process valid data for active channels
+        syncChannelContext(i);
         int16_t sensorValue = processChannelData(i, rawData);
+        rawValues[i] = sensorValue;
+
+        // Drop implausible samples before they reach filter, bindings or event bits
+        if (rejectSample(i, sensorValue, statusBuffer, bufferSize, offset)) {
+            sensorState.setCommandOk(i, true);
+            holdChannel(i, mb8art::QualityCode::UNCERTAIN_REJECTED);
+            evaluateChannelAlarms(i, false, false, 0);
+            updateBitsToSet |= mb8art::SENSOR_UPDATE_BITS[i];
+            continue;
+        }
+        sensorState.setRejected(i, false);
+
+        sensorValue = applyChannelFilter(i, sensorValue);
+        updateEngineeringValue(i, sensorValue);
         updateSensorReading(i, sensorValue, updateBitsToSet, errorBitsToSet,
                           errorBitsToClear, statusBuffer, bufferSize, offset);
 
         // Update tracking info
-        sensorReadings[i].lastCommandSuccess = true;
-        sensorReadings[i].isStateConfirmed = true;
+        sensorState.setCommandOk(i, true);
+        sensorState.setConfirmed(i, true);
+
+        evaluateChannelAlarms(i, sensorState.isValid(i),
+                              false, sensorState.temperature[i]);
+    }
+
+    // Alarm bits are published with the frame's other event bits (updateEventBits)
+
+    if (historyBuffer != nullptr) {
+        recordHistoryFrame();
+    }
+
+#ifdef MB8ART_ENABLE_MQTT
+    if (readingPublisher != nullptr) {
+        publishFrame();
     }
+#endif
     
     MB8ART_PERF_END(process_temp_data, "Temperature data processing");
 }
@@ -122,6 +159,218 @@ void MB8ART::processTemperatureData(const uint8_t* data, size_t length,
 
 
 
+void MB8ART::recordHistoryFrame() {
+    mb8art::QualityCode quality[DEFAULT_NUMBER_OF_SENSORS];
+    for (uint8_t i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
+        quality[i] = channelSnapshots[i].code;
+    }
+    historyBuffer->append(xTaskGetTickCount(), sensorState.validMask,
+                          sensorState.temperature, quality);
+}
+
+#ifdef MB8ART_ENABLE_MQTT
+void MB8ART::publishFrame() {
+    // Called from the response path and from ageSilentChannels (task side).
+    // The publisher is single-writer; a frame offered while the other path
+    // is publishing is dropped - that one carries the same snapshots.
+    if (publishingFrame.exchange(true, std::memory_order_acquire)) {
+        return;
+    }
+
+    int32_t values[DEFAULT_NUMBER_OF_SENSORS];
+    mb8art::QualityCode codes[DEFAULT_NUMBER_OF_SENSORS];
+    int16_t dividers[DEFAULT_NUMBER_OF_SENSORS];
+    uint8_t activeMask = 0;
+    taskENTER_CRITICAL(&channelStateMux);
+    for (uint8_t i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
+        values[i] = channelSnapshots[i].value;
+        codes[i] = channelSnapshots[i].code;
+    }
+    taskEXIT_CRITICAL(&channelStateMux);
+    for (uint8_t i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
+        dividers[i] = getSnapshotDivider(i);
+        if (channelConfigs[i].mode != static_cast<uint16_t>(mb8art::ChannelMode::DEACTIVATED)) {
+            activeMask |= static_cast<uint8_t>(1u << i);
+        }
+    }
+    readingPublisher->offerFrame(static_cast<uint32_t>(pdTICKS_TO_MS(xTaskGetTickCount())),
+                                 activeMask, values, codes, dividers);
+    publishingFrame.store(false, std::memory_order_release);
+}
+#endif
+
+
+
+
+void MB8ART::evaluateChannelAlarms(uint8_t channel, bool hasValue, bool sensorOpen, int16_t value) {
+    if ((alarmConfiguredMask & (1 << channel)) == 0) {
+        return;
+    }
+
+    mb8art::AlarmInput input;
+    input.hasValue = hasValue;
+    input.sensorOpen = sensorOpen;
+    input.value = value;
+    input.nowMs = pdTICKS_TO_MS(xTaskGetTickCount());
+
+    mb8art::AlarmRule changedRules[MB8ART_MAX_ALARM_RULES];
+    taskENTER_CRITICAL(&channelStateMux);
+    mb8art::ChannelAlarms& alarms = channelAlarms[channel];
+    uint8_t changed = alarms.evaluate(input);
+    uint8_t active = alarms.getActiveMask();
+    for (uint8_t r = 0; r < MB8ART_MAX_ALARM_RULES; r++) {
+        if (changed & (1 << r)) {
+            changedRules[r] = alarms.getRule(r);
+        }
+    }
+    if (active) {
+        alarmActiveMask |= (1 << channel);
+    } else {
+        alarmActiveMask &= ~(1 << channel);
+    }
+    // setAlarmCallback() writes the pair under the same lock
+    mb8art::AlarmCallback callback = alarmCallback;
+    void* callbackContext = alarmCallbackContext;
+    taskEXIT_CRITICAL(&channelStateMux);
+
+    if (changed == 0) {
+        return;
+    }
+
+    // Callbacks run outside the critical section
+    for (uint8_t r = 0; r < MB8ART_MAX_ALARM_RULES; r++) {
+        if ((changed & (1 << r)) == 0) {
+            continue;
+        }
+        bool isActive = (active & (1 << r)) != 0;
+        LOG_MB8ART_WARN_NL("Channel %d alarm rule %d (type %d) %s, value %d",
+                          channel, r, static_cast<int>(changedRules[r].type),
+                          isActive ? "RAISED" : "cleared", value);
+        if (callback != nullptr) {
+            callback(callbackContext, channel, r, changedRules[r], isActive, value);
+        }
+    }
+}
+
+void MB8ART::evaluateStaleAlarms(uint8_t channelMask) {
+    // No sample for these channels - only STALE rules can change state
+    for (uint8_t i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
+        if (channelMask & (1 << i)) {
+            evaluateChannelAlarms(i, false, false, 0);
+        }
+    }
+    publishAlarmBits();
+}
+
+void MB8ART::recordChannelSnapshot(uint8_t channel, int32_t bindingValue) {
+    uint32_t nowMs = pdTICKS_TO_MS(xTaskGetTickCount());
+    mb8art::QualityCode code = channelFilters[channel].getConfig().isEnabled()
+                               ? mb8art::QualityCode::GOOD_FILTERED : mb8art::QualityCode::GOOD;
+    taskENTER_CRITICAL(&channelStateMux);
+    mb8art::recordGoodSample(channelSnapshots[channel], bindingValue, code, nowMs);
+    publishedSnapshots[channel].write(channelSnapshots[channel]);
+    taskEXIT_CRITICAL(&channelStateMux);
+
+    if (sensorBindings[channel].qualityPtr != nullptr) {
+        *sensorBindings[channel].qualityPtr = code;
+    }
+}
+
+void MB8ART::holdChannel(uint8_t channel, mb8art::QualityCode reason) {
+    // No usable sample this cycle - bindings get the held value or are invalidated
+    taskENTER_CRITICAL(&channelStateMux);
+    mb8art::ChannelSnapshot& snapshot = channelSnapshots[channel];
+    if (mb8art::recordMissedSample(snapshot, reason)) {
+        publishedSnapshots[channel].write(snapshot);
+    }
+    mb8art::ChannelSnapshot copy = snapshot;
+    taskEXIT_CRITICAL(&channelStateMux);
+
+    mb8art::HeldReading held = mb8art::evaluateHold(copy, pdTICKS_TO_MS(xTaskGetTickCount()));
+    bool usable = held.quality != mb8art::ReadingQuality::BAD;
+    if (usable) {
+        writeBoundValue(channel, held.value);
+    }
+    if (sensorBindings[channel].validityPtr != nullptr) {
+        *sensorBindings[channel].validityPtr = usable;
+    }
+    if (sensorBindings[channel].qualityPtr != nullptr) {
+        *sensorBindings[channel].qualityPtr = held.code;
+    }
+}
+
+void MB8ART::writeBoundValue(uint8_t channel, int32_t bindingValue) {
+    const mb8art::SensorBinding& binding = sensorBindings[channel];
+    if (!isAnalogChannel(channel)) {
+        if (binding.temperaturePtr != nullptr) {
+            *binding.temperaturePtr = static_cast<int16_t>(bindingValue);
+        }
+        return;
+    }
+    // Analog channels never write the tenths-of-°C slot
+    if (binding.analogPtr != nullptr) {
+        binding.analogPtr->value = bindingValue;
+        binding.analogPtr->divider = getEngineeringDivider(channel);
+        binding.analogPtr->unit =
+            engineeringScales[channel].isEnabled() ? mb8art::AnalogUnit::ENGINEERING
+            : (channelConfigs[channel].mode == static_cast<uint16_t>(mb8art::ChannelMode::VOLTAGE))
+                ? mb8art::AnalogUnit::MILLIVOLT : mb8art::AnalogUnit::MILLIAMP;
+    }
+}
+
+void MB8ART::ageSilentChannels(uint8_t channelMask) {
+    // No sample for these channels - STALE alarm rules and held values still
+    // need to age. Runs on waitForData() timeouts (missing channels only) and
+    // on every poll refused while offline, so bindings do not keep a frozen
+    // value marked valid
+    evaluateStaleAlarms(channelMask);
+    for (uint8_t i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
+        if ((channelMask & (1 << i)) &&
+            channelConfigs[i].mode != static_cast<uint16_t>(mb8art::ChannelMode::DEACTIVATED)) {
+            holdChannel(i, mb8art::QualityCode::BAD_TIMEOUT);
+        }
+    }
+
+#ifdef MB8ART_ENABLE_MQTT
+    // Held/BAD_TIMEOUT values and heartbeats go out without decoded frames too
+    if (readingPublisher != nullptr) {
+        publishFrame();
+    }
+#endif
+}
+
+void MB8ART::collectAlarmBits(EventBits_t& toSet, EventBits_t& toClear) {
+    // Alarm bits are level bits: every active alarm is (re)set, every other
+    // one cleared - sensorEvents drops clears of bits that are not set.
+    // Called from the response context and the task side, hence the mux.
+    taskENTER_CRITICAL(&channelStateMux);
+    uint8_t active = alarmActiveMask;
+    taskEXIT_CRITICAL(&channelStateMux);
+
+    for (uint8_t i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
+        if (active & (1 << i)) {
+            toSet |= mb8art::SENSOR_ALARM_BITS[i];
+        } else {
+            toClear |= mb8art::SENSOR_ALARM_BITS[i];
+        }
+    }
+}
+
+void MB8ART::publishAlarmBits() {
+    if (!xSensorEventGroup) {
+        return;
+    }
+    EventBits_t toSet = 0;
+    EventBits_t toClear = 0;
+    collectAlarmBits(toSet, toClear);
+    if (toSet | toClear) {
+        commitSensorEventBits(toSet, toClear);
+    }
+}
+
+
+
+
 int16_t MB8ART::processChannelData(uint8_t channel, uint16_t rawData) {
     mb8art::ChannelMode mode = static_cast<mb8art::ChannelMode>(channelConfigs[channel].mode);
 
@@ -150,6 +399,98 @@ int16_t MB8ART::processChannelData(uint8_t channel, uint16_t rawData) {
 
 
 
+bool MB8ART::isWithinValidRange(uint8_t channel, int16_t value) const {
+    // Range resolved by updateDecodePlan() when the channel context changed
+    return sensorState.isInPlanRange(channel, value);
+}
+
+void MB8ART::updateDecodePlan(uint8_t channel) {
+    // Thermocouple/analog ranges are fixed, RTD ranges follow the resolution mode
+    mb8art::ChannelScale scale = mb8art::channelScale(channelConfigs[channel].mode,
+                                                      channelConfigs[channel].subType, currentRange);
+    sensorState.validMin[channel] = scale.validMin;
+    sensorState.validMax[channel] = scale.validMax;
+}
+
+void MB8ART::syncChannelContext(uint8_t channel) {
+    // Identifies the unit/scale of a channel's samples - a change of mode,
+    // subtype or resolution resets all per-channel history so samples of
+    // different units are never blended
+    // Bit 15 marks a computed key so the zero-initialized key never matches
+    uint16_t key = static_cast<uint16_t>(0x8000 |
+                                         (channelConfigs[channel].mode << 8) |
+                                         (channelConfigs[channel].subType << 1) |
+                                         static_cast<uint8_t>(currentRange));
+    if (key != channelContextKeys[channel]) {
+        channelContextKeys[channel] = key;
+        updateDecodePlan(channel);
+        resetChannelFilter(channel);
+        resetChannelStatistics(channel);
+        resetChannelSnapshot(channel);
+    }
+}
+
+void MB8ART::updateChannelStatistics(uint8_t channel, int16_t value) {
+    mb8art::RollingStatistics& stats = channelStatistics[channel];
+    if (!stats.isEnabled()) {
+        return;
+    }
+    taskENTER_CRITICAL(&channelStateMux);
+    stats.push(value);
+    statisticsSnapshots[channel].write(stats.summary());
+    taskEXIT_CRITICAL(&channelStateMux);
+}
+
+bool MB8ART::rejectSample(uint8_t channel, int16_t value, char* statusBuffer,
+                          size_t bufferSize, int& offset) {
+    // Out-of-range samples are flagged as errors by updateSensorReading
+    if (!isWithinValidRange(channel, value)) {
+        return false;
+    }
+
+    uint32_t elapsedMs = sensorState.isValid(channel)
+        ? pdTICKS_TO_MS(xTaskGetTickCount() - sensorState.updatedAt[channel])
+        : UINT32_MAX;
+
+    taskENTER_CRITICAL(&channelStateMux);
+    mb8art::RejectReason reason = spikeRejectors[channel].check(value, elapsedMs);
+    taskEXIT_CRITICAL(&channelStateMux);
+
+    if (reason == mb8art::RejectReason::NONE) {
+        return false;
+    }
+
+    sensorState.setRejected(channel, true);
+    rejectedSamples[channel]++;
+
+    LOG_MB8ART_DEBUG_NL("Channel %d sample %d rejected (%s, last accepted %d)",
+                       channel, value,
+                       reason == mb8art::RejectReason::SLEW_RATE ? "slew" : "unconfirmed jump",
+                       sensorState.temperature[channel]);
+
+    int remaining = bufferSize - offset - 1;
+    if (remaining > 0) {
+        int written = snprintf(statusBuffer + offset, remaining, "C%d: REJ; ", channel);
+        if (written > 0 && written < remaining) {
+            offset += written;
+        }
+    }
+    return true;
+}
+
+int16_t MB8ART::applyChannelFilter(uint8_t channel, int16_t value) {
+    // Out-of-range samples are rejected downstream - keep them out of the
+    // filter state so a glitch does not bleed into later readings
+    if (!isWithinValidRange(channel, value)) {
+        return value;
+    }
+
+    taskENTER_CRITICAL(&channelStateMux);
+    int16_t filtered = channelFilters[channel].apply(value);
+    taskEXIT_CRITICAL(&channelStateMux);
+    return filtered;
+}
+
 void MB8ART::updateSensorReading(uint8_t channel, int16_t value,
                                EventBits_t& updateBitsToSet,
                                EventBits_t& errorBitsToSet,
@@ -157,105 +498,75 @@ void MB8ART::updateSensorReading(uint8_t channel, int16_t value,
                                char* statusBuffer,
                                size_t bufferSize,
                                int& offset) {
-    // Value format depends on currentRange:
-    // - LOW_RES: tenths (244 = 24.4°C)
-    // - HIGH_RES: hundredths (2440 = 24.40°C)
+    // Value is in the channel's fixed-point unit (channelScale divider):
+    // tenths or hundredths of °C for temperature inputs, per-range units for
+    // voltage/current. Only RTD inputs follow the resolution register.
 
-    // Validate range based on resolution mode
-    bool isHighRes = (currentRange == mb8art::MeasurementRange::HIGH_RES);
-    int16_t minValid = isHighRes ? -20000 : -2000;  // -200.00°C or -200.0°C
-    int16_t maxValid = isHighRes ? 85000 : 8500;    // 850.00°C or 850.0°C
+    int16_t divider = getChannelDivider(channel);
+    bool isAnalog = isAnalogChannel(channel);
 
-    if (value >= minValid && value <= maxValid) {
+    if (isWithinValidRange(channel, value)) {
         // Store raw value in internal readings (preserves full resolution)
-        sensorReadings[channel].temperature = value;
-        sensorReadings[channel].isTemperatureValid = true;
+        sensorState.temperature[channel] = value;
+        sensorState.setValid(channel, true);
         TickType_t now = xTaskGetTickCount();
-        sensorReadings[channel].lastTemperatureUpdated = now;
-        sensorReadings[channel].Error = false;
+        sensorState.updatedAt[channel] = now;
+        sensorState.setError(channel, false);
 
         // Update bound pointers (unified mapping architecture)
-        // ALWAYS write in tenths (Temperature_t format) for API consistency
-        // Convert to tenths with proper rounding for both modes:
-        // - LOW_RES: value already in tenths, use as-is
-        // - HIGH_RES: value in hundredths, round to nearest tenth
-        int16_t valueInTenths;
-        if (isHighRes) {
-            // Round hundredths to tenths using symmetric rounding
-            // Examples: 735 (73.5°C) → 74 tenths (7.4°C)
-            //           734 (73.4°C) → 73 tenths (7.3°C)
-            //          -735 (-73.5°C) → -74 tenths (-7.4°C)
-            //          -734 (-73.4°C) → -73 tenths (-7.3°C)
-            if (value >= 0) {
-                valueInTenths = (value + 5) / 10;  // Round positive values
-            } else {
-                valueInTenths = (value - 5) / 10;  // Round negative values
-            }
-        } else {
-            // LOW_RES: value already in tenths
-            valueInTenths = value;
-        }
-
-        if (sensorBindings[channel].temperaturePtr != nullptr) {
-            *sensorBindings[channel].temperaturePtr = valueInTenths;
-        }
+        // Temperatures ALWAYS in tenths (Temperature_t format) for API consistency,
+        // analog channels full-width (engineering value if mapped, else native
+        // fixed-point) into analogPtr and the snapshot
+        int32_t bindingValue = isAnalog
+            ? engineeringValues[channel]
+            // Round to tenths (symmetric): 735 hundredths -> 74, -735 -> -74
+            : mb8art::rescaleFixedPoint(value, divider, mb8art::BINDING_TEMPERATURE_DIVIDER);
+
+        writeBoundValue(channel, bindingValue);
         if (sensorBindings[channel].validityPtr != nullptr) {
             *sensorBindings[channel].validityPtr = true;
         }
+        recordChannelSnapshot(channel, bindingValue);
 
         // Update global timestamp for optimization
         lastAnyChannelUpdate = now;
 
+        updateChannelStatistics(channel, value);
+        if (rollupSeries[channel] != nullptr) {
+            rollupSeries[channel]->add(getRollupTime(), value);
+        }
+
         updateBitsToSet |= mb8art::SENSOR_UPDATE_BITS[channel];
         errorBitsToClear |= mb8art::SENSOR_ERROR_BITS[channel];
 
-        // Safe buffer append with bounds checking
-        // Format based on measurement range
-        // Note: Need explicit sign handling for values like -38 (-0.38°C) where
-        // integer division gives 0, losing the negative sign
+        // Safe buffer append with bounds checking, formatted with the channel's divider
         int remaining = bufferSize - offset - 1;  // -1 for null terminator
         if (remaining > 0) {
-            int written;
-            const char* sign = (value < 0) ? "-" : "";
-            int16_t absValue = (value < 0) ? -value : value;
-            if (currentRange == mb8art::MeasurementRange::HIGH_RES) {
-                // HIGH_RES: hundredths (-38 → "-0.38°C")
-                written = snprintf(statusBuffer + offset, remaining,
-                                 "C%d: %s%d.%02d°C; ", channel, sign, absValue / 100, absValue % 100);
-            } else {
-                // LOW_RES: tenths (-4 → "-0.4°C")
-                written = snprintf(statusBuffer + offset, remaining,
-                                 "C%d: %s%d.%d°C; ", channel, sign, absValue / 10, absValue % 10);
-            }
+            char formatted[16];
+            mb8art::formatFixedPoint(formatted, sizeof(formatted), value, divider);
+            int written = snprintf(statusBuffer + offset, remaining,
+                                   "C%d: %s%s; ", channel, formatted, channelUnitSuffix(channel));
             if (written > 0 && written < remaining) {
                 offset += written;
             }
         }
     } else {
-        sensorReadings[channel].isTemperatureValid = false;
-        sensorReadings[channel].Error = true;
+        sensorState.setValid(channel, false);
+        sensorState.setError(channel, true);
 
-        // Update bound pointers for error case
-        if (sensorBindings[channel].validityPtr != nullptr) {
-            *sensorBindings[channel].validityPtr = false;
-        }
+        // Update bound pointers for error case (held value if a hold policy allows)
+        holdChannel(channel, mb8art::QualityCode::BAD_OUT_OF_RANGE);
 
+        updateBitsToSet |= mb8art::SENSOR_UPDATE_BITS[channel];
         errorBitsToSet |= mb8art::SENSOR_ERROR_BITS[channel];
 
-        // Safe buffer append - format based on measurement range
-        // Note: Need explicit sign handling for negative temperatures
+        // Safe buffer append
         int remaining = bufferSize - offset - 1;
         if (remaining > 0) {
-            int written;
-            const char* sign = (value < 0) ? "-" : "";
-            int16_t absValue = (value < 0) ? -value : value;
-            if (currentRange == mb8art::MeasurementRange::HIGH_RES) {
-                written = snprintf(statusBuffer + offset, remaining,
-                                 "C%d: OutOfRange(%s%d.%02d°C); ", channel, sign, absValue / 100, absValue % 100);
-            } else {
-                written = snprintf(statusBuffer + offset, remaining,
-                                 "C%d: OutOfRange(%s%d.%d°C); ", channel, sign, absValue / 10, absValue % 10);
-            }
+            char formatted[16];
+            mb8art::formatFixedPoint(formatted, sizeof(formatted), value, divider);
+            int written = snprintf(statusBuffer + offset, remaining,
+                                   "C%d: OutOfRange(%s%s); ", channel, formatted, channelUnitSuffix(channel));
             if (written > 0 && written < remaining) {
                 offset += written;
             }
@@ -267,25 +578,19 @@ void MB8ART::updateSensorReading(uint8_t channel, int16_t value,
 
 
 int16_t MB8ART::processThermocoupleData(uint16_t rawData, mb8art::ThermocoupleType type) {
-    // MB8ART returns temperature based on measurement range
-    bool isHighRes = (currentRange == mb8art::MeasurementRange::HIGH_RES);
-    int16_t temperature = convertRawToTemperature(rawData, isHighRes);
-
-    // Use explicit sign handling for negative temperatures near zero
-    [[maybe_unused]] const char* sign = (temperature < 0) ? "-" : "";
-    [[maybe_unused]] int16_t absTemp = (temperature < 0) ? -temperature : temperature;
-
-    if (isHighRes) {
-        LOG_MB8ART_DEBUG_NL("Processing thermocouple data: Raw=0x%04X (%d), Type=%s, Temp=%s%d.%02d°C",
-                            rawData, rawData,
-                            mb8art::thermocoupleTypeToString(type),
-                            sign, absTemp / 100, absTemp % 100);
-    } else {
-        LOG_MB8ART_DEBUG_NL("Processing thermocouple data: Raw=0x%04X (%d), Type=%s, Temp=%s%d.%d°C",
-                            rawData, rawData,
-                            mb8art::thermocoupleTypeToString(type),
-                            sign, absTemp / 10, absTemp % 10);
+    // Thermocouples report tenths in either resolution mode (see channelScale)
+    int16_t temperature = convertRawToTemperature(rawData, false);
+
+    #ifdef MB8ART_DEBUG
+    {
+        char formatted[16];
+        mb8art::formatFixedPoint(formatted, sizeof(formatted), temperature,
+                                 mb8art::channelScale(static_cast<uint16_t>(mb8art::ChannelMode::THERMOCOUPLE),
+                                                      static_cast<uint16_t>(type), currentRange).divider);
+        LOG_MB8ART_DEBUG_NL("Processing thermocouple data: Raw=0x%04X (%d), Type=%s, Temp=%s°C",
+                            rawData, rawData, mb8art::thermocoupleTypeToString(type), formatted);
     }
+    #endif
 
     return temperature;
 }
@@ -295,24 +600,18 @@ int16_t MB8ART::processThermocoupleData(uint16_t rawData, mb8art::ThermocoupleTy
 
 int16_t MB8ART::processPTData(uint16_t rawData, mb8art::PTType type, mb8art::MeasurementRange range) {
     // MB8ART returns temperature data based on measurement range
-    bool isHighRes = (range == mb8art::MeasurementRange::HIGH_RES);
-    int16_t temperature = convertRawToTemperature(rawData, isHighRes);
-
-    // Use explicit sign handling for negative temperatures near zero
-    [[maybe_unused]] const char* sign = (temperature < 0) ? "-" : "";
-    [[maybe_unused]] int16_t absTemp = (temperature < 0) ? -temperature : temperature;
-
-    if (isHighRes) {
-        LOG_MB8ART_DEBUG_NL("Processing PT data: Raw=0x%04X (%d), Type=%s, Temp=%s%d.%02d°C",
-                            rawData, rawData,
-                            mb8art::ptTypeToString(type),
-                            sign, absTemp / 100, absTemp % 100);
-    } else {
-        LOG_MB8ART_DEBUG_NL("Processing PT data: Raw=0x%04X (%d), Type=%s, Temp=%s%d.%d°C",
-                            rawData, rawData,
-                            mb8art::ptTypeToString(type),
-                            sign, absTemp / 10, absTemp % 10);
+    int16_t temperature = convertRawToTemperature(rawData, range == mb8art::MeasurementRange::HIGH_RES);
+
+    #ifdef MB8ART_DEBUG
+    {
+        char formatted[16];
+        mb8art::formatFixedPoint(formatted, sizeof(formatted), temperature,
+                                 mb8art::channelScale(static_cast<uint16_t>(mb8art::ChannelMode::PT_INPUT),
+                                                      static_cast<uint16_t>(type), range).divider);
+        LOG_MB8ART_DEBUG_NL("Processing PT data: Raw=0x%04X (%d), Type=%s, Temp=%s°C",
+                            rawData, rawData, mb8art::ptTypeToString(type), formatted);
     }
+    #endif
 
     return temperature;
 }
@@ -321,15 +620,29 @@ int16_t MB8ART::processPTData(uint16_t rawData, mb8art::PTType type, mb8art::Mea
 
 
 int16_t MB8ART::processVoltageData(uint16_t rawData, mb8art::VoltageRange range) {
-    // For now, just return raw value since voltage/current mode isn't used
-    // TODO: Implement proper voltage scaling if needed
-    (void)range;  // Suppress unused warning
+    // Voltage scaling: the module reports ±30000 counts at full scale.
+    // Each range has its own fixed-point unit (see VOLTAGE_RANGE_SCALES):
+    // ±15mV -> µV, ±50mV/±100mV -> 0.01 mV, ±1V -> 0.1 mV
+    uint8_t index = static_cast<uint8_t>(range);
+    if (index >= sizeof(mb8art::VOLTAGE_RANGE_SCALES) / sizeof(mb8art::VOLTAGE_RANGE_SCALES[0])) {
+        LOG_MB8ART_WARN_NL("Unknown voltage range %d - returning raw value", index);
+        return static_cast<int16_t>(rawData);
+    }
 
-    LOG_MB8ART_DEBUG_NL("Processing voltage data: Raw=0x%04X, Range=%s (raw value returned)",
-                        rawData,
-                        mb8art::voltageRangeToString(range));
+    const mb8art::VoltageRangeScale& scale = mb8art::VOLTAGE_RANGE_SCALES[index];
+    int16_t signedData = static_cast<int16_t>(rawData);
 
-    return static_cast<int16_t>(rawData);
+    // Round to nearest (symmetric) - product fits int32 (32767 × 15000)
+    int32_t product = static_cast<int32_t>(signedData) * scale.fullScale;
+    int32_t half = mb8art::ANALOG_FULL_SCALE_COUNTS / 2;
+    int32_t voltage = (product >= 0 ? product + half : product - half) / mb8art::ANALOG_FULL_SCALE_COUNTS;
+
+    LOG_MB8ART_DEBUG_NL("Processing voltage data: Raw=%d, Range=%s -> %ld/%d mV",
+                        signedData,
+                        mb8art::voltageRangeToString(range),
+                        static_cast<long>(voltage), scale.divider);
+
+    return static_cast<int16_t>(voltage);
 }
 
 
@@ -345,15 +658,7 @@ void MB8ART::processChannelConfig(uint8_t channel, uint16_t rawConfig) {
         "Channel %d configuration successfully read: Mode=%s, SubType=%s",
         channel,
         mb8art::channelModeToString(static_cast<mb8art::ChannelMode>(channelConfigs[channel].mode)),
-        static_cast<mb8art::ChannelMode>(channelConfigs[channel].mode) == mb8art::ChannelMode::THERMOCOUPLE
-            ? mb8art::thermocoupleTypeToString(static_cast<mb8art::ThermocoupleType>(channelConfigs[channel].subType))
-            : (static_cast<mb8art::ChannelMode>(channelConfigs[channel].mode) == mb8art::ChannelMode::PT_INPUT
-                ? mb8art::ptTypeToString(static_cast<mb8art::PTType>(channelConfigs[channel].subType))
-                : (static_cast<mb8art::ChannelMode>(channelConfigs[channel].mode) == mb8art::ChannelMode::VOLTAGE
-                    ? mb8art::voltageRangeToString(static_cast<mb8art::VoltageRange>(channelConfigs[channel].subType))
-                    : (static_cast<mb8art::ChannelMode>(channelConfigs[channel].mode) == mb8art::ChannelMode::CURRENT
-                        ? mb8art::currentRangeToString(static_cast<mb8art::CurrentRange>(channelConfigs[channel].subType))
-                        : "N/A")))
+        mb8art::subTypeToString(channelConfigs[channel].mode, channelConfigs[channel].subType)
     );
 }
 
@@ -397,6 +702,44 @@ int16_t MB8ART::processCurrentData(uint16_t rawData, mb8art::CurrentRange range)
 
 
 
+bool MB8ART::isAnalogChannel(uint8_t channel) const {
+    uint16_t mode = channelConfigs[channel].mode;
+    return mode == static_cast<uint16_t>(mb8art::ChannelMode::VOLTAGE) ||
+           mode == static_cast<uint16_t>(mb8art::ChannelMode::CURRENT);
+}
+
+int16_t MB8ART::getChannelDivider(uint8_t channel) const {
+    return mb8art::channelScale(channelConfigs[channel].mode, channelConfigs[channel].subType,
+                                currentRange).divider;
+}
+
+const char* MB8ART::channelUnitSuffix(uint8_t channel) const {
+    uint16_t mode = channelConfigs[channel].mode;
+    if (mode == static_cast<uint16_t>(mb8art::ChannelMode::VOLTAGE)) {
+        return "mV";
+    }
+    return (mode == static_cast<uint16_t>(mb8art::ChannelMode::CURRENT)) ? "mA" : "°C";
+}
+
+int16_t MB8ART::getAnalogFullScale(uint8_t channel) const {
+    return mb8art::channelScale(channelConfigs[channel].mode, channelConfigs[channel].subType,
+                                currentRange).validMax;
+}
+
+void MB8ART::updateEngineeringValue(uint8_t channel, int16_t value) {
+    // Engineering-unit mapping is computed once here (at ingest) so every
+    // consumer reads the same scaled value
+    const mb8art::LinearScale& scale = engineeringScales[channel];
+    if (!scale.isEnabled() || !isAnalogChannel(channel)) {
+        engineeringValues[channel] = value;
+        return;
+    }
+    engineeringValues[channel] = scale.apply(value, getChannelDivider(channel));
+}
+
+
+
+
 void MB8ART::printSensorReading(const mb8art::SensorReading& reading, int sensorIndex) {
     if (channelConfigs[sensorIndex].mode == static_cast<uint16_t>(mb8art::ChannelMode::DEACTIVATED)) {
         return;
@@ -407,7 +750,9 @@ void MB8ART::printSensorReading(const mb8art::SensorReading& reading, int sensor
     
     LOG_MB8ART_INFO_NL("Sensor %d:", sensorIndex);
     if (reading.isTemperatureValid) {
-        LOG_MB8ART_INFO_NL("  Temperature: %.2f°C", reading.temperature);
+        char formatted[16];
+        mb8art::formatFixedPoint(formatted, sizeof(formatted), reading.temperature, getChannelDivider(sensorIndex));
+        LOG_MB8ART_INFO_NL("  Temperature: %s%s", formatted, channelUnitSuffix(sensorIndex));
         LOG_MB8ART_INFO_NL("  Last Update: %lu ticks ago", 
                           xTaskGetTickCount() - reading.lastTemperatureUpdated);
     }
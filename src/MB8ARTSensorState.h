@@ -0,0 +1,72 @@
+#ifndef MB8ART_SENSOR_STATE_H
+#define MB8ART_SENSOR_STATE_H
+
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @file MB8ARTSensorState.h
+ * @brief Per-channel sensor state in structure-of-arrays form
+ *
+ * Values and timestamps are contiguous arrays and each status flag is one
+ * bit per channel in a byte-wide mask, so frame-wide work (history encode,
+ * snapshot copy, "which channels are valid") is a memcpy or a single mask
+ * test instead of a strided walk over padded structs.
+ *
+ * The decode plan (valid range per channel) is resolved once per channel
+ * context change, so range checks in the decode path are two compares.
+ *
+ * 8 channels: 16 + 32 + 5 = 53 bytes of state (56 with padding) vs 96 bytes
+ * for SensorReading[8] (12 bytes each: int16, 2 pad, tick, bitfield, 3 pad),
+ * plus 32 bytes of decode plan. MB8ART::getSensorReading() rebuilds the old
+ * struct as a view.
+ */
+
+namespace mb8art {
+
+struct SensorStateTable {
+    static constexpr uint8_t CHANNELS = 8;
+
+    int16_t temperature[CHANNELS];   // Native fixed-point (tenths or hundredths / analog units)
+    uint32_t updatedAt[CHANNELS];    // TickType_t of the last accepted sample
+
+    // Decode plan: accepted native range for the channel's mode/subtype/resolution
+    int16_t validMin[CHANNELS];
+    int16_t validMax[CHANNELS];
+
+    // Bit n = channel n
+    uint8_t validMask;               // isTemperatureValid
+    uint8_t errorMask;               // Error
+    uint8_t commandOkMask;           // lastCommandSuccess
+    uint8_t confirmedMask;           // isStateConfirmed
+    uint8_t rejectedMask;            // isRejected
+
+    void reset() { memset(this, 0, sizeof(*this)); }
+
+    bool isValid(uint8_t ch) const { return test(validMask, ch); }
+    bool hasError(uint8_t ch) const { return test(errorMask, ch); }
+    bool isCommandOk(uint8_t ch) const { return test(commandOkMask, ch); }
+    bool isConfirmed(uint8_t ch) const { return test(confirmedMask, ch); }
+    bool isRejected(uint8_t ch) const { return test(rejectedMask, ch); }
+    bool isInPlanRange(uint8_t ch, int16_t value) const {
+        return value >= validMin[ch] && value <= validMax[ch];
+    }
+
+    void setValid(uint8_t ch, bool on) { assign(validMask, ch, on); }
+    void setError(uint8_t ch, bool on) { assign(errorMask, ch, on); }
+    void setCommandOk(uint8_t ch, bool on) { assign(commandOkMask, ch, on); }
+    void setConfirmed(uint8_t ch, bool on) { assign(confirmedMask, ch, on); }
+    void setRejected(uint8_t ch, bool on) { assign(rejectedMask, ch, on); }
+
+private:
+    static bool test(uint8_t mask, uint8_t ch) { return ((mask >> ch) & 1u) != 0; }
+
+    static void assign(uint8_t& mask, uint8_t ch, bool on) {
+        uint8_t bit = static_cast<uint8_t>(1u << ch);
+        mask = on ? static_cast<uint8_t>(mask | bit) : static_cast<uint8_t>(mask & ~bit);
+    }
+};
+
+} // namespace mb8art
+
+#endif // MB8ART_SENSOR_STATE_H
@@ -0,0 +1,48 @@
+#ifndef MB8ART_SEQLOCK_H
+#define MB8ART_SEQLOCK_H
+
+#include <atomic>
+#include <string.h>
+
+namespace mb8art {
+
+/**
+ * @brief Single-writer sequence lock for small POD snapshots
+ *
+ * The writer (the task decoding Modbus frames) never blocks. Readers copy
+ * the value and retry if a write overlapped, so queries need no mutex and
+ * cannot stall data processing. T must be trivially copyable.
+ */
+template <typename T>
+class SeqLock {
+public:
+    void write(const T& value) {
+        uint32_t seq = sequence.load(std::memory_order_relaxed);
+        sequence.store(seq + 1, std::memory_order_relaxed);   // Odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+        memcpy(&data, &value, sizeof(T));
+        std::atomic_thread_fence(std::memory_order_release);
+        sequence.store(seq + 2, std::memory_order_relaxed);
+    }
+
+    T read() const {
+        T copy;
+        uint32_t before;
+        uint32_t after;
+        do {
+            before = sequence.load(std::memory_order_acquire);
+            memcpy(&copy, &data, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = sequence.load(std::memory_order_relaxed);
+        } while ((before & 1) != 0 || before != after);
+        return copy;
+    }
+
+private:
+    std::atomic<uint32_t> sequence{0};
+    T data{};
+};
+
+} // namespace mb8art
+
+#endif // MB8ART_SEQLOCK_H
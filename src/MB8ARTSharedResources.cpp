@@ -3,6 +3,8 @@
 #include <MutexGuard.h>
 #include <esp_log.h>
 #include "MB8ARTLoggingMacros.h"
+#include <new>
+#include <string.h>
 
 // Static member initialization
 // Define MB8ART's static member variables
@@ -12,15 +14,23 @@ uint32_t MB8ART::expectedUpdateIntervalMs = 0;
 // Static member initialization
 MB8ARTSharedResources* MB8ARTSharedResources::instance = nullptr;
 SemaphoreHandle_t MB8ARTSharedResources::resourceMutex = nullptr;
-MB8ART* MB8ARTSharedResources::mb8artInstance = nullptr;
+#if MB8ART_STATIC_ALLOCATION
+StaticSemaphore_t MB8ARTSharedResources::resourceMutexStorage;
+#endif
+mb8art::InstanceRegistry<MB8ART, MB8ART_MAX_INSTANCES> MB8ARTSharedResources::registry;
+std::atomic<MB8ART*> MB8ARTSharedResources::defaultInstance(nullptr);
 EventBits_t MB8ARTSharedResources::sensorAllUpdateBits = 0xFF;  // All 8 sensors
 EventBits_t MB8ARTSharedResources::sensorAllErrorBits = 0xFF;   // All 8 sensors
+#if MB8ART_DEFERRED_LOG
+std::atomic<TaskHandle_t> MB8ARTSharedResources::deferredLogTask(nullptr);
+std::atomic<bool> MB8ARTSharedResources::deferredLogTaskClaimed(false);
+#endif
 
 // Constructor
 MB8ARTSharedResources::MB8ARTSharedResources() {
     // Create mutex for thread-safe access
     if (resourceMutex == nullptr) {
-        resourceMutex = xSemaphoreCreateMutex();
+        resourceMutex = MB8ART_MUTEX_CREATE(resourceMutexStorage);
         configASSERT(resourceMutex != nullptr);
     }
     
@@ -38,28 +48,60 @@ MB8ARTSharedResources::~MB8ARTSharedResources() {
 // Singleton access
 MB8ARTSharedResources& MB8ARTSharedResources::getInstance() {
     if (instance == nullptr) {
+#if MB8ART_STATIC_ALLOCATION
+        // Constructed in place - the singleton never touches the heap
+        alignas(MB8ARTSharedResources) static uint8_t storage[sizeof(MB8ARTSharedResources)];
+        instance = new (storage) MB8ARTSharedResources();
+#else
         instance = new MB8ARTSharedResources();
+#endif
     }
     return *instance;
 }
 
-// MB8ART instance access (thread-safe)
-MB8ART* MB8ARTSharedResources::getMB8ARTInstance() {
-    MutexGuard guard(getInstance().resourceMutex, MUTEX_TIMEOUT);
-    if (!guard.hasLock()) {
-        // Log error but return current value anyway
-        LOG_MB8ART_ERROR_NL("MB8ARTSharedResources: Failed to acquire mutex for getMB8ARTInstance");
+// MB8ART instance registry (lock-free)
+bool MB8ARTSharedResources::registerMB8ART(MB8ART* instance) {
+    return registry.add(instance);
+}
+
+bool MB8ARTSharedResources::unregisterMB8ART(MB8ART* instance) {
+    MB8ART* expected = instance;
+    defaultInstance.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
+    return registry.remove(instance);
+}
+
+MB8ART* MB8ARTSharedResources::findMB8ARTByAddress(uint8_t address) {
+    return registry.find([address](const MB8ART& device) {
+        return device.getServerAddress() == address;
+    });
+}
+
+MB8ART* MB8ARTSharedResources::findMB8ARTByTag(const char* tag) {
+    if (tag == nullptr) {
+        return nullptr;
     }
-    return mb8artInstance;
+    return registry.find([tag](const MB8ART& device) {
+        const char* deviceTag = device.getTag();
+        return deviceTag != nullptr && strcmp(deviceTag, tag) == 0;
+    });
+}
+
+uint8_t MB8ARTSharedResources::getMB8ARTCount() {
+    return registry.count();
+}
+
+MB8ART* MB8ARTSharedResources::getMB8ARTInstance() {
+    MB8ART* instance = defaultInstance.load(std::memory_order_acquire);
+    return (instance != nullptr) ? instance : registry.first();
 }
 
 void MB8ARTSharedResources::setMB8ARTInstance(MB8ART* instance) {
-    MutexGuard guard(getInstance().resourceMutex, MUTEX_TIMEOUT);
-    if (!guard.hasLock()) {
-        LOG_MB8ART_ERROR_NL("MB8ARTSharedResources: Failed to acquire mutex for setMB8ARTInstance");
+    if (instance != nullptr && !registry.add(instance)) {
+        LOG_MB8ART_ERROR_NL("MB8ARTSharedResources: registry full (MB8ART_MAX_INSTANCES=%d)",
+                            MB8ART_MAX_INSTANCES);
         return;
     }
-    mb8artInstance = instance;
+    defaultInstance.store(instance, std::memory_order_release);
 }
 
 // Event bits access (thread-safe)
@@ -141,4 +183,71 @@ EventBits_t MB8ARTSharedResources::eventGroupGetBits(EventGroupHandle_t xEventGr
         return 0;
     }
     return xEventGroupGetBits(xEventGroup);
-}
\ No newline at end of file
+}
+
+#if MB8ART_DEFERRED_LOG
+// Deferred logging drain side
+namespace {
+
+void writeDeferredLog(void* context, uint8_t level, uint32_t tick, const char* text) {
+    (void)context;
+    // Tick of the original call; the backend stamps the time of writing
+    MB8ART_LOG_WRITE_NOW(static_cast<esp_log_level_t>(level), "(@%lu) %s",
+                         static_cast<unsigned long>(tick), text);
+}
+
+void deferredLogTaskMain(void* parameters) {
+    (void)parameters;
+    for (;;) {
+        MB8ARTSharedResources::flushDeferredLog();
+        vTaskDelay(pdMS_TO_TICKS(MB8ART_DEFERRED_LOG_FLUSH_MS));
+    }
+}
+
+} // namespace
+
+uint16_t MB8ARTSharedResources::flushDeferredLog() {
+    uint32_t dropped = mb8art::DeferredLog::ring().takeDropped();
+    if (dropped > 0) {
+        MB8ART_LOG_WRITE_NOW(ESP_LOG_WARN, "%lu deferred log messages dropped (ring of %d full)",
+                             static_cast<unsigned long>(dropped), MB8ART_DEFERRED_LOG_RECORDS);
+    }
+    return mb8art::DeferredLog::drain(writeDeferredLog, nullptr);
+}
+
+bool MB8ARTSharedResources::startDeferredLogTask(UBaseType_t priority) {
+    if (deferredLogTask.load(std::memory_order_acquire) != nullptr) {
+        return true;
+    }
+    // Only the caller that claims the flag creates the task - two creators
+    // would share the static stack/TCB. Others wait for its outcome.
+    bool expected = false;
+    if (!deferredLogTaskClaimed.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+        while (deferredLogTask.load(std::memory_order_acquire) == nullptr &&
+               deferredLogTaskClaimed.load(std::memory_order_acquire)) {
+            vTaskDelay(1);
+        }
+        return deferredLogTask.load(std::memory_order_acquire) != nullptr;
+    }
+#if MB8ART_STATIC_ALLOCATION
+    static StackType_t stack[MB8ART_DEFERRED_LOG_STACK_SIZE / sizeof(StackType_t)];
+    static StaticTask_t taskStorage;
+    TaskHandle_t handle = xTaskCreateStatic(deferredLogTaskMain, "MB8ARTLog",
+                                            MB8ART_DEFERRED_LOG_STACK_SIZE,  // bytes on ESP-IDF
+                                            nullptr, priority, stack, &taskStorage);
+#else
+    TaskHandle_t handle = nullptr;
+    if (xTaskCreate(deferredLogTaskMain, "MB8ARTLog", MB8ART_DEFERRED_LOG_STACK_SIZE,
+                    nullptr, priority, &handle) != pdPASS) {
+        handle = nullptr;
+    }
+#endif
+    if (handle == nullptr) {
+        MB8ART_LOG_WRITE_NOW(ESP_LOG_ERROR, "Failed to create deferred log task");
+        deferredLogTaskClaimed.store(false, std::memory_order_release);  // Allow a retry
+        return false;
+    }
+    deferredLogTask.store(handle, std::memory_order_release);
+    return true;
+}
+#endif // MB8ART_DEFERRED_LOG
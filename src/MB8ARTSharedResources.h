@@ -4,6 +4,11 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/event_groups.h"
 #include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "MB8ARTAllocation.h"
+#include "MB8ARTRegistry.h"
+#include "MB8ARTDeferredLog.h"
+#include <atomic>
 
 // Forward declaration
 class MB8ART;
@@ -26,7 +31,15 @@ public:
     
     // Note: Logger functionality has been removed - use Logger::getInstance() directly
     
-    // MB8ART instance access (thread-safe)
+    // MB8ART instance registry (lock-free, wait-free lookups - see MB8ARTRegistry.h)
+    // Every MB8ART registers itself on construction and leaves on cleanup()
+    static bool registerMB8ART(MB8ART* instance);
+    static bool unregisterMB8ART(MB8ART* instance);
+    static MB8ART* findMB8ARTByAddress(uint8_t address);
+    static MB8ART* findMB8ARTByTag(const char* tag);
+    static uint8_t getMB8ARTCount();
+
+    // Default instance: the one passed to setMB8ARTInstance(), else the first registered
     static MB8ART* getMB8ARTInstance();
     static void setMB8ARTInstance(MB8ART* instance);
     
@@ -45,6 +58,15 @@ public:
                                          BaseType_t xWaitForAllBits,
                                          TickType_t xTicksToWait);
     static EventBits_t eventGroupGetBits(EventGroupHandle_t xEventGroup);
+
+#if MB8ART_DEFERRED_LOG
+    // Deferred logging (MB8ARTDeferredLog.h): format and write pending
+    // LOG_MB8ART_*_NL messages. The task drains every
+    // MB8ART_DEFERRED_LOG_FLUSH_MS; flushDeferredLog() drains now (e.g.
+    // before a restart) and returns the number of messages written.
+    static bool startDeferredLogTask(UBaseType_t priority = 1);
+    static uint16_t flushDeferredLog();
+#endif
     
 private:
     MB8ARTSharedResources();
@@ -55,11 +77,19 @@ private:
     
     // Mutex for thread-safe access
     static SemaphoreHandle_t resourceMutex;
+#if MB8ART_STATIC_ALLOCATION
+    static StaticSemaphore_t resourceMutexStorage;
+#endif
     
     // Shared resources
-    static MB8ART* mb8artInstance;
+    static mb8art::InstanceRegistry<MB8ART, MB8ART_MAX_INSTANCES> registry;
+    static std::atomic<MB8ART*> defaultInstance;
     static EventBits_t sensorAllUpdateBits;
     static EventBits_t sensorAllErrorBits;
+#if MB8ART_DEFERRED_LOG
+    static std::atomic<TaskHandle_t> deferredLogTask;
+    static std::atomic<bool> deferredLogTaskClaimed;  // Set by the caller creating the task
+#endif
     
     // Mutex timeout
     static constexpr TickType_t MUTEX_TIMEOUT = pdMS_TO_TICKS(1000);
@@ -68,6 +98,8 @@ private:
 // Convenience macros for SRP access
 #define MB8ART_SRP MB8ARTSharedResources::getInstance()
 #define MB8ART_SRP_MB8ART MB8ARTSharedResources::getMB8ARTInstance()
+#define MB8ART_SRP_MB8ART_BY_ADDRESS(address) MB8ARTSharedResources::findMB8ARTByAddress(address)
+#define MB8ART_SRP_MB8ART_BY_TAG(tag) MB8ARTSharedResources::findMB8ARTByTag(tag)
 
 // Event group operation macros
 #define MB8ART_SRP_EVENT_GROUP_SET_BITS(xEventGroup, uxBitsToSet) \
@@ -82,4 +114,13 @@ private:
 #define MB8ART_SRP_EVENT_GROUP_GET_BITS(xEventGroup) \
     MB8ARTSharedResources::eventGroupGetBits(xEventGroup)
 
+// Hot-path variants: direct kernel calls, no null check, no logging. Only for
+// a driver's own groups, which are valid from a successful construction until
+// cleanup() - initializeDevice() refuses to start a module without them
+#define MB8ART_EVENT_GROUP_SET_BITS_FAST(xEventGroup, uxBitsToSet) \
+    xEventGroupSetBits(xEventGroup, uxBitsToSet)
+
+#define MB8ART_EVENT_GROUP_CLEAR_BITS_FAST(xEventGroup, uxBitsToClear) \
+    xEventGroupClearBits(xEventGroup, uxBitsToClear)
+
 #endif // MB8ART_SHARED_RESOURCES_H
\ No newline at end of file
@@ -8,12 +8,14 @@
 #include "MB8ART.h"
 #include <MutexGuard.h>
 #include <cmath>
+#include "esp_timer.h"
 
 using namespace mb8art;
 
 void MB8ART::initializeDataStructures() {
     // Clear all data structures
-    memset(sensorReadings, 0, sizeof(sensorReadings));
+    sensorState.reset();
+    memset(channelContextKeys, 0, sizeof(channelContextKeys));  // Decode plans rebuilt on next frame
     memset(channelConfigs, 0, sizeof(channelConfigs));
     sensorConnected = 0;  // Initialize all bits to 0
     
@@ -23,9 +25,7 @@ void MB8ART::initializeDataStructures() {
     
     // Initialize each sensor reading with tracking
     for (int i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
-        sensorReadings[i] = mb8art::SensorReading();  // Use default constructor
-        sensorReadings[i].Error = 0;  // Set Error to false
-        sensorReadings[i].lastCommandSuccess = 1;  // Initialize to true
+        sensorState.setCommandOk(i, true);  // Initialize to true
         setSensorConnected(i, false);
         channelConfigs[i] = {
             .mode = 0,
@@ -73,15 +73,12 @@ bool MB8ART::waitForInitStep(EventBits_t stepBit, const char* stepName, TickType
 // Temperature sensor status methods
 int16_t MB8ART::getSensorTemperature(uint8_t sensorIndex) const {
     if (sensorIndex < DEFAULT_NUMBER_OF_SENSORS) {
-        int16_t temp = sensorReadings[sensorIndex].temperature;
-        // Format based on measurement range
-        if (currentRange == mb8art::MeasurementRange::HIGH_RES) {
-            LOG_MB8ART_DEBUG_NL("getSensorTemperature(%d) = %d.%02d°C",
-                               sensorIndex, temp / 100, abs(temp % 100));
-        } else {
-            LOG_MB8ART_DEBUG_NL("getSensorTemperature(%d) = %d.%d°C",
-                               sensorIndex, temp / 10, abs(temp % 10));
-        }
+        int16_t temp = sensorState.temperature[sensorIndex];
+        #ifdef MB8ART_DEBUG
+        char formatted[16];
+        mb8art::formatFixedPoint(formatted, sizeof(formatted), temp, getChannelDivider(sensorIndex));
+        LOG_MB8ART_DEBUG_NL("getSensorTemperature(%d) = %s%s", sensorIndex, formatted, channelUnitSuffix(sensorIndex));
+        #endif
         return temp;
     }
     LOG_MB8ART_WARN_NL("getSensorTemperature: Invalid sensor index %d", sensorIndex);
@@ -90,7 +87,7 @@ int16_t MB8ART::getSensorTemperature(uint8_t sensorIndex) const {
 
 bool MB8ART::wasSensorLastCommandSuccessful(uint8_t sensorIndex) const {
     if (sensorIndex < DEFAULT_NUMBER_OF_SENSORS) {
-        return sensorReadings[sensorIndex].lastCommandSuccess;
+        return sensorState.isCommandOk(sensorIndex);
     }
     LOG_MB8ART_WARN_NL("wasSensorLastCommandSuccessful: Invalid sensor index %d", sensorIndex);
     return false;
@@ -98,18 +95,195 @@ bool MB8ART::wasSensorLastCommandSuccessful(uint8_t sensorIndex) const {
 
 TickType_t MB8ART::getSensorLastUpdateTime(uint8_t sensorIndex) const {
     if (sensorIndex < DEFAULT_NUMBER_OF_SENSORS) {
-        return sensorReadings[sensorIndex].lastTemperatureUpdated;
+        return sensorState.updatedAt[sensorIndex];
     }
     return 0;
 }
 
 bool MB8ART::isSensorStateConfirmed(uint8_t sensorIndex) const {
     if (sensorIndex < DEFAULT_NUMBER_OF_SENSORS) {
-        return sensorReadings[sensorIndex].isStateConfirmed;
+        return sensorState.isConfirmed(sensorIndex);
     }
     return false;
 }
 
+int16_t MB8ART::getRawValue(uint8_t channel) const {
+    if (channel < DEFAULT_NUMBER_OF_SENSORS) {
+        return rawValues[channel];
+    }
+    return 0;
+}
+
+uint32_t MB8ART::getRejectedSampleCount(uint8_t channel) const {
+    if (channel < DEFAULT_NUMBER_OF_SENSORS) {
+        return rejectedSamples[channel];
+    }
+    return 0;
+}
+
+void MB8ART::resetRejectedSampleCounts() {
+    memset(rejectedSamples, 0, sizeof(rejectedSamples));
+}
+
+mb8art::ChannelStatistics MB8ART::getChannelStatistics(uint8_t channel) const {
+    if (channel < DEFAULT_NUMBER_OF_SENSORS) {
+        return statisticsSnapshots[channel].read();
+    }
+    return mb8art::ChannelStatistics{};
+}
+
+mb8art::ChannelSnapshot MB8ART::getSnapshot(uint8_t channel) const {
+    if (channel < DEFAULT_NUMBER_OF_SENSORS) {
+        return publishedSnapshots[channel].read();
+    }
+    return mb8art::ChannelSnapshot{};
+}
+
+mb8art::HeldReading MB8ART::getHeldReading(uint8_t channel) const {
+    if (channel < DEFAULT_NUMBER_OF_SENSORS) {
+        return mb8art::evaluateHold(publishedSnapshots[channel].read(),
+                                    pdTICKS_TO_MS(xTaskGetTickCount()));
+    }
+    return mb8art::HeldReading{};
+}
+
+int16_t MB8ART::getSnapshotDivider(uint8_t channel) const {
+    if (channel < DEFAULT_NUMBER_OF_SENSORS && isAnalogChannel(channel)) {
+        return getEngineeringDivider(channel);
+    }
+    return mb8art::BINDING_TEMPERATURE_DIVIDER;
+}
+
+mb8art::RollupSeries* MB8ART::getRollup(uint8_t channel) const {
+    if (channel < DEFAULT_NUMBER_OF_SENSORS) {
+        return rollupSeries[channel];
+    }
+    return nullptr;
+}
+
+uint32_t MB8ART::getRollupTime() {
+    // Seconds since boot from the 64-bit esp_timer (tick count wraps after ~49 days)
+    return static_cast<uint32_t>(esp_timer_get_time() / 1000000);
+}
+
+uint32_t MB8ART::getLatencyTimeUs() {
+    // Wraps after ~71 minutes; only differences of a few seconds are taken
+    return static_cast<uint32_t>(esp_timer_get_time());
+}
+
+void MB8ART::logProfile() {
+    mb8art::ProfileEntry entries[mb8art::Profiler::SLOTS];
+    uint8_t n = mb8art::Profiler::snapshot(entries, mb8art::Profiler::SLOTS);
+    LOG_MB8ART_INFO_NL("=== Profile (%d counters) ===", n);
+    for (uint8_t i = 0; i < n; i++) {
+        const mb8art::ProfileEntry& e = entries[i];
+        uint32_t meanUs = e.count ? mb8art::Profiler::ticksToUs(e.totalTicks / e.count) : 0;
+        LOG_MB8ART_INFO_NL("%-24s n=%lu mean=%lu us max=%lu us total=%lu us", e.name,
+                           static_cast<unsigned long>(e.count), static_cast<unsigned long>(meanUs),
+                           static_cast<unsigned long>(mb8art::Profiler::ticksToUs(e.maxTicks)),
+                           static_cast<unsigned long>(mb8art::Profiler::ticksToUs(e.totalTicks)));
+    }
+}
+
+mb8art::LatencySummary MB8ART::getLatency(mb8art::LatencyStage stage) const {
+    if (stage >= mb8art::LatencyStage::COUNT) {
+        return mb8art::LatencySummary{};
+    }
+    return latencyHistograms[static_cast<uint8_t>(stage)].summary();
+}
+
+void MB8ART::resetLatency() {
+    for (mb8art::LatencyHistogram& histogram : latencyHistograms) {
+        histogram.reset();
+    }
+}
+
+mb8art::BusMetrics MB8ART::getMetrics() const {
+    mb8art::BusMetrics metrics;
+    busMetrics.snapshot(metrics);
+    metrics.consecutiveTimeouts = consecutiveTimeouts;
+    metrics.online = statusFlags.initialized && !statusFlags.moduleOffline;
+    metrics.rtt = getLatency(mb8art::LatencyStage::REQUEST_TO_RESPONSE);
+    return metrics;
+}
+
+#ifdef MB8ART_ENABLE_MQTT
+void MB8ART::attachPublisher(mb8art::ReadingPublisher* publisher) {
+    if (publisher != nullptr) {
+        publisher->setAddress(getServerAddress());
+    }
+    readingPublisher = publisher;
+}
+#endif
+
+void MB8ART::resetMetrics() {
+    busMetrics.reset();
+    resetLatency();
+}
+
+void MB8ART::recordReadLatency(uint32_t receivedUs) {
+    uint32_t decodedUs = getLatencyTimeUs();
+    latencyHistograms[static_cast<uint8_t>(mb8art::LatencyStage::DECODE)].record(decodedUs - receivedUs);
+
+    // Request phases only for a response that follows our own stamp (a late
+    // reply to an earlier read would yield a negative interval)
+    uint32_t requestedUs = pendingRequestUs.exchange(0, std::memory_order_relaxed);
+    if (requestedUs != 0 && static_cast<int32_t>(receivedUs - requestedUs) >= 0) {
+        latencyHistograms[static_cast<uint8_t>(mb8art::LatencyStage::REQUEST_TO_RESPONSE)]
+            .record(receivedUs - requestedUs);
+        latencyHistograms[static_cast<uint8_t>(mb8art::LatencyStage::END_TO_END)]
+            .record(decodedUs - requestedUs);
+    }
+}
+
+void MB8ART::traceTransaction(mb8art::TraceKind kind, uint8_t functionCode, uint16_t address,
+                              uint8_t result, const uint8_t* data, size_t length, uint32_t nowUs,
+                              uint32_t requestedUs) {
+    mb8art::TraceBuffer* trace = traceBuffer;
+    if (trace == nullptr) {
+        return;
+    }
+    mb8art::TraceEvent event;
+    event.timestampUs = nowUs;
+    event.tick = xTaskGetTickCount();
+    event.address = address;
+    event.length = static_cast<uint16_t>(length);
+    event.functionCode = functionCode;
+    event.kind = kind;
+    event.result = result;
+    if (requestedUs != 0 && static_cast<int32_t>(nowUs - requestedUs) >= 0) {
+        event.rttUs = nowUs - requestedUs;
+    }
+    trace->record(event, data);
+}
+
+uint8_t MB8ART::getActiveAlarms(uint8_t channel) const {
+    if (channel >= DEFAULT_NUMBER_OF_SENSORS) {
+        return 0;
+    }
+    taskENTER_CRITICAL(&channelStateMux);
+    uint8_t active = channelAlarms[channel].getActiveMask();
+    taskEXIT_CRITICAL(&channelStateMux);
+    return active;
+}
+
+int32_t MB8ART::getEngineeringValue(uint8_t channel) const {
+    if (channel < DEFAULT_NUMBER_OF_SENSORS) {
+        return engineeringValues[channel];
+    }
+    return 0;
+}
+
+int16_t MB8ART::getEngineeringDivider(uint8_t channel) const {
+    if (channel >= DEFAULT_NUMBER_OF_SENSORS) {
+        return 1;
+    }
+    if (engineeringScales[channel].isEnabled() && isAnalogChannel(channel)) {
+        return engineeringScales[channel].divider;
+    }
+    return static_cast<int16_t>(getDataScaleDivider(IDeviceInstance::DeviceDataType::TEMPERATURE, channel));
+}
+
 // Enhanced module status methods for complete observability
 bool MB8ART::isModuleResponsive() const {
     // Get timing reference
@@ -155,18 +329,7 @@ uint8_t MB8ART::getConnectedChannels() const {
 }
 
 const char* MB8ART::getSubTypeString(mb8art::ChannelMode mode, uint8_t subType) const {
-    switch (mode) {
-        case mb8art::ChannelMode::THERMOCOUPLE:
-            return mb8art::thermocoupleTypeToString(static_cast<mb8art::ThermocoupleType>(subType));
-        case mb8art::ChannelMode::PT_INPUT:
-            return mb8art::ptTypeToString(static_cast<mb8art::PTType>(subType));
-        case mb8art::ChannelMode::VOLTAGE:
-            return mb8art::voltageRangeToString(static_cast<mb8art::VoltageRange>(subType));
-        case mb8art::ChannelMode::CURRENT:
-            return mb8art::currentRangeToString(static_cast<mb8art::CurrentRange>(subType));
-        default:
-            return "N/A";
-    }
+    return mb8art::subTypeToString(static_cast<uint16_t>(mode), subType);
 }
 
 bool MB8ART::isTemperatureInRange(int16_t temperature) {
@@ -184,6 +347,12 @@ void MB8ART::printModuleSettings() const {
     LOG_MB8ART_INFO_NL("Measurement Range: %s", 
                       (currentRange == mb8art::MeasurementRange::HIGH_RES) ? "HIGH_RES" : "LOW_RES");
     LOG_MB8ART_INFO_NL("Module Temperature: %.1f°C", moduleSettings.moduleTemperature);
+    if (moduleSettings.productVersion != 0) {
+        LOG_MB8ART_INFO_NL("Product Version: HW %d, SW %d",
+                          mb8art::productHardwareVersion(moduleSettings.productVersion),
+                          mb8art::productSoftwareVersion(moduleSettings.productVersion));
+    }
+    LOG_MB8ART_INFO_NL("Equipment Status: 0x%04X", moduleSettings.equipmentStatus);
 }
 
 BaudRate MB8ART::getStoredBaudRate() const {
@@ -201,25 +370,44 @@ bool MB8ART::getSensorConnectionStatus(uint8_t channel) const {
     return (sensorConnected & (1 << channel)) != 0;
 }
 
-const SensorReading& MB8ART::getSensorReading(uint8_t channel) const {
-    static const SensorReading defaultReading{};
-    
+SensorReading MB8ART::getSensorReading(uint8_t channel) const {
     if (channel < DEFAULT_NUMBER_OF_SENSORS) {
-        return sensorReadings[channel];
+        return makeSensorReading(channel);
     }
     
     LOG_MB8ART_WARN_NL("getSensorReading: Invalid channel %d, returning default", channel);
-    return defaultReading;
+    return SensorReading{};
 }
 
 bool MB8ART::getAllSensorReadings(mb8art::SensorReading* destination) const {
     if (destination == nullptr) {
         return false;
     }
-    memcpy(destination, sensorReadings, sizeof(sensorReadings));
+    for (uint8_t i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
+        destination[i] = makeSensorReading(i);
+    }
     return true;
 }
 
+std::array<SensorReading, DEFAULT_NUMBER_OF_SENSORS> MB8ART::getSensorReadings() const {
+    std::array<SensorReading, DEFAULT_NUMBER_OF_SENSORS> readings;
+    getAllSensorReadings(readings.data());
+    return readings;
+}
+
+SensorReading MB8ART::makeSensorReading(uint8_t channel) const {
+    // AoS view of the SoA state
+    SensorReading reading;
+    reading.temperature = sensorState.temperature[channel];
+    reading.lastTemperatureUpdated = sensorState.updatedAt[channel];
+    reading.isTemperatureValid = sensorState.isValid(channel);
+    reading.Error = sensorState.hasError(channel);
+    reading.lastCommandSuccess = sensorState.isCommandOk(channel);
+    reading.isStateConfirmed = sensorState.isConfirmed(channel);
+    reading.isRejected = sensorState.isRejected(channel);
+    return reading;
+}
+
 const char* MB8ART::getTag() const {
     return tag;
 }
@@ -227,7 +415,7 @@ const char* MB8ART::getTag() const {
 // SimpleModbusDevice interface implementation
 int16_t MB8ART::getTemperature(uint8_t channel) const {
     if (channel < DEFAULT_NUMBER_OF_SENSORS) {
-        return sensorReadings[channel].temperature;  // int16_t tenths
+        return sensorState.temperature[channel];  // int16_t tenths
     }
     return 0;  // Invalid temperature
 }
@@ -236,17 +424,17 @@ std::vector<int16_t> MB8ART::getTemperatures() const {
     std::vector<int16_t> temps;
     temps.reserve(DEFAULT_NUMBER_OF_SENSORS);
 
-    for (const auto& reading : sensorReadings) {
-        temps.push_back(reading.temperature);  // int16_t tenths
-    }
+    temps.assign(sensorState.temperature, sensorState.temperature + DEFAULT_NUMBER_OF_SENSORS);
 
     return temps;
 }
 
 float MB8ART::getScaleFactor(size_t channel) const {
-    // Scale factor for converting raw int16_t to float temperature
-    // - LOW_RES: 0.1°C resolution (divide by 10)
-    // - HIGH_RES: 0.01°C resolution (divide by 100)
-    // Note: Prefer integer math where possible (rawTemp / 100, rawTemp % 100)
-    return (currentRange == mb8art::MeasurementRange::HIGH_RES) ? 0.01f : 0.1f;
+    // Scale factor for converting the raw int16_t of a channel to float:
+    // 1 / channelScale divider (tenths or hundredths of °C, per-range mV/mA)
+    // Note: Prefer integer math where possible (formatFixedPoint, rescaleFixedPoint)
+    if (channel >= DEFAULT_NUMBER_OF_SENSORS) {
+        return 0.1f;
+    }
+    return 1.0f / getChannelDivider(static_cast<uint8_t>(channel));
 }
\ No newline at end of file
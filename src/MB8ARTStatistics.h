@@ -0,0 +1,168 @@
+#ifndef MB8ART_STATISTICS_H
+#define MB8ART_STATISTICS_H
+
+#include <stdint.h>
+
+/**
+ * @file MB8ARTStatistics.h
+ * @brief O(1) rolling min/max/mean/variance over a sliding sample window
+ *
+ * Each accepted sample is pushed once per frame:
+ * - sum and sum of squares are kept as exact 64-bit integers, so adding and
+ *   removing samples never accumulates rounding error (Welford's update
+ *   is only needed for floating point)
+ * - min and max come from monotonic deques (amortized O(1))
+ *
+ * Storage is a fixed ring of MB8ART_STATS_WINDOW_CAPACITY samples per channel.
+ */
+
+// Maximum window length in samples (per channel, 4 bytes per sample slot)
+#ifndef MB8ART_STATS_WINDOW_CAPACITY
+    #ifdef PROJECT_MB8ART_STATS_WINDOW_CAPACITY
+        #define MB8ART_STATS_WINDOW_CAPACITY PROJECT_MB8ART_STATS_WINDOW_CAPACITY
+    #else
+        #define MB8ART_STATS_WINDOW_CAPACITY 32
+    #endif
+#endif
+
+static_assert(MB8ART_STATS_WINDOW_CAPACITY > 0 && MB8ART_STATS_WINDOW_CAPACITY <= 255,
+              "MB8ART_STATS_WINDOW_CAPACITY must be 1..255");
+
+namespace mb8art {
+
+/**
+ * @brief Summary of the current window (native fixed-point units)
+ */
+struct ChannelStatistics {
+    int16_t min = 0;
+    int16_t max = 0;
+    int16_t mean = 0;           // Rounded to the nearest count
+    uint16_t count = 0;         // Samples currently in the window
+    uint32_t variance = 0;      // Population variance in counts²
+    uint32_t totalSamples = 0;  // Samples pushed since the last reset
+};
+
+class RollingStatistics {
+public:
+    static constexpr uint8_t CAPACITY = MB8ART_STATS_WINDOW_CAPACITY;
+
+    /**
+     * @param samples Window length, 0 disables the aggregator, max CAPACITY
+     */
+    bool setWindow(uint8_t samples) {
+        if (samples > CAPACITY) {
+            return false;
+        }
+        window = samples;
+        reset();
+        return true;
+    }
+
+    uint8_t getWindow() const { return window; }
+    bool isEnabled() const { return window != 0; }
+
+    void reset() {
+        head = 0;
+        count = 0;
+        sum = 0;
+        sumSquares = 0;
+        totalSamples = 0;
+        minFront = minBack = minSize = 0;
+        maxFront = maxBack = maxSize = 0;
+    }
+
+    void push(int16_t value) {
+        if (window == 0) {
+            return;
+        }
+
+        // Evict the oldest sample once the window is full
+        if (count == window) {
+            int16_t oldest = values[head];
+            sum -= oldest;
+            sumSquares -= static_cast<int64_t>(oldest) * oldest;
+            // The slot being overwritten holds the oldest sample
+            if (minSize != 0 && minIndex[minFront] == head) {
+                popFront(minFront, minSize);
+            }
+            if (maxSize != 0 && maxIndex[maxFront] == head) {
+                popFront(maxFront, maxSize);
+            }
+        } else {
+            count++;
+        }
+
+        values[head] = value;
+        sum += value;
+        sumSquares += static_cast<int64_t>(value) * value;
+
+        // Monotonic deques: drop dominated entries from the back
+        while (minSize != 0 && values[minIndex[backIndex(minBack)]] >= value) {
+            popBack(minBack, minSize);
+        }
+        pushBack(minIndex, minBack, minSize, head);
+        while (maxSize != 0 && values[maxIndex[backIndex(maxBack)]] <= value) {
+            popBack(maxBack, maxSize);
+        }
+        pushBack(maxIndex, maxBack, maxSize, head);
+
+        head = (head + 1 < window) ? head + 1 : 0;
+        totalSamples++;
+    }
+
+    ChannelStatistics summary() const {
+        ChannelStatistics stats;
+        stats.count = count;
+        stats.totalSamples = totalSamples;
+        if (count == 0) {
+            return stats;
+        }
+        stats.min = values[minIndex[minFront]];
+        stats.max = values[maxIndex[maxFront]];
+
+        int64_t n = count;
+        int64_t half = n / 2;
+        stats.mean = static_cast<int16_t>((sum >= 0 ? sum + half : sum - half) / n);
+        // n·Σx² − (Σx)² is exact; divide once at the end
+        int64_t scaledVariance = n * sumSquares - sum * sum;
+        stats.variance = static_cast<uint32_t>(scaledVariance / (n * n));
+        return stats;
+    }
+
+private:
+    uint8_t backIndex(uint8_t back) const {
+        return (back == 0) ? window - 1 : back - 1;
+    }
+
+    void pushBack(uint8_t* deque, uint8_t& back, uint8_t& size, uint8_t slot) {
+        deque[back] = slot;
+        back = (back + 1 < window) ? back + 1 : 0;
+        size++;
+    }
+
+    void popBack(uint8_t& back, uint8_t& size) {
+        back = backIndex(back);
+        size--;
+    }
+
+    void popFront(uint8_t& front, uint8_t& size) {
+        front = (front + 1 < window) ? front + 1 : 0;
+        size--;
+    }
+
+    int16_t values[CAPACITY] = {};
+    uint8_t minIndex[CAPACITY] = {};
+    uint8_t maxIndex[CAPACITY] = {};
+    int64_t sum = 0;
+    int64_t sumSquares = 0;
+    uint32_t totalSamples = 0;
+    uint8_t window = 0;
+    uint8_t head = 0;
+    uint8_t count = 0;
+    uint8_t minFront = 0, minBack = 0, minSize = 0;
+    uint8_t maxFront = 0, maxBack = 0, maxSize = 0;
+};
+
+} // namespace mb8art
+
+#endif // MB8ART_STATISTICS_H
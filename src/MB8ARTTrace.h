@@ -0,0 +1,279 @@
+#ifndef MB8ART_TRACE_H
+#define MB8ART_TRACE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <atomic>
+
+/**
+ * @file MB8ARTTrace.h
+ * @brief Binary ring of Modbus transactions for post-mortem analysis
+ *
+ * Every request stamp, response and error the driver sees is recorded as a
+ * fixed-size slot: microsecond and tick timestamps, function code, start
+ * address, length, result code, round-trip time and optionally the first
+ * PayloadBytes of the response. Error records capture the error name
+ * (getModbusErrorString()) instead, so a dump decodes without a copy of the
+ * ModbusError enum. The oldest slot is overwritten when full.
+ *
+ * Writers claim a slot with one atomic increment and publish it with a
+ * per-slot sequence number, so the request path, the response context and
+ * the error handler may record concurrently without a lock. dump() copies
+ * the slots out (dropping any slot rewritten during the copy) and streams
+ * them as a compact blob, oldest first:
+ *
+ *   header:  "MB8T" | version (u8) | server address (u8) | payload capacity (u8)
+ *            | reserved (u8) | record count (u16 LE) | lost (u32 LE)      14 bytes
+ *   record:  timestampUs (u32) | tick (u32) | rttUs (u32) | address (u16)
+ *            | length (u16) | function code (u8) | kind (u8) | result (u8)
+ *            | captured (u8) | captured payload bytes                20 + n bytes
+ *
+ * tools/mb8art_trace.py decodes a blob (raw or hex) into a timeline and can
+ * turn it into a C array for replay on the native test build
+ * (MockMB8ART::replayTrace()).
+ *
+ * @code
+ * static mb8art::StaticTrace<128, 16> trace;   // 128 × 44 B = 5.5 KB
+ * mb8art->attachTrace(&trace);
+ * ...
+ * trace.dump(writeToSerial, nullptr, mb8art->getServerAddress());
+ * @endcode
+ */
+
+namespace mb8art {
+
+enum class TraceKind : uint8_t {
+    REQUEST = 1,    // Request handed to the Modbus queue
+    RESPONSE = 2,   // Response delivered to the driver
+    ERROR = 3       // Modbus error reported to the driver (result = ModbusError)
+};
+
+/**
+ * @brief One transaction event; payload points into the recorder's copy
+ */
+struct TraceEvent {
+    uint32_t timestampUs = 0;  // esp_timer, low 32 bits
+    uint32_t tick = 0;         // xTaskGetTickCount()
+    uint32_t rttUs = 0;        // Request -> response/error, 0 if not known
+    uint16_t address = 0;      // Start register / coil
+    uint16_t length = 0;       // Payload length on the wire (ERROR: error name length)
+    uint8_t functionCode = 0;
+    TraceKind kind = TraceKind::RESPONSE;
+    uint8_t result = 0;        // 0 = success, else ModbusError value
+    uint8_t captured = 0;      // Payload bytes stored (<= payload capacity)
+    const uint8_t* payload = nullptr;
+};
+
+// Sink for dump(): return false to abort
+typedef bool (*TraceWriteFn)(void* context, const uint8_t* data, size_t length);
+
+class TraceBuffer {
+public:
+    static constexpr uint8_t FORMAT_VERSION = 1;
+    static constexpr size_t HEADER_SIZE = 14;
+    static constexpr size_t RECORD_HEADER_SIZE = 20;
+
+    struct Slot {
+        std::atomic<uint32_t> sequence{0};  // 0 = empty or being written
+        TraceEvent event;
+    };
+
+    TraceBuffer(Slot* slotStorage, uint8_t* payloadStorage, uint16_t slotCount, uint8_t payloadBytes)
+        : slots(slotStorage), payloads(payloadStorage), capacity(slotCount), payloadCapacity(payloadBytes) {}
+
+    TraceBuffer(const TraceBuffer&) = delete;
+    TraceBuffer& operator=(const TraceBuffer&) = delete;
+
+    /**
+     * @brief Record one event; payload may be nullptr (nothing captured)
+     */
+    void record(const TraceEvent& event, const uint8_t* payload) {
+        uint32_t sequence = head.fetch_add(1, std::memory_order_relaxed) + 1;
+        Slot& slot = slots[(sequence - 1) % capacity];
+        uint8_t* slotPayload = payloads + static_cast<size_t>((sequence - 1) % capacity) * payloadCapacity;
+
+        slot.sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.event = event;
+        slot.event.captured = 0;
+        if (payload != nullptr && payloadCapacity > 0) {
+            uint8_t n = event.length < payloadCapacity ? static_cast<uint8_t>(event.length) : payloadCapacity;
+            memcpy(slotPayload, payload, n);
+            slot.event.captured = n;
+        }
+        slot.event.payload = nullptr;
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.sequence.store(sequence, std::memory_order_relaxed);
+    }
+
+    void clear() {
+        for (uint16_t i = 0; i < capacity; i++) {
+            slots[i].sequence.store(0, std::memory_order_relaxed);
+        }
+        head.store(0, std::memory_order_release);
+    }
+
+    // Events recorded since clear(), including overwritten ones
+    uint32_t totalRecorded() const { return head.load(std::memory_order_relaxed); }
+    uint16_t getCapacity() const { return capacity; }
+    uint8_t getPayloadCapacity() const { return payloadCapacity; }
+
+    /**
+     * @brief Stream the ring as a blob (format in the file comment)
+     * @return Number of records written, or -1 if the sink aborted
+     */
+    int dump(TraceWriteFn write, void* context, uint8_t serverAddress = 0) const {
+        uint32_t newest = head.load(std::memory_order_acquire);
+        uint32_t oldest = newest > capacity ? newest - capacity + 1 : 1;
+
+        // Count records still intact, then stream them; a slot overwritten
+        // between the two passes is dropped from the second one, so the
+        // header count is an upper bound the decoder tolerates
+        uint16_t count = 0;
+        for (uint32_t seq = oldest; seq <= newest && seq != 0; seq++) {
+            if (slots[(seq - 1) % capacity].sequence.load(std::memory_order_acquire) == seq) {
+                count++;
+            }
+        }
+
+        uint8_t header[HEADER_SIZE] = {'M', 'B', '8', 'T', FORMAT_VERSION, serverAddress, payloadCapacity, 0};
+        putU16(header + 8, count);
+        putU32(header + 10, oldest - 1);
+        if (!write(context, header, sizeof(header))) {
+            return -1;
+        }
+
+        int written = 0;
+        uint8_t buffer[RECORD_HEADER_SIZE + 255];
+        for (uint32_t seq = oldest; seq <= newest && seq != 0 && written < count; seq++) {
+            uint32_t index = (seq - 1) % capacity;
+            const Slot& slot = slots[index];
+            if (slot.sequence.load(std::memory_order_acquire) != seq) {
+                continue;
+            }
+            TraceEvent copy = slot.event;
+            uint8_t captured = copy.captured <= payloadCapacity ? copy.captured : payloadCapacity;
+            memcpy(buffer + RECORD_HEADER_SIZE, payloads + static_cast<size_t>(index) * payloadCapacity, captured);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != seq) {
+                continue;  // Rewritten while copying
+            }
+            copy.captured = captured;
+            encodeRecord(copy, buffer);
+            if (!write(context, buffer, RECORD_HEADER_SIZE + captured)) {
+                return -1;
+            }
+            written++;
+        }
+        return written;
+    }
+
+    static void encodeRecord(const TraceEvent& e, uint8_t* out) {
+        putU32(out, e.timestampUs);
+        putU32(out + 4, e.tick);
+        putU32(out + 8, e.rttUs);
+        putU16(out + 12, e.address);
+        putU16(out + 14, e.length);
+        out[16] = e.functionCode;
+        out[17] = static_cast<uint8_t>(e.kind);
+        out[18] = e.result;
+        out[19] = e.captured;
+    }
+
+private:
+    static void putU16(uint8_t* p, uint16_t v) {
+        p[0] = static_cast<uint8_t>(v);
+        p[1] = static_cast<uint8_t>(v >> 8);
+    }
+
+    static void putU32(uint8_t* p, uint32_t v) {
+        putU16(p, static_cast<uint16_t>(v));
+        putU16(p + 2, static_cast<uint16_t>(v >> 16));
+    }
+
+    Slot* slots;
+    uint8_t* payloads;
+    const uint16_t capacity;
+    const uint8_t payloadCapacity;
+    std::atomic<uint32_t> head{0};  // Sequence of the newest claimed slot
+};
+
+/**
+ * @brief Trace ring with inline storage - declare static or global, no heap
+ * @tparam Records Slots in the ring
+ * @tparam PayloadBytes Response bytes kept per record (0 = headers only;
+ *         16 holds a full temperature frame)
+ */
+template <uint16_t Records, uint8_t PayloadBytes = 16>
+class StaticTrace : public TraceBuffer {
+    static_assert(Records >= 2, "StaticTrace needs at least 2 records");
+public:
+    StaticTrace() : TraceBuffer(slotStorage, payloadStorage, Records, PayloadBytes) {}
+
+private:
+    TraceBuffer::Slot slotStorage[Records];
+    uint8_t payloadStorage[static_cast<size_t>(Records) * (PayloadBytes > 0 ? PayloadBytes : 1)];
+};
+
+/**
+ * @brief Iterate the records of a dumped blob (host replay, self-test)
+ */
+class TraceBlobReader {
+public:
+    TraceBlobReader(const uint8_t* blob, size_t length) : data(blob), size(length), offset(0) {
+        valid = size >= TraceBuffer::HEADER_SIZE && memcmp(data, "MB8T", 4) == 0 &&
+                data[4] == TraceBuffer::FORMAT_VERSION;
+        if (valid) {
+            offset = TraceBuffer::HEADER_SIZE;
+        }
+    }
+
+    bool isValid() const { return valid; }
+    uint8_t serverAddress() const { return valid ? data[5] : 0; }
+    uint16_t recordCount() const { return valid ? static_cast<uint16_t>(data[8] | (data[9] << 8)) : 0; }
+
+    /**
+     * @return false at the end of the blob or on a truncated record
+     */
+    bool next(TraceEvent& out) {
+        if (!valid || offset + TraceBuffer::RECORD_HEADER_SIZE > size) {
+            return false;
+        }
+        const uint8_t* p = data + offset;
+        uint8_t captured = p[19];
+        if (offset + TraceBuffer::RECORD_HEADER_SIZE + captured > size) {
+            return false;
+        }
+        out.timestampUs = getU32(p);
+        out.tick = getU32(p + 4);
+        out.rttUs = getU32(p + 8);
+        out.address = getU16(p + 12);
+        out.length = getU16(p + 14);
+        out.functionCode = p[16];
+        out.kind = static_cast<TraceKind>(p[17]);
+        out.result = p[18];
+        out.captured = captured;
+        out.payload = p + TraceBuffer::RECORD_HEADER_SIZE;
+        offset += TraceBuffer::RECORD_HEADER_SIZE + captured;
+        return true;
+    }
+
+private:
+    static uint16_t getU16(const uint8_t* p) {
+        return static_cast<uint16_t>(p[0] | (p[1] << 8));
+    }
+
+    static uint32_t getU32(const uint8_t* p) {
+        return getU16(p) | (static_cast<uint32_t>(getU16(p + 2)) << 16);
+    }
+
+    const uint8_t* data;
+    size_t size;
+    size_t offset;
+    bool valid = false;
+};
+
+} // namespace mb8art
+
+#endif // MB8ART_TRACE_H
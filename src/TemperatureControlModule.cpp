@@ -5,7 +5,8 @@
 #include "MB8ARTSharedResources.h"
 
 // Constructor implementation
-TemperatureControlModule::TemperatureControlModule() {
+TemperatureControlModule::TemperatureControlModule(uint8_t moduleAddress)
+    : moduleAddress(moduleAddress) {
     // Simple initialization, no logging to avoid initialization order issues
 }
 
@@ -16,103 +17,191 @@ TemperatureControlModule::~TemperatureControlModule() {
 
 #ifdef MB8ART_ENABLE_MQTT
 void TemperatureControlModule::handleMessage(const std::string& topic, const std::string& payload) {
-    LOG_MB8ART_INFO_NL("Received MQTT message on topic: %s", topic.c_str());
-    LOG_MB8ART_INFO_NL("Message payload: %s", payload.c_str());
+    LOG_MB8ART_DEBUG_NL("Received MQTT message on topic: %s (%u bytes)", topic.c_str(),
+                        static_cast<unsigned>(payload.size()));
 
+    // Text commands like "configure_range:high" or "read_temperature"
     if (topic == "sensors/control") {
-        // Parse commands like "configure_range:high" or "read_temperature"
-        if (payload == "read_temperature") {
-            readTemperature();
-        } 
-        else if (payload.find("configure_range:") == 0) {
-            std::string rangeStr = payload.substr(16); // Extract after "configure_range:"
-            configureMeasurementRange(rangeStr);
-        }
-        else {
-            handleControlCommand(payload);
-        }
+        handleCommand(payload.data(), payload.size());
+    }
+    // Binary frames for high-rate remote control
+    else if (topic == "sensors/control/bin") {
+        handleBinaryCommands(reinterpret_cast<const uint8_t*>(payload.data()), payload.size());
     }
 }
 #endif
 
-void TemperatureControlModule::readTemperature() {
-    if (MB8ART_SRP_MB8ART == nullptr) {
-        LOG_MB8ART_ERROR_NL("MB8ART instance not available - cannot read temperature");
-        return;
-    }
-    
-    if (!MB8ART_SRP_MB8ART->isInitialized()) {
-        LOG_MB8ART_ERROR_NL("MB8ART instance not initialized - cannot read temperature");
-        return;
-    }
-    
-    MB8ART_SRP_MB8ART->requestAllData();
-    LOG_MB8ART_DEBUG_NL("Requesting temperature data via control module");
+MB8ART* TemperatureControlModule::findDevice() const {
+    return (moduleAddress != 0) ? MB8ART_SRP_MB8ART_BY_ADDRESS(moduleAddress) : MB8ART_SRP_MB8ART;
 }
 
-void TemperatureControlModule::configureMeasurementRange(const std::string& range) {
-    if (MB8ART_SRP_MB8ART == nullptr) {
-        LOG_MB8ART_ERROR_NL("MB8ART instance not available - cannot configure range");
-        return;
+MB8ART* TemperatureControlModule::resolveDevice(const char* action) const {
+    MB8ART* device = findDevice();
+    if (device == nullptr) {
+        LOG_MB8ART_ERROR_NL("MB8ART instance not available - cannot %s", action);
+        return nullptr;
     }
     
-    if (!MB8ART_SRP_MB8ART->isInitialized()) {
-        LOG_MB8ART_ERROR_NL("MB8ART instance not initialized - cannot configure range");
-        return;
+    if (!device->isInitialized()) {
+        LOG_MB8ART_ERROR_NL("MB8ART instance not initialized - cannot %s", action);
+        return nullptr;
     }
+    return device;
+}
 
-    if (range == "high") {
-        MB8ART_SRP_MB8ART->configureMeasurementRange(mb8art::MeasurementRange::HIGH_RES);
-        LOG_MB8ART_DEBUG_NL("Configured measurement range to HIGH_RES");
-    } 
-    else if (range == "low") {
-        MB8ART_SRP_MB8ART->configureMeasurementRange(mb8art::MeasurementRange::LOW_RES);
-        LOG_MB8ART_DEBUG_NL("Configured measurement range to LOW_RES");
-    }
-    else {
+void TemperatureControlModule::readTemperature() {
+    mb8art::ParsedCommand command;
+    command.id = mb8art::CommandId::READ_TEMPERATURE;
+    execute(command);
+}
+
+void TemperatureControlModule::configureMeasurementRange(const std::string& range) {
+    mb8art::ParsedCommand command;
+    if (!mb8art::parseCommandParam(mb8art::CommandParam::RANGE,
+                                   mb8art::StringRef(range.data(), range.size()), command.arg)) {
         LOG_MB8ART_ERROR_NL("Invalid measurement range: %s", range.c_str());
+        return;
     }
+    command.id = mb8art::CommandId::CONFIGURE_RANGE;
+    execute(command);
 }
 
 void TemperatureControlModule::handleControlCommand(const std::string& command, const std::string& parameter) {
     LOG_MB8ART_DEBUG_NL("Processing control command: %s", command.c_str());
-    
-    if (command == "read_temperature") {
-        readTemperature();
+
+    mb8art::ParsedCommand parsed;
+    mb8art::CommandStatus status = mb8art::parseCommand(mb8art::StringRef(command.data(), command.size()), parsed,
+                                                        mb8art::StringRef(parameter.data(), parameter.size()));
+    if (status == mb8art::CommandStatus::OK) {
+        execute(parsed);
+    } else if (status == mb8art::CommandStatus::INVALID_PARAMETER) {
+        LOG_MB8ART_ERROR_NL("Invalid parameter for %s: %s", command.c_str(), parameter.c_str());
+    } else {
+        LOG_MB8ART_ERROR_NL("Unknown control command: %s", command.c_str());
     }
-    else if (command == "configure_range") {
-        configureMeasurementRange(parameter);
+}
+
+mb8art::CommandStatus TemperatureControlModule::handleCommand(const char* text, size_t length) {
+    mb8art::ParsedCommand parsed;
+    mb8art::CommandStatus status = mb8art::parseCommand(mb8art::StringRef(text, length), parsed);
+    if (status == mb8art::CommandStatus::OK) {
+        return execute(parsed);
     }
-    else if (command == "print_settings") {
-        if (MB8ART_SRP_MB8ART == nullptr) {
-            LOG_MB8ART_ERROR_NL("MB8ART instance not available - cannot print settings");
-            return;
+    LOG_MB8ART_ERROR_NL("%s: %.*s",
+                        status == mb8art::CommandStatus::INVALID_PARAMETER ? "Invalid command parameter"
+                                                                          : "Unknown control command",
+                        static_cast<int>(length), text);
+    return status;
+}
+
+size_t TemperatureControlModule::handleBinaryCommands(const uint8_t* data, size_t length) {
+    size_t executed = 0;
+    for (size_t offset = 0; offset + mb8art::COMMAND_FRAME_SIZE <= length; offset += mb8art::COMMAND_FRAME_SIZE) {
+        mb8art::ParsedCommand parsed;
+        mb8art::CommandStatus status = mb8art::decodeCommandFrame(data + offset, parsed);
+        if (status != mb8art::CommandStatus::OK) {
+            LOG_MB8ART_ERROR_NL("Rejected binary command frame at offset %u (status %d)",
+                                static_cast<unsigned>(offset), static_cast<int>(status));
+            break;
         }
-        if (!MB8ART_SRP_MB8ART->isInitialized()) {
-            LOG_MB8ART_ERROR_NL("MB8ART instance not initialized - cannot print settings");
-            return;
+        if (execute(parsed) == mb8art::CommandStatus::OK) {
+            executed++;
         }
-        MB8ART_SRP_MB8ART->printModuleSettings();
     }
-    else if (command == "print_readings") {
-        if (MB8ART_SRP_MB8ART == nullptr) {
-            LOG_MB8ART_ERROR_NL("MB8ART instance not available - cannot print readings");
-            return;
-        }
-        if (!MB8ART_SRP_MB8ART->isInitialized()) {
-            LOG_MB8ART_ERROR_NL("MB8ART instance not initialized - cannot print readings");
-            return;
+    if (length % mb8art::COMMAND_FRAME_SIZE != 0) {
+        LOG_MB8ART_WARN_NL("Binary command payload of %u bytes has a partial frame",
+                           static_cast<unsigned>(length));
+    }
+    return executed;
+}
+
+mb8art::CommandStatus TemperatureControlModule::execute(const mb8art::ParsedCommand& command) {
+    const mb8art::CommandSpec* spec = mb8art::findCommand(command.id);
+    if (spec == nullptr) {
+        return mb8art::CommandStatus::UNKNOWN_COMMAND;
+    }
+
+    // One registry lookup per command
+    MB8ART* device = resolveDevice(spec->name.data);
+    if (device == nullptr) {
+        return mb8art::CommandStatus::DEVICE_UNAVAILABLE;  // resolveDevice() logged why
+    }
+
+    switch (command.id) {
+        case mb8art::CommandId::READ_TEMPERATURE:
+            device->requestAllData();
+            LOG_MB8ART_DEBUG_NL("Requesting temperature data via control module");
+            break;
+
+        case mb8art::CommandId::CONFIGURE_RANGE: {
+            mb8art::MeasurementRange range = static_cast<mb8art::MeasurementRange>(command.arg);
+            device->configureMeasurementRange(range);
+            LOG_MB8ART_DEBUG_NL("Configured measurement range to %s",
+                                range == mb8art::MeasurementRange::HIGH_RES ? "HIGH_RES" : "LOW_RES");
+            break;
         }
-        const mb8art::SensorReading* readings = MB8ART_SRP_MB8ART->getSensorReadings();
-        if (readings == nullptr) {
-            LOG_MB8ART_ERROR_NL("Sensor readings not available");
-            return;
+
+        case mb8art::CommandId::PRINT_SETTINGS:
+            device->printModuleSettings();
+            break;
+
+        case mb8art::CommandId::PRINT_READINGS: {
+            const auto readings = device->getSensorReadings();
+            for (int i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
+                device->printSensorReading(readings[i], i);
+            }
+            break;
         }
-        for (int i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
-            MB8ART_SRP_MB8ART->printSensorReading(readings[i], i);
+
+        case mb8art::CommandId::RESET_METRICS:
+            device->resetMetrics();
+            break;
+
+        default:
+            return mb8art::CommandStatus::UNKNOWN_COMMAND;
+    }
+    return mb8art::CommandStatus::OK;
+}
+
+bool TemperatureControlModule::fillExportFrame(mb8art::ExportFrame& frame) {
+    // Polled by scrapes and publish timers - an absent device is not worth a log line each time
+    MB8ART* device = findDevice();
+    if (device == nullptr || !device->isInitialized()) {
+        return false;
+    }
+
+    frame.address = device->getServerAddress();
+    frame.tag = device->getTag();
+    frame.uptimeMs = static_cast<uint32_t>(pdTICKS_TO_MS(xTaskGetTickCount()));
+    const mb8art::ChannelConfig* configs = device->getChannelConfigs();
+    for (uint8_t i = 0; i < DEFAULT_NUMBER_OF_SENSORS; i++) {
+        mb8art::ExportChannel& channel = frame.channels[i];
+        channel.mode = static_cast<uint8_t>(configs[i].mode);
+        if (channel.mode == static_cast<uint8_t>(mb8art::ChannelMode::DEACTIVATED)) {
+            continue;
         }
+        mb8art::HeldReading reading = device->getHeldReading(i);
+        channel.value = reading.value;
+        channel.divider = device->getSnapshotDivider(i);
+        channel.code = reading.code;
+        channel.ageMs = reading.ageMs;
     }
-    else {
-        LOG_MB8ART_ERROR_NL("Unknown control command: %s", command.c_str());
+    frame.metrics = device->getMetrics();
+    return true;
+}
+
+size_t TemperatureControlModule::exportCbor(uint8_t* out, size_t size) {
+    mb8art::ExportFrame frame;
+    if (out == nullptr || !fillExportFrame(frame)) {
+        return 0;
+    }
+    return mb8art::encodeCbor(frame, out, size);
+}
+
+size_t TemperatureControlModule::exportPrometheus(char* out, size_t size, bool includeTypes) {
+    mb8art::ExportFrame frame;
+    if (out == nullptr || !fillExportFrame(frame)) {
+        return 0;
     }
-}
\ No newline at end of file
+    return mb8art::formatPrometheus(frame, out, size, includeTypes);
+}
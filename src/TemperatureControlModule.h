@@ -4,7 +4,12 @@
 #define TEMPERATURECONTROLMODULE_H
 
 #include <string>
+#include <stdint.h>
 #include "MB8ARTLoggingMacros.h"
+#include "MB8ARTExport.h"
+#include "MB8ARTCommands.h"
+
+class MB8ART;
 
 // Optional MQTT support - define MB8ART_ENABLE_MQTT in your build flags to enable
 #ifdef MB8ART_ENABLE_MQTT
@@ -18,7 +23,11 @@ class TemperatureControlModule {
 #endif
 
 public:
-    TemperatureControlModule();
+    /**
+     * @param moduleAddress Modbus address of the MB8ART to control,
+     *        0 = the default instance (MB8ART_SRP_MB8ART)
+     */
+    explicit TemperatureControlModule(uint8_t moduleAddress = 0);
     virtual ~TemperatureControlModule();
 
 #ifdef MB8ART_ENABLE_MQTT
@@ -31,8 +40,45 @@ public:
     void configureMeasurementRange(const std::string& range);
     void handleControlCommand(const std::string& command, const std::string& parameter = "");
 
+    /**
+     * @brief Run one text command ("read_temperature", "configure_range:high")
+     *
+     * Table lookup (MB8ARTCommands.h) over the caller's bytes - no string
+     * copies - then one registry lookup for the device.
+     * @return OK once run; DEVICE_UNAVAILABLE if the module is missing or
+     *         not initialized
+     */
+    mb8art::CommandStatus handleCommand(const char* text, size_t length);
+
+    /**
+     * @brief Run concatenated 5-byte binary command frames
+     * @return Frames executed; decoding stops at the first bad frame, frames
+     *         for an unavailable device are decoded but not counted
+     */
+    size_t handleBinaryCommands(const uint8_t* data, size_t length);
+
+    // Execute an already parsed command
+    mb8art::CommandStatus execute(const mb8art::ParsedCommand& command);
+
+    /**
+     * @brief Serialize current readings and bus metrics into a caller buffer
+     *
+     * No heap use; cheap enough to publish every poll cycle. CBOR layout and
+     * Prometheus series are described in MB8ARTExport.h.
+     * @return Bytes written (Prometheus: excluding the terminator), 0 if the
+     *         device is unavailable or the buffer is too small
+     */
+    size_t exportCbor(uint8_t* out, size_t size);
+    size_t exportPrometheus(char* out, size_t size, bool includeTypes = true);
+    bool fillExportFrame(mb8art::ExportFrame& frame);
+
 private:
-    // Add any additional private members, methods, or variables here
+    // Registry lookup by moduleAddress (default instance for 0), no logging
+    MB8ART* findDevice() const;
+    // One registry lookup per command; nullptr (and logged) if unusable
+    MB8ART* resolveDevice(const char* action) const;
+
+    uint8_t moduleAddress;
 };
 
 #endif // TEMPERATURECONTROLMODULE_H
\ No newline at end of file
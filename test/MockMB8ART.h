@@ -109,6 +109,45 @@ public:
         handleModbusResponse(functionCode, address, data, length);
     }
     
+    /**
+     * @brief Feed a dumped transaction trace back through the driver
+     *
+     * Responses go to handleModbusResponse() with their captured payload,
+     * errors to handleModbusError(); requests are skipped. A response whose
+     * payload was only partly captured (trace payload capacity below the
+     * frame length) cannot be decoded as received and is skipped too.
+     * Produce the blob with tools/mb8art_trace.py --c-array from a field dump.
+     * @param truncated Optional: receives the number of skipped partial responses
+     * @return Number of events replayed, -1 if the blob is not a trace
+     */
+    int replayTrace(const uint8_t* blob, size_t length, int* truncated = nullptr) {
+        mb8art::TraceBlobReader reader(blob, length);
+        if (truncated != nullptr) {
+            *truncated = 0;
+        }
+        if (!reader.isValid()) {
+            return -1;
+        }
+        int replayed = 0;
+        mb8art::TraceEvent event;
+        while (reader.next(event)) {
+            if (event.kind == mb8art::TraceKind::RESPONSE) {
+                if (event.captured < event.length) {
+                    if (truncated != nullptr) {
+                        (*truncated)++;
+                    }
+                    continue;
+                }
+                simulateModbusResponse(event.functionCode, event.address, event.payload, event.length);
+                replayed++;
+            } else if (event.kind == mb8art::TraceKind::ERROR) {
+                simulateError(static_cast<ModbusError>(event.result));
+                replayed++;
+            }
+        }
+        return replayed;
+    }
+
     /**
      * @brief Simulate error response
      * @param error Error type to simulate
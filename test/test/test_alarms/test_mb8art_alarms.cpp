@@ -0,0 +1,252 @@
+/**
+ * @file test_mb8art_alarms.cpp
+ * @brief Unit tests for the per-channel alarm rules
+ *
+ * MB8ARTAlarms.h has no FreeRTOS dependency, so these tests run on the
+ * native (host) environment as well as on ESP32.
+ */
+
+#include <unity.h>
+#include "MB8ARTAlarms.h"
+
+using mb8art::AlarmInput;
+using mb8art::AlarmRule;
+using mb8art::AlarmType;
+using mb8art::ChannelAlarms;
+
+static AlarmRule makeRule(AlarmType type, int16_t threshold, int16_t hysteresis = 0,
+                          uint16_t onDelayMs = 0, uint16_t offDelayMs = 0) {
+    AlarmRule rule;
+    rule.type = type;
+    rule.threshold = threshold;
+    rule.hysteresis = hysteresis;
+    rule.onDelayMs = onDelayMs;
+    rule.offDelayMs = offDelayMs;
+    return rule;
+}
+
+static AlarmInput sample(int16_t value, uint32_t nowMs) {
+    AlarmInput input;
+    input.hasValue = true;
+    input.sensorOpen = false;
+    input.value = value;
+    input.nowMs = nowMs;
+    return input;
+}
+
+static AlarmInput noSample(uint32_t nowMs, bool sensorOpen = false) {
+    AlarmInput input;
+    input.hasValue = false;
+    input.sensorOpen = sensorOpen;
+    input.value = 0;
+    input.nowMs = nowMs;
+    return input;
+}
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Rule table
+// ============================================================================
+
+void test_rule_slots() {
+    ChannelAlarms alarms;
+    TEST_ASSERT_FALSE(alarms.hasRules());
+    TEST_ASSERT_FALSE(alarms.setRule(MB8ART_MAX_ALARM_RULES, makeRule(AlarmType::HIGH, 100)));
+    TEST_ASSERT_TRUE(alarms.setRule(1, makeRule(AlarmType::HIGH, 100)));
+    TEST_ASSERT_TRUE(alarms.hasRules());
+    TEST_ASSERT_TRUE(alarms.getRule(1).type == AlarmType::HIGH);
+
+    TEST_ASSERT_EQUAL_UINT8(0x02, alarms.evaluate(sample(150, 0)));
+    TEST_ASSERT_EQUAL_UINT8(0x02, alarms.getActiveMask());
+
+    // Replacing a rule drops its active state
+    TEST_ASSERT_TRUE(alarms.setRule(1, makeRule(AlarmType::LOW, 0)));
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.getActiveMask());
+
+    alarms.clear();
+    TEST_ASSERT_FALSE(alarms.hasRules());
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(sample(-500, 10)));
+}
+
+// ============================================================================
+// Level rules
+// ============================================================================
+
+void test_high_with_hysteresis() {
+    ChannelAlarms alarms;
+    alarms.setRule(0, makeRule(AlarmType::HIGH, 800, 20));  // 80.0 °C, clears below 78.0
+
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(sample(799, 0)));
+    TEST_ASSERT_EQUAL_UINT8(1, alarms.evaluate(sample(800, 1000)));
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(sample(790, 2000)));   // Inside the band
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(sample(780, 3000)));
+    TEST_ASSERT_EQUAL_UINT8(1, alarms.getActiveMask());
+    TEST_ASSERT_EQUAL_UINT8(1, alarms.evaluate(sample(779, 4000)));
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.getActiveMask());
+}
+
+void test_low_with_hysteresis() {
+    ChannelAlarms alarms;
+    alarms.setRule(0, makeRule(AlarmType::LOW, -50, 10));
+
+    TEST_ASSERT_EQUAL_UINT8(1, alarms.evaluate(sample(-50, 0)));
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(sample(-40, 1000)));
+    TEST_ASSERT_EQUAL_UINT8(1, alarms.evaluate(sample(-39, 2000)));
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.getActiveMask());
+}
+
+void test_missing_samples_hold_level_state() {
+    ChannelAlarms alarms;
+    alarms.setRule(0, makeRule(AlarmType::HIGH, 100));
+    alarms.evaluate(sample(200, 0));
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(noSample(1000)));
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(noSample(2000, true)));
+    TEST_ASSERT_EQUAL_UINT8(1, alarms.getActiveMask());
+}
+
+// ============================================================================
+// Delays
+// ============================================================================
+
+void test_on_and_off_delays() {
+    ChannelAlarms alarms;
+    alarms.setRule(0, makeRule(AlarmType::HIGH, 100, 0, 3000, 2000));
+
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(sample(150, 0)));
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(sample(150, 2000)));
+    // Condition broke - the on-delay starts over
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(sample(50, 2500)));
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(sample(150, 3000)));
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(sample(150, 5999)));
+    TEST_ASSERT_EQUAL_UINT8(1, alarms.evaluate(sample(150, 6000)));
+
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(sample(50, 7000)));
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(sample(50, 8999)));
+    TEST_ASSERT_EQUAL_UINT8(1, alarms.evaluate(sample(50, 9000)));
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.getActiveMask());
+}
+
+// ============================================================================
+// Rate of rise
+// ============================================================================
+
+void test_rate_of_rise() {
+    ChannelAlarms alarms;
+    alarms.setRule(0, makeRule(AlarmType::RATE_OF_RISE, 100, 50));  // 10.0 °C/min
+
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(sample(200, 0)));         // No rate yet
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(sample(250, 60000)));     // 50/min
+    TEST_ASSERT_EQUAL_UINT8(1, alarms.evaluate(sample(260, 66000)));     // 100/min
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(sample(266, 72000)));     // 60/min, inside band
+    TEST_ASSERT_EQUAL_UINT8(1, alarms.evaluate(sample(266, 78000)));     // 0/min
+}
+
+void test_rate_of_rise_large_delta_does_not_overflow() {
+    ChannelAlarms alarms;
+    alarms.setRule(0, makeRule(AlarmType::RATE_OF_RISE, 1000));
+
+    // 60000 counts in one second = 3.6M counts/min; delta × 60000 needs 64 bits
+    alarms.evaluate(sample(-30000, 0));
+    TEST_ASSERT_EQUAL_UINT8(1, alarms.evaluate(sample(30000, 1000)));
+
+    // Falling by the same amount is a large negative rate, not a rise
+    ChannelAlarms falling;
+    falling.setRule(0, makeRule(AlarmType::RATE_OF_RISE, 1000));
+    falling.evaluate(sample(INT16_MAX, 0));
+    TEST_ASSERT_EQUAL_UINT8(0, falling.evaluate(sample(INT16_MIN, 1)));
+    TEST_ASSERT_EQUAL_UINT8(0, falling.getActiveMask());
+}
+
+void test_rate_resets_across_open_sensor() {
+    ChannelAlarms alarms;
+    alarms.setRule(0, makeRule(AlarmType::RATE_OF_RISE, 100));
+
+    alarms.evaluate(sample(0, 0));
+    alarms.evaluate(noSample(1000, true));
+    // First sample after the outage has no predecessor - no rate
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(sample(5000, 2000)));
+    TEST_ASSERT_EQUAL_UINT8(1, alarms.evaluate(sample(5200, 62000)));
+}
+
+// ============================================================================
+// Stale and open sensor
+// ============================================================================
+
+void test_stale_after_threshold_seconds() {
+    ChannelAlarms alarms;
+    alarms.setRule(0, makeRule(AlarmType::STALE, 5));
+
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(sample(100, 1000)));
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(noSample(5999)));
+    TEST_ASSERT_EQUAL_UINT8(1, alarms.evaluate(noSample(6000)));
+    TEST_ASSERT_EQUAL_UINT8(1, alarms.evaluate(sample(100, 7000)));
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.getActiveMask());
+}
+
+void test_stale_counts_from_first_evaluation() {
+    ChannelAlarms alarms;
+    alarms.setRule(0, makeRule(AlarmType::STALE, 2));
+
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(noSample(10000)));
+    TEST_ASSERT_EQUAL_UINT8(1, alarms.evaluate(noSample(12000)));
+}
+
+void test_sensor_open() {
+    ChannelAlarms alarms;
+    alarms.setRule(2, makeRule(AlarmType::SENSOR_OPEN, 0));
+
+    TEST_ASSERT_EQUAL_UINT8(0x04, alarms.evaluate(noSample(0, true)));
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.evaluate(noSample(1000)));   // Timeout proves nothing
+    TEST_ASSERT_EQUAL_UINT8(0x04, alarms.evaluate(sample(200, 2000)));
+    TEST_ASSERT_EQUAL_UINT8(0, alarms.getActiveMask());
+}
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_rule_slots);
+    RUN_TEST(test_high_with_hysteresis);
+    RUN_TEST(test_low_with_hysteresis);
+    RUN_TEST(test_missing_samples_hold_level_state);
+    RUN_TEST(test_on_and_off_delays);
+    RUN_TEST(test_rate_of_rise);
+    RUN_TEST(test_rate_of_rise_large_delta_does_not_overflow);
+    RUN_TEST(test_rate_resets_across_open_sensor);
+    RUN_TEST(test_stale_after_threshold_seconds);
+    RUN_TEST(test_stale_counts_from_first_evaluation);
+    RUN_TEST(test_sensor_open);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_rule_slots);
+    RUN_TEST(test_high_with_hysteresis);
+    RUN_TEST(test_low_with_hysteresis);
+    RUN_TEST(test_missing_samples_hold_level_state);
+    RUN_TEST(test_on_and_off_delays);
+    RUN_TEST(test_rate_of_rise);
+    RUN_TEST(test_rate_of_rise_large_delta_does_not_overflow);
+    RUN_TEST(test_rate_resets_across_open_sensor);
+    RUN_TEST(test_stale_after_threshold_seconds);
+    RUN_TEST(test_stale_counts_from_first_evaluation);
+    RUN_TEST(test_sensor_open);
+    return UNITY_END();
+}
+#endif
@@ -0,0 +1,191 @@
+/**
+ * @file test_mb8art_channel_modes.cpp
+ * @brief Unit tests for the channel mode table, per-channel scales and fixed-point helpers
+ *
+ * MB8ARTChannelModes.h has no FreeRTOS dependency, so these tests run on the
+ * native (host) environment as well as on ESP32.
+ */
+
+#include <unity.h>
+#include <string.h>
+#include "MB8ARTChannelModes.h"
+
+using mb8art::ChannelMode;
+using mb8art::ChannelScale;
+using mb8art::MeasurementRange;
+using mb8art::channelScale;
+using mb8art::formatFixedPoint;
+using mb8art::rescaleFixedPoint;
+
+static uint16_t modeOf(ChannelMode mode) {
+    return static_cast<uint16_t>(mode);
+}
+
+static void assertDivider(int16_t expected, ChannelMode mode, uint16_t subType, MeasurementRange range) {
+    TEST_ASSERT_EQUAL_INT16(expected, channelScale(modeOf(mode), subType, range).divider);
+}
+
+static void assertFormatted(const char* expected, int32_t value, int16_t divider) {
+    char buffer[24];
+    formatFixedPoint(buffer, sizeof(buffer), value, divider);
+    TEST_ASSERT_EQUAL_STRING(expected, buffer);
+}
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Scale table
+// ============================================================================
+
+void test_thermocouple_stays_tenths_in_high_res() {
+    for (uint16_t type = 0; type <= static_cast<uint16_t>(mb8art::ThermocoupleType::TYPE_N); type++) {
+        assertDivider(10, ChannelMode::THERMOCOUPLE, type, MeasurementRange::LOW_RES);
+        assertDivider(10, ChannelMode::THERMOCOUPLE, type, MeasurementRange::HIGH_RES);
+    }
+    ChannelScale scale = channelScale(modeOf(ChannelMode::THERMOCOUPLE), 1, MeasurementRange::HIGH_RES);
+    TEST_ASSERT_EQUAL_INT16(-2000, scale.validMin);
+    TEST_ASSERT_EQUAL_INT16(8500, scale.validMax);
+}
+
+void test_rtd_follows_resolution() {
+    for (uint16_t type = 0; type <= static_cast<uint16_t>(mb8art::PTType::CU100); type++) {
+        assertDivider(10, ChannelMode::PT_INPUT, type, MeasurementRange::LOW_RES);
+        assertDivider(100, ChannelMode::PT_INPUT, type, MeasurementRange::HIGH_RES);
+    }
+    ChannelScale scale = channelScale(modeOf(ChannelMode::PT_INPUT), 1, MeasurementRange::HIGH_RES);
+    TEST_ASSERT_EQUAL_INT16(-20000, scale.validMin);
+    TEST_ASSERT_EQUAL_INT16(20000, scale.validMax);
+}
+
+void test_analog_ignores_resolution() {
+    static const int16_t voltageDividers[4] = {1000, 100, 100, 10};
+    for (uint16_t range = 0; range < 4; range++) {
+        assertDivider(voltageDividers[range], ChannelMode::VOLTAGE, range, MeasurementRange::LOW_RES);
+        assertDivider(voltageDividers[range], ChannelMode::VOLTAGE, range, MeasurementRange::HIGH_RES);
+    }
+    for (uint16_t range = 0; range < 2; range++) {
+        assertDivider(100, ChannelMode::CURRENT, range, MeasurementRange::LOW_RES);
+        assertDivider(100, ChannelMode::CURRENT, range, MeasurementRange::HIGH_RES);
+    }
+    ChannelScale scale = channelScale(modeOf(ChannelMode::VOLTAGE), 0, MeasurementRange::LOW_RES);
+    TEST_ASSERT_EQUAL_INT16(-15000, scale.validMin);
+    TEST_ASSERT_EQUAL_INT16(15000, scale.validMax);
+}
+
+void test_unknown_pair_falls_back_to_low_res_temperature() {
+    assertDivider(10, ChannelMode::VOLTAGE, 4, MeasurementRange::HIGH_RES);
+    assertDivider(10, ChannelMode::PT_INPUT, 4, MeasurementRange::HIGH_RES);
+    TEST_ASSERT_EQUAL_INT16(10, channelScale(7, 0, MeasurementRange::HIGH_RES).divider);
+    assertDivider(10, ChannelMode::DEACTIVATED, 0, MeasurementRange::HIGH_RES);
+}
+
+void test_subtype_lookup_and_names() {
+    TEST_ASSERT_NOT_NULL(mb8art::findSubType(modeOf(ChannelMode::CURRENT), 1));
+    TEST_ASSERT_NULL(mb8art::findSubType(modeOf(ChannelMode::CURRENT), 2));
+    TEST_ASSERT_NULL(mb8art::findSubType(5, 0));
+    TEST_ASSERT_EQUAL_STRING("PT1000", mb8art::ptTypeToString(mb8art::PTType::PT1000));
+    TEST_ASSERT_EQUAL_STRING("UNKNOWN_VOLTAGE_RANGE", mb8art::subTypeToString(modeOf(ChannelMode::VOLTAGE), 9));
+    TEST_ASSERT_EQUAL_STRING("UNKNOWN", mb8art::channelModeToString(static_cast<ChannelMode>(9)));
+}
+
+// ============================================================================
+// Fixed-point helpers
+// ============================================================================
+
+void test_rescale_rounds_half_away_from_zero() {
+    TEST_ASSERT_EQUAL_INT32(74, rescaleFixedPoint(735, 100, 10));
+    TEST_ASSERT_EQUAL_INT32(73, rescaleFixedPoint(734, 100, 10));
+    TEST_ASSERT_EQUAL_INT32(-74, rescaleFixedPoint(-735, 100, 10));
+    TEST_ASSERT_EQUAL_INT32(-73, rescaleFixedPoint(-734, 100, 10));
+    TEST_ASSERT_EQUAL_INT32(-2000, rescaleFixedPoint(-20000, 100, 10));
+}
+
+void test_rescale_same_or_finer_divider() {
+    TEST_ASSERT_EQUAL_INT32(244, rescaleFixedPoint(244, 10, 10));
+    TEST_ASSERT_EQUAL_INT32(2440, rescaleFixedPoint(244, 10, 100));
+    TEST_ASSERT_EQUAL_INT32(-85000, rescaleFixedPoint(-8500, 10, 100));
+    // Invalid dividers leave the value alone
+    TEST_ASSERT_EQUAL_INT32(123, rescaleFixedPoint(123, 0, 10));
+}
+
+void test_format_uses_divider_decimals() {
+    assertFormatted("24.4", 244, 10);
+    assertFormatted("24.40", 2440, 100);
+    assertFormatted("15.000", 15000, 1000);
+    assertFormatted("1000.0", 10000, 10);
+    assertFormatted("7", 7, 1);
+}
+
+void test_format_keeps_sign_near_zero() {
+    assertFormatted("-0.38", -38, 100);
+    assertFormatted("-0.4", -4, 10);
+    assertFormatted("0.05", 5, 100);
+    assertFormatted("-2147483.648", INT32_MIN, 1000);
+}
+
+void test_format_non_decimal_divider() {
+    assertFormatted("25/4", 25, 4);
+    assertFormatted("-3/16", -3, 16);
+}
+
+void test_linear_scale_rounds_symmetrically() {
+    // Gain 0.5: odd inputs land exactly on a half
+    mb8art::LinearScale half = mb8art::LinearScale::fromFloat(0.5f, 0.0f, 1);
+    TEST_ASSERT_EQUAL_INT32(2, half.apply(3, 1));
+    TEST_ASSERT_EQUAL_INT32(-2, half.apply(-3, 1));
+    TEST_ASSERT_EQUAL_INT32(1, half.apply(1, 1));
+    TEST_ASSERT_EQUAL_INT32(-1, half.apply(-1, 1));
+    TEST_ASSERT_EQUAL_INT32(-1, half.apply(-2, 1));
+
+    // Offset is added after rounding; input divider scales first
+    mb8art::LinearScale shifted = mb8art::LinearScale::fromFloat(0.5f, -10.0f, 1);
+    TEST_ASSERT_EQUAL_INT32(-12, shifted.apply(-30, 10));
+    TEST_ASSERT_EQUAL_INT32(-8, shifted.apply(30, 10));
+}
+
+// ============================================================================
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_thermocouple_stays_tenths_in_high_res);
+    RUN_TEST(test_rtd_follows_resolution);
+    RUN_TEST(test_analog_ignores_resolution);
+    RUN_TEST(test_unknown_pair_falls_back_to_low_res_temperature);
+    RUN_TEST(test_subtype_lookup_and_names);
+    RUN_TEST(test_rescale_rounds_half_away_from_zero);
+    RUN_TEST(test_rescale_same_or_finer_divider);
+    RUN_TEST(test_format_uses_divider_decimals);
+    RUN_TEST(test_format_keeps_sign_near_zero);
+    RUN_TEST(test_format_non_decimal_divider);
+    RUN_TEST(test_linear_scale_rounds_symmetrically);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_thermocouple_stays_tenths_in_high_res);
+    RUN_TEST(test_rtd_follows_resolution);
+    RUN_TEST(test_analog_ignores_resolution);
+    RUN_TEST(test_unknown_pair_falls_back_to_low_res_temperature);
+    RUN_TEST(test_subtype_lookup_and_names);
+    RUN_TEST(test_rescale_rounds_half_away_from_zero);
+    RUN_TEST(test_rescale_same_or_finer_divider);
+    RUN_TEST(test_format_uses_divider_decimals);
+    RUN_TEST(test_format_keeps_sign_near_zero);
+    RUN_TEST(test_format_non_decimal_divider);
+    RUN_TEST(test_linear_scale_rounds_symmetrically);
+    return UNITY_END();
+}
+#endif
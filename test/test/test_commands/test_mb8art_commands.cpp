@@ -0,0 +1,192 @@
+/**
+ * @file test_mb8art_commands.cpp
+ * @brief Unit tests for the command table, text parser and binary framing
+ *
+ * MB8ARTCommands.h has no FreeRTOS dependency, so these tests run on the
+ * native (host) environment as well as on ESP32. The TemperatureControlModule
+ * availability test needs the full driver and runs on ESP32 only.
+ */
+
+#include <unity.h>
+#include <string.h>
+#include "MB8ARTCommands.h"
+
+using mb8art::CommandId;
+using mb8art::CommandStatus;
+using mb8art::ParsedCommand;
+using mb8art::StringRef;
+
+static CommandStatus parse(const char* text, ParsedCommand& out, const char* param = "") {
+    return mb8art::parseCommand(StringRef(text, strlen(text)), out, StringRef(param, strlen(param)));
+}
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Table lookup and text parsing
+// ============================================================================
+
+void test_every_table_entry_is_found() {
+    for (const mb8art::CommandSpec& spec : mb8art::COMMAND_TABLE) {
+        const mb8art::CommandSpec* byName = mb8art::findCommand(spec.name);
+        TEST_ASSERT_EQUAL_PTR(&spec, byName);
+        TEST_ASSERT_EQUAL_PTR(&spec, mb8art::findCommand(spec.id));
+    }
+    TEST_ASSERT_NULL(mb8art::findCommand(StringRef("read_temp")));
+    TEST_ASSERT_NULL(mb8art::findCommand(StringRef("read_temperatures")));
+    TEST_ASSERT_NULL(mb8art::findCommand(StringRef("")));
+    TEST_ASSERT_NULL(mb8art::findCommand(StringRef("zzz")));
+    TEST_ASSERT_NULL(mb8art::findCommand(CommandId::NONE));
+}
+
+void test_text_forms() {
+    ParsedCommand command;
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandStatus::OK), static_cast<int>(parse("read_temperature", command)));
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandId::READ_TEMPERATURE), static_cast<int>(command.id));
+
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandStatus::OK), static_cast<int>(parse("configure_range:high", command)));
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandId::CONFIGURE_RANGE), static_cast<int>(command.id));
+    TEST_ASSERT_EQUAL_UINT16(1, command.arg);
+
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandStatus::OK), static_cast<int>(parse("configure_range low", command)));
+    TEST_ASSERT_EQUAL_UINT16(0, command.arg);
+
+    // Legacy handleControlCommand(command, parameter)
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandStatus::OK),
+                      static_cast<int>(parse("configure_range", command, "high")));
+    TEST_ASSERT_EQUAL_UINT16(1, command.arg);
+
+    // Payload slice that is not NUL-terminated at the command's end
+    const char* payload = "print_settingsXYZ";
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandStatus::OK),
+                      static_cast<int>(mb8art::parseCommand(StringRef(payload, 14), command)));
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandId::PRINT_SETTINGS), static_cast<int>(command.id));
+}
+
+void test_text_errors_leave_command_untouched() {
+    ParsedCommand command;
+    command.id = CommandId::PRINT_READINGS;
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandStatus::UNKNOWN_COMMAND), static_cast<int>(parse("reboot", command)));
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandStatus::INVALID_PARAMETER),
+                      static_cast<int>(parse("configure_range:medium", command)));
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandStatus::INVALID_PARAMETER),
+                      static_cast<int>(parse("configure_range", command)));
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandId::PRINT_READINGS), static_cast<int>(command.id));
+}
+
+// ============================================================================
+// Binary framing
+// ============================================================================
+
+void test_binary_round_trip() {
+    ParsedCommand command;
+    command.id = CommandId::CONFIGURE_RANGE;
+    command.arg = 1;
+    uint8_t frame[mb8art::COMMAND_FRAME_SIZE];
+    mb8art::encodeCommandFrame(command, frame);
+    TEST_ASSERT_EQUAL_UINT8(0xA5, frame[0]);
+    TEST_ASSERT_EQUAL_UINT8(2, frame[1]);
+    TEST_ASSERT_EQUAL_UINT8(1, frame[2]);
+    TEST_ASSERT_EQUAL_UINT8(0, frame[3]);
+    // CRC-8/SMBUS check value of "123456789" is 0xF4
+    TEST_ASSERT_EQUAL_UINT8(0xF4, mb8art::commandFrameCrc(reinterpret_cast<const uint8_t*>("123456789"), 9));
+
+    ParsedCommand decoded;
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandStatus::OK), static_cast<int>(mb8art::decodeCommandFrame(frame, decoded)));
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandId::CONFIGURE_RANGE), static_cast<int>(decoded.id));
+    TEST_ASSERT_EQUAL_UINT16(1, decoded.arg);
+}
+
+void test_binary_rejects_bad_frames() {
+    ParsedCommand command;
+    command.id = CommandId::CONFIGURE_RANGE;
+    command.arg = 1;
+    uint8_t frame[mb8art::COMMAND_FRAME_SIZE];
+    ParsedCommand decoded;
+
+    mb8art::encodeCommandFrame(command, frame);
+    frame[2] ^= 0x01;  // Bit flip in the argument
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandStatus::BAD_FRAME), static_cast<int>(mb8art::decodeCommandFrame(frame, decoded)));
+
+    mb8art::encodeCommandFrame(command, frame);
+    frame[0] = 0x5A;
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandStatus::BAD_FRAME), static_cast<int>(mb8art::decodeCommandFrame(frame, decoded)));
+
+    // Valid CRC, but unknown id / out-of-range argument
+    command.id = static_cast<CommandId>(0x7F);
+    mb8art::encodeCommandFrame(command, frame);
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandStatus::UNKNOWN_COMMAND), static_cast<int>(mb8art::decodeCommandFrame(frame, decoded)));
+
+    command.id = CommandId::CONFIGURE_RANGE;
+    command.arg = 7;
+    mb8art::encodeCommandFrame(command, frame);
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandStatus::INVALID_PARAMETER), static_cast<int>(mb8art::decodeCommandFrame(frame, decoded)));
+}
+
+#ifdef ARDUINO
+#include "MockMB8ART.h"
+#include "TemperatureControlModule.h"
+
+void test_unavailable_device_is_reported() {
+    const char* text = "read_temperature";
+
+    // Nothing registered at 0x7E
+    TemperatureControlModule missing(0x7E);
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandStatus::DEVICE_UNAVAILABLE),
+                      static_cast<int>(missing.handleCommand(text, strlen(text))));
+
+    // Registered by its constructor, but initialize() never ran
+    MockMB8ART device(0x7D);
+    TemperatureControlModule control(0x7D);
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandStatus::DEVICE_UNAVAILABLE),
+                      static_cast<int>(control.handleCommand(text, strlen(text))));
+
+    // Parse errors still win over availability
+    TEST_ASSERT_EQUAL(static_cast<int>(CommandStatus::UNKNOWN_COMMAND),
+                      static_cast<int>(control.handleCommand("reboot", 6)));
+
+    uint8_t frame[mb8art::COMMAND_FRAME_SIZE];
+    ParsedCommand command;
+    command.id = CommandId::READ_TEMPERATURE;
+    mb8art::encodeCommandFrame(command, frame);
+    TEST_ASSERT_EQUAL(0, static_cast<int>(control.handleBinaryCommands(frame, sizeof(frame))));
+}
+#endif
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_every_table_entry_is_found);
+    RUN_TEST(test_text_forms);
+    RUN_TEST(test_text_errors_leave_command_untouched);
+    RUN_TEST(test_binary_round_trip);
+    RUN_TEST(test_binary_rejects_bad_frames);
+    RUN_TEST(test_unavailable_device_is_reported);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_every_table_entry_is_found);
+    RUN_TEST(test_text_forms);
+    RUN_TEST(test_text_errors_leave_command_untouched);
+    RUN_TEST(test_binary_round_trip);
+    RUN_TEST(test_binary_rejects_bad_frames);
+    return UNITY_END();
+}
+#endif
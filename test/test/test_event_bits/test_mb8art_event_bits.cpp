@@ -0,0 +1,320 @@
+/**
+ * @file test_mb8art_event_bits.cpp
+ * @brief Unit tests and kernel-call benchmark for sensor event coalescing
+ *
+ * MB8ARTEventBits.h has no FreeRTOS dependency, so these tests run on the
+ * native (host) environment as well as on ESP32. The event group is modelled
+ * by a counter of set/clear calls - each one is a kernel entry on target.
+ */
+
+#include <unity.h>
+#include <stdio.h>
+#include "MB8ARTEventBits.h"
+
+using mb8art::EventBitsCommit;
+using mb8art::SensorEventPublisher;
+
+// Interleaved layout as in MB8ART.h: U0 E0 ... U7 E7, alarms in bits 16-23
+static const uint32_t UPDATE_BITS = 0x5555;
+static const uint32_t ERROR_BITS = 0xAAAA;
+static const uint32_t ALARM_BITS = 0x00FF0000;
+static const uint32_t LEVEL_BITS = ERROR_BITS | ALARM_BITS;
+
+static uint32_t updateBit(uint8_t ch) { return 1UL << (ch * 2); }
+static uint32_t errorBit(uint8_t ch) { return 1UL << (ch * 2 + 1); }
+static uint32_t alarmBit(uint8_t ch) { return 1UL << (16 + ch); }
+
+// Event group stand-in: current bits plus kernel entries taken
+struct CountingEventGroup {
+    uint32_t bits;
+    uint32_t kernelCalls;
+
+    void set(uint32_t b) { bits |= b; kernelCalls++; }
+    void clear(uint32_t b) { bits &= ~b; kernelCalls++; }
+    void apply(const EventBitsCommit& commit) {
+        if (commit.toClear) {
+            clear(commit.toClear);
+        }
+        if (commit.toSet) {
+            set(commit.toSet);
+        }
+    }
+};
+
+// Uncontended commit: prepare, (kernel calls), finish
+static EventBitsCommit commitNow(SensorEventPublisher& publisher, uint32_t toSet, uint32_t toClear) {
+    EventBitsCommit commit = publisher.prepare(toSet, toClear);
+    publisher.finish(commit);
+    return commit;
+}
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Commit semantics
+// ============================================================================
+
+void test_clear_of_unpublished_level_is_dropped() {
+    SensorEventPublisher publisher(LEVEL_BITS);
+
+    // Nothing published yet: clearing error bits needs no kernel call
+    EventBitsCommit commit = commitNow(publisher, updateBit(0), errorBit(0));
+    TEST_ASSERT_EQUAL_UINT32(0, commit.toClear);
+    TEST_ASSERT_EQUAL_UINT32(updateBit(0), commit.toSet);
+
+    // Published error is cleared once, then no more
+    commitNow(publisher, errorBit(1), 0);
+    commit = commitNow(publisher, 0, errorBit(1));
+    TEST_ASSERT_EQUAL_UINT32(errorBit(1), commit.toClear);
+    commit = commitNow(publisher, 0, errorBit(1));
+    TEST_ASSERT_EQUAL_UINT32(0, commit.toClear);
+}
+
+void test_edge_bits_and_sets_pass_through() {
+    SensorEventPublisher publisher(LEVEL_BITS);
+
+    // Update bits are consumer-cleared: always forwarded
+    EventBitsCommit commit = commitNow(publisher, 0, updateBit(3));
+    TEST_ASSERT_EQUAL_UINT32(updateBit(3), commit.toClear);
+
+    // Sets are never skipped, even if already published
+    commitNow(publisher, alarmBit(2), 0);
+    commit = commitNow(publisher, alarmBit(2), 0);
+    TEST_ASSERT_EQUAL_UINT32(alarmBit(2), commit.toSet);
+
+    // A bit in both masks ends up set and is not cleared first
+    commit = commitNow(publisher, errorBit(4), errorBit(4));
+    TEST_ASSERT_EQUAL_UINT32(0, commit.toClear);
+    TEST_ASSERT_EQUAL_UINT32(errorBit(4), commit.toSet);
+    TEST_ASSERT_EQUAL_UINT32(alarmBit(2) | errorBit(4), publisher.getPublishedLevels());
+}
+
+void test_forget_after_external_clear() {
+    SensorEventPublisher publisher(LEVEL_BITS);
+    commitNow(publisher, errorBit(0) | errorBit(1), 0);
+
+    publisher.forget(errorBit(0));
+    TEST_ASSERT_EQUAL_UINT32(errorBit(1), publisher.getPublishedLevels());
+    EventBitsCommit commit = commitNow(publisher, 0, errorBit(0) | errorBit(1));
+    TEST_ASSERT_EQUAL_UINT32(errorBit(1), commit.toClear);
+}
+
+void test_group_matches_requested_state() {
+    // Whatever is skipped, the group must end up where the uncoalesced
+    // clear-then-set sequence would have left it
+    SensorEventPublisher publisher(LEVEL_BITS);
+    CountingEventGroup coalesced = {0, 0};
+    CountingEventGroup reference = {0, 0};
+    uint32_t seed = 12345;
+
+    for (uint32_t i = 0; i < 2000; i++) {
+        seed = seed * 1103515245UL + 12345UL;
+        uint32_t toSet = (seed >> 3) & (UPDATE_BITS | LEVEL_BITS);
+        seed = seed * 1103515245UL + 12345UL;
+        uint32_t toClear = (seed >> 5) & LEVEL_BITS;
+
+        coalesced.apply(commitNow(publisher, toSet, toClear));
+        reference.clear(toClear);
+        reference.set(toSet);
+
+        // Consumer clears update bits on wait
+        coalesced.bits &= ~UPDATE_BITS;
+        reference.bits &= ~UPDATE_BITS;
+        TEST_ASSERT_EQUAL_HEX32(reference.bits, coalesced.bits);
+    }
+}
+
+// Two contexts commit at once and their kernel calls land in the opposite
+// order: a set overtaken by a clear must keep the bit published, so the next
+// clear still reaches the group instead of leaving the bit stuck
+void test_overlapping_set_keeps_bit_published() {
+    SensorEventPublisher publisher(LEVEL_BITS);
+    CountingEventGroup group = {0, 0};
+    commitNow(publisher, errorBit(2), 0);
+    group.set(errorBit(2));
+
+    EventBitsCommit clearing = publisher.prepare(0, errorBit(2));
+    EventBitsCommit setting = publisher.prepare(errorBit(2), 0);
+    TEST_ASSERT_EQUAL_UINT32(errorBit(2), clearing.toClear);
+    group.apply(setting);
+    publisher.finish(setting);
+    group.apply(clearing);
+    publisher.finish(clearing);
+    TEST_ASSERT_EQUAL_UINT32(errorBit(2), publisher.getPublishedLevels() & errorBit(2));
+
+    // Set lands after the clear: group has the bit, publisher must too
+    EventBitsCommit setting2 = publisher.prepare(alarmBit(1), 0);
+    EventBitsCommit clearing2 = publisher.prepare(0, alarmBit(1));
+    group.apply(clearing2);
+    publisher.finish(clearing2);
+    group.apply(setting2);
+    publisher.finish(setting2);
+    TEST_ASSERT_EQUAL_UINT32(alarmBit(1), group.bits & alarmBit(1));
+    TEST_ASSERT_EQUAL_UINT32(alarmBit(1), publisher.getPublishedLevels() & alarmBit(1));
+
+    // Uncontended clears then reach the group and unpublish the bits
+    group.apply(commitNow(publisher, 0, errorBit(2) | alarmBit(1)));
+    TEST_ASSERT_EQUAL_UINT32(0, group.bits & (errorBit(2) | alarmBit(1)));
+    TEST_ASSERT_EQUAL_UINT32(0, publisher.getPublishedLevels());
+}
+
+// Random interleavings of two committers: whatever the kernel order, the
+// group never holds a level bit the publisher considers clear
+void test_published_levels_cover_group() {
+    SensorEventPublisher publisher(LEVEL_BITS);
+    CountingEventGroup group = {0, 0};
+    uint32_t seed = 777;
+    for (uint32_t i = 0; i < 5000; i++) {
+        seed = seed * 1103515245UL + 12345UL;
+        uint32_t setA = (seed >> 4) & ERROR_BITS;
+        uint32_t clearB = (seed >> 9) & ERROR_BITS;
+        EventBitsCommit a = publisher.prepare(setA, 0);
+        EventBitsCommit b = publisher.prepare(0, clearB);
+        if (seed & 0x10000) {
+            group.apply(a);
+            group.apply(b);
+        } else {
+            group.apply(b);
+            group.apply(a);
+        }
+        if (seed & 0x20000) {
+            publisher.finish(a);
+            publisher.finish(b);
+        } else {
+            publisher.finish(b);
+            publisher.finish(a);
+        }
+        TEST_ASSERT_EQUAL_HEX32(0, group.bits & LEVEL_BITS & ~publisher.getPublishedLevels());
+    }
+}
+
+// ============================================================================
+// Microbenchmark: kernel entries per frame
+// ============================================================================
+
+struct FrameBits {
+    uint32_t updateSet;
+    uint32_t errorSet;
+    uint32_t errorClear;
+    uint32_t alarmSet;
+    uint32_t alarmClear;
+};
+
+// Frame i of a run: all channels read, channel 5 drops out every 40th
+// frame, an alarm on channel 2 trips and clears every 100 frames
+static FrameBits makeFrame(uint32_t i) {
+    FrameBits f = {0, 0, 0, 0, 0};
+    for (uint8_t ch = 0; ch < 8; ch++) {
+        if (ch == 5 && i % 40 == 0) {
+            f.errorSet |= errorBit(ch);
+        } else {
+            f.updateSet |= updateBit(ch);
+            f.errorClear |= errorBit(ch);
+        }
+    }
+    if (i % 100 == 10) {
+        f.alarmSet = alarmBit(2);
+    } else if (i % 100 == 60) {
+        f.alarmClear = alarmBit(2);
+    }
+    return f;
+}
+
+// Previous sequence: processTemperatureData published alarms, updateEventBits
+// issued clear/update/error separately and notified errors, the response
+// handler then set DATA_READY and DATA_ERROR and notified again
+static uint32_t runPreviousSequence(uint32_t frames) {
+    CountingEventGroup sensor = {0, 0};
+    CountingEventGroup task = {0, 0};
+    uint32_t notifications = 0;
+    for (uint32_t i = 0; i < frames; i++) {
+        FrameBits f = makeFrame(i);
+        if (f.alarmSet) sensor.set(f.alarmSet);
+        if (f.alarmClear) sensor.clear(f.alarmClear);
+        if (f.errorClear) sensor.clear(f.errorClear);
+        if (f.updateSet) sensor.set(f.updateSet);
+        if (f.errorSet) { sensor.set(f.errorSet); notifications++; }
+        if (f.updateSet) { task.set(1); notifications++; }
+        if (f.errorSet) { task.set(2); notifications++; }
+    }
+    return sensor.kernelCalls + task.kernelCalls + notifications;
+}
+
+// Coalesced: one commit per frame on the sensor group, one task group set
+static uint32_t runCoalescedSequence(uint32_t frames) {
+    SensorEventPublisher publisher(LEVEL_BITS);
+    CountingEventGroup sensor = {0, 0};
+    CountingEventGroup task = {0, 0};
+    uint32_t notifications = 0;
+    for (uint32_t i = 0; i < frames; i++) {
+        FrameBits f = makeFrame(i);
+        sensor.apply(commitNow(publisher, f.updateSet | f.errorSet | f.alarmSet,
+                                       f.errorClear | f.alarmClear));
+        uint32_t taskBits = (f.updateSet ? 1 : 0) | (f.errorSet ? 2 : 0);
+        if (taskBits) task.set(taskBits);
+        if (f.updateSet) notifications++;
+        if (f.errorSet) notifications++;
+    }
+    return sensor.kernelCalls + task.kernelCalls + notifications;
+}
+
+void test_coalescing_saves_kernel_entries() {
+    const uint32_t frames = 10000;
+    uint32_t previous = runPreviousSequence(frames);
+    uint32_t coalesced = runCoalescedSequence(frames);
+
+    char message[128];
+    snprintf(message, sizeof(message),
+             "%lu frames: %lu kernel entries before, %lu coalesced (%.2f -> %.2f per frame)",
+             static_cast<unsigned long>(frames), static_cast<unsigned long>(previous),
+             static_cast<unsigned long>(coalesced),
+             static_cast<double>(previous) / frames, static_cast<double>(coalesced) / frames);
+    TEST_MESSAGE(message);
+
+    // Steady state frame: clear + set + DATA_READY + notify before,
+    // set + DATA_READY + notify after; error and alarm transitions add
+    // one clear at most
+    TEST_ASSERT_TRUE(coalesced < previous);
+    TEST_ASSERT_TRUE(coalesced <= frames * 3 + frames / 10);
+}
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_clear_of_unpublished_level_is_dropped);
+    RUN_TEST(test_edge_bits_and_sets_pass_through);
+    RUN_TEST(test_forget_after_external_clear);
+    RUN_TEST(test_group_matches_requested_state);
+    RUN_TEST(test_overlapping_set_keeps_bit_published);
+    RUN_TEST(test_published_levels_cover_group);
+    RUN_TEST(test_coalescing_saves_kernel_entries);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_clear_of_unpublished_level_is_dropped);
+    RUN_TEST(test_edge_bits_and_sets_pass_through);
+    RUN_TEST(test_forget_after_external_clear);
+    RUN_TEST(test_group_matches_requested_state);
+    RUN_TEST(test_overlapping_set_keeps_bit_published);
+    RUN_TEST(test_published_levels_cover_group);
+    RUN_TEST(test_coalescing_saves_kernel_entries);
+    return UNITY_END();
+}
+#endif
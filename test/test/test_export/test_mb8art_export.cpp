@@ -0,0 +1,204 @@
+/**
+ * @file test_mb8art_export.cpp
+ * @brief Unit tests for the CBOR and Prometheus readings/metrics export
+ *
+ * MB8ARTExport.h has no FreeRTOS dependency, so these tests run on the
+ * native (host) environment as well as on ESP32. CBOR output is checked
+ * byte-for-byte against hand-encoded RFC 8949 items.
+ */
+
+#include <unity.h>
+#include <string.h>
+#include "MB8ARTExport.h"
+
+using mb8art::ExportFrame;
+using mb8art::QualityCode;
+
+static mb8art::ExportChannel channel(int16_t value, QualityCode code, uint32_t ageMs, uint8_t mode) {
+    mb8art::ExportChannel result;
+    result.value = value;
+    result.code = code;
+    result.ageMs = ageMs;
+    result.mode = mode;
+    return result;
+}
+
+static ExportFrame makeFrame() {
+    ExportFrame frame;
+    frame.address = 3;
+    frame.tag = "boiler";
+    frame.uptimeMs = 70000;
+    frame.channels[0] = channel(215, QualityCode::GOOD, 120, 1);            // 21.5 °C thermocouple
+    frame.channels[1] = channel(-35, QualityCode::UNCERTAIN_HELD, 9000, 2); // -3.5 °C PT, held
+    frame.channels[2] = channel(400, QualityCode::GOOD, 50, 4);             // 4.00 mA current
+    frame.channels[2].divider = 100;
+    frame.channels[3] = channel(0, QualityCode::BAD_SENSOR_OPEN, 0, 1);
+    frame.metrics.framesOk = 1000;
+    frame.metrics.crcErrors = 2;
+    frame.metrics.online = true;
+    frame.metrics.rtt.count = 1000;
+    frame.metrics.rtt.p99Us = 48000;
+    return frame;
+}
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// CBOR
+// ============================================================================
+
+void test_cbor_layout() {
+    ExportFrame frame = makeFrame();
+    uint8_t out[256];
+    size_t n = mb8art::encodeCbor(frame, out, sizeof(out));
+    TEST_ASSERT_TRUE(n > 0);
+    TEST_ASSERT_TRUE(n < 160);
+
+    // {0: 3, 1: "boiler", 2: 70000, 3: [[215, 0, 120, 1, 10], [-35, 0x40, 9000, 2, 10], ...
+    const uint8_t head[] = {
+        0xA6,
+        0x00, 0x03,
+        0x01, 0x66, 'b', 'o', 'i', 'l', 'e', 'r',
+        0x02, 0x1A, 0x00, 0x01, 0x11, 0x70,
+        0x03, 0x88,
+        0x85, 0x18, 0xD7, 0x00, 0x18, 0x78, 0x01, 0x0A,
+        0x85, 0x38, 0x22, 0x18, 0x40, 0x19, 0x23, 0x28, 0x02, 0x0A,
+        0x85, 0x19, 0x01, 0x90, 0x00, 0x18, 0x32, 0x04, 0x18, 0x64,   // Divider 100
+        0x85, 0x00, 0x18, 0x81, 0x00, 0x01, 0x0A,
+        0xF6, 0xF6, 0xF6, 0xF6,              // Deactivated channels
+        0x04, 0x95,                          // 21 metrics
+        0x19, 0x03, 0xE8, 0x02
+    };
+    TEST_ASSERT_EQUAL_MEMORY(head, out, sizeof(head));
+
+    // Ends with ..., p99, max, then 5: true
+    const uint8_t tail[] = {0x19, 0xBB, 0x80, 0x00, 0x05, 0xF5};
+    TEST_ASSERT_EQUAL_MEMORY(tail, out + n - sizeof(tail), sizeof(tail));
+}
+
+void test_cbor_never_reports_partial_output() {
+    ExportFrame frame = makeFrame();
+    uint8_t out[256];
+    size_t full = mb8art::encodeCbor(frame, out, sizeof(out));
+    for (size_t size = 0; size < full; size++) {
+        TEST_ASSERT_EQUAL_UINT32(0, mb8art::encodeCbor(frame, out, size));
+    }
+    TEST_ASSERT_EQUAL_UINT32(full, mb8art::encodeCbor(frame, out, full));
+}
+
+// ============================================================================
+// Prometheus
+// ============================================================================
+
+void test_prometheus_series() {
+    ExportFrame frame = makeFrame();
+    static char page[4096];
+    size_t n = mb8art::formatPrometheus(frame, page, sizeof(page));
+    TEST_ASSERT_EQUAL_UINT32(strlen(page), n);
+
+    TEST_ASSERT_NOT_NULL(strstr(page,
+        "mb8art_temperature_celsius{address=\"3\",tag=\"boiler\",channel=\"0\"} 21.5\n"));
+    TEST_ASSERT_NOT_NULL(strstr(page,
+        "mb8art_temperature_celsius{address=\"3\",tag=\"boiler\",channel=\"1\"} -3.5\n"));
+    TEST_ASSERT_NOT_NULL(strstr(page,
+        "mb8art_channel_value{address=\"3\",tag=\"boiler\",channel=\"2\"} 4.00\n"));
+    TEST_ASSERT_NOT_NULL(strstr(page,
+        "mb8art_channel_quality{address=\"3\",tag=\"boiler\",channel=\"3\"} 129\n"));
+    TEST_ASSERT_NOT_NULL(strstr(page, "# TYPE mb8art_crc_errors_total counter\n"));
+    TEST_ASSERT_NOT_NULL(strstr(page, "mb8art_frames_ok_total{address=\"3\",tag=\"boiler\"} 1000\n"));
+    TEST_ASSERT_NOT_NULL(strstr(page, "mb8art_online{address=\"3\",tag=\"boiler\"} 1\n"));
+    TEST_ASSERT_NOT_NULL(strstr(page,
+        "mb8art_rtt_microseconds{address=\"3\",tag=\"boiler\",quantile=\"0.99\"} 48000\n"));
+
+    // Open sensor has no value line, deactivated channels no line at all
+    TEST_ASSERT_NULL(strstr(page, "channel=\"3\"} 0.0"));
+    TEST_ASSERT_NULL(strstr(page, "channel=\"4\""));
+}
+
+void test_prometheus_scales_by_channel_divider() {
+    ExportFrame frame = makeFrame();
+    frame.channels[0] = channel(-4, QualityCode::GOOD, 0, 2);               // -0.4 °C
+    frame.channels[2].value = -1500;
+    frame.channels[2].divider = 1000;
+    frame.channels[2].mode = 3;                                              // -1.500 V, engineering volts
+    static char page[4096];
+    TEST_ASSERT_TRUE(mb8art::formatPrometheus(frame, page, sizeof(page)) > 0);
+    TEST_ASSERT_NOT_NULL(strstr(page,
+        "mb8art_temperature_celsius{address=\"3\",tag=\"boiler\",channel=\"0\"} -0.4\n"));
+    TEST_ASSERT_NOT_NULL(strstr(page,
+        "mb8art_channel_value{address=\"3\",tag=\"boiler\",channel=\"2\"} -1.500\n"));
+}
+
+void test_prometheus_escapes_tag() {
+    ExportFrame frame = makeFrame();
+    frame.tag = "a\"b\\c\nd";
+    static char page[4096];
+    TEST_ASSERT_TRUE(mb8art::formatPrometheus(frame, page, sizeof(page)) > 0);
+    TEST_ASSERT_NOT_NULL(strstr(page, "mb8art_online{address=\"3\",tag=\"a\\\"b\\\\c\\nd\"} 1\n"));
+    TEST_ASSERT_NULL(strstr(page, "a\"b"));
+}
+
+void test_prometheus_without_types_and_overflow() {
+    ExportFrame frame = makeFrame();
+    static char page[4096];
+    size_t withTypes = mb8art::formatPrometheus(frame, page, sizeof(page));
+    size_t bare = mb8art::formatPrometheus(frame, page, sizeof(page), false);
+    TEST_ASSERT_TRUE(bare < withTypes);
+    TEST_ASSERT_NULL(strstr(page, "# TYPE"));
+
+    // Too small: 0, and the buffer holds only complete lines
+    char small[200];
+    TEST_ASSERT_EQUAL_UINT32(0, mb8art::formatPrometheus(frame, small, sizeof(small)));
+    size_t length = strlen(small);
+    TEST_ASSERT_TRUE(length < sizeof(small));
+    TEST_ASSERT_TRUE(length == 0 || small[length - 1] == '\n');
+    TEST_ASSERT_EQUAL_UINT32(0, mb8art::formatPrometheus(frame, small, 0));
+
+    // Lines are written in pieces; an overflow inside one drops all of it
+    static char page2[4096];
+    size_t full = mb8art::formatPrometheus(frame, page2, sizeof(page2));
+    for (size_t cut = 1; cut < full; cut += 7) {
+        TEST_ASSERT_EQUAL_UINT32(0, mb8art::formatPrometheus(frame, page, cut));
+        length = strlen(page);
+        TEST_ASSERT_TRUE(length == 0 || page[length - 1] == '\n');
+    }
+}
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_cbor_layout);
+    RUN_TEST(test_cbor_never_reports_partial_output);
+    RUN_TEST(test_prometheus_series);
+    RUN_TEST(test_prometheus_scales_by_channel_divider);
+    RUN_TEST(test_prometheus_escapes_tag);
+    RUN_TEST(test_prometheus_without_types_and_overflow);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_cbor_layout);
+    RUN_TEST(test_cbor_never_reports_partial_output);
+    RUN_TEST(test_prometheus_series);
+    RUN_TEST(test_prometheus_scales_by_channel_divider);
+    RUN_TEST(test_prometheus_escapes_tag);
+    RUN_TEST(test_prometheus_without_types_and_overflow);
+    return UNITY_END();
+}
+#endif
@@ -0,0 +1,232 @@
+/**
+ * @file test_mb8art_filters.cpp
+ * @brief Unit tests for the fixed-point per-channel filter chain
+ *
+ * MB8ARTFilters.h has no FreeRTOS dependency, so these tests run on the
+ * native (host) environment as well as on ESP32.
+ */
+
+#include <unity.h>
+#include "MB8ARTFilters.h"
+
+using mb8art::ChannelFilter;
+using mb8art::FilterConfig;
+using mb8art::MedianWindow;
+using mb8art::SmoothingFilter;
+
+static FilterConfig makeConfig(MedianWindow median, SmoothingFilter smoothing) {
+    FilterConfig config;
+    config.median = median;
+    config.smoothing = smoothing;
+    return config;
+}
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+void test_config_validation() {
+    FilterConfig config;
+    TEST_ASSERT_FALSE(config.isEnabled());
+    TEST_ASSERT_TRUE(config.isValid());
+
+    config.median = static_cast<MedianWindow>(4);
+    TEST_ASSERT_FALSE(config.isValid());
+
+    config = makeConfig(MedianWindow::NONE, SmoothingFilter::EMA);
+    config.emaAlphaQ8 = 0;
+    TEST_ASSERT_FALSE(config.isValid());
+
+    config = makeConfig(MedianWindow::NONE, SmoothingFilter::KALMAN);
+    config.kalmanR = 0;
+    TEST_ASSERT_FALSE(config.isValid());
+
+    config = makeConfig(MedianWindow::MEDIAN_5, SmoothingFilter::KALMAN);
+    TEST_ASSERT_TRUE(config.isEnabled());
+    TEST_ASSERT_TRUE(config.isValid());
+}
+
+void test_disabled_filter_passes_through() {
+    ChannelFilter filter;
+    const int16_t samples[] = {0, 245, -1, INT16_MAX, INT16_MIN, 30000};
+    for (int16_t v : samples) {
+        TEST_ASSERT_EQUAL_INT16(v, filter.apply(v));
+    }
+}
+
+// ============================================================================
+// Median stage
+// ============================================================================
+
+void test_median3_removes_single_spike() {
+    ChannelFilter filter;
+    filter.configure(makeConfig(MedianWindow::MEDIAN_3, SmoothingFilter::NONE));
+
+    const int16_t in[] = {245, 246, 2000, 247, 246, -1500, 245};
+    for (int16_t v : in) {
+        int16_t out = filter.apply(v);
+        TEST_ASSERT_TRUE(out >= 245 && out <= 247);
+    }
+}
+
+void test_median5_removes_double_spike() {
+    ChannelFilter filter;
+    filter.configure(makeConfig(MedianWindow::MEDIAN_5, SmoothingFilter::NONE));
+
+    const int16_t in[] = {100, 100, 100, 900, 900, 100, 100};
+    for (int16_t v : in) {
+        TEST_ASSERT_EQUAL_INT16(100, filter.apply(v));
+    }
+}
+
+void test_median_follows_step() {
+    ChannelFilter filter;
+    filter.configure(makeConfig(MedianWindow::MEDIAN_3, SmoothingFilter::NONE));
+
+    for (int i = 0; i < 3; i++) {
+        filter.apply(100);
+    }
+    TEST_ASSERT_EQUAL_INT16(100, filter.apply(500));  // One new sample is an outlier
+    TEST_ASSERT_EQUAL_INT16(500, filter.apply(500));  // Two are the new level
+}
+
+// ============================================================================
+// Smoothing stage
+// ============================================================================
+
+void test_ema_step_response_is_symmetric() {
+    ChannelFilter up;
+    ChannelFilter down;
+    FilterConfig config = makeConfig(MedianWindow::NONE, SmoothingFilter::EMA);
+    config.emaAlphaQ8 = 128;  // alpha = 0.5
+    up.configure(config);
+    down.configure(config);
+
+    TEST_ASSERT_EQUAL_INT16(0, up.apply(0));
+    TEST_ASSERT_EQUAL_INT16(0, down.apply(0));
+
+    // 50, 75, 87.5 -> 88: rounding away from zero on both sides
+    const int16_t expected[] = {50, 75, 88};
+    for (int16_t e : expected) {
+        TEST_ASSERT_EQUAL_INT16(e, up.apply(100));
+        TEST_ASSERT_EQUAL_INT16(-e, down.apply(-100));
+    }
+    for (int i = 0; i < 20; i++) {
+        up.apply(100);
+    }
+    TEST_ASSERT_EQUAL_INT16(100, up.apply(100));
+}
+
+void test_ema_saturates_instead_of_wrapping() {
+    ChannelFilter filter;
+    filter.configure(makeConfig(MedianWindow::NONE, SmoothingFilter::EMA));
+    for (int i = 0; i < 50; i++) {
+        TEST_ASSERT_TRUE(filter.apply(INT16_MAX) > 0);
+    }
+    TEST_ASSERT_EQUAL_INT16(INT16_MAX, filter.apply(INT16_MAX));
+}
+
+void test_kalman_smooths_noise_and_converges() {
+    ChannelFilter filter;
+    filter.configure(makeConfig(MedianWindow::NONE, SmoothingFilter::KALMAN));
+
+    // First sample primes the estimate
+    TEST_ASSERT_EQUAL_INT16(240, filter.apply(240));
+
+    // ±20 count square-wave noise around 250: output stays well inside it
+    int16_t out = 0;
+    for (int i = 0; i < 200; i++) {
+        out = filter.apply(static_cast<int16_t>((i & 1) ? 270 : 230));
+        if (i > 50) {
+            TEST_ASSERT_TRUE(out >= 240 && out <= 260);
+        }
+    }
+
+    // Constant input: the estimate reaches it
+    for (int i = 0; i < 200; i++) {
+        out = filter.apply(-500);
+    }
+    TEST_ASSERT_EQUAL_INT16(-500, out);
+}
+
+// ============================================================================
+// Chain and reset
+// ============================================================================
+
+void test_median_runs_before_smoothing() {
+    ChannelFilter filter;
+    FilterConfig config = makeConfig(MedianWindow::MEDIAN_3, SmoothingFilter::EMA);
+    config.emaAlphaQ8 = 255;
+    filter.configure(config);
+
+    for (int i = 0; i < 5; i++) {
+        filter.apply(200);
+    }
+    // The spike never reaches the EMA, so it does not bleed into later values
+    TEST_ASSERT_EQUAL_INT16(200, filter.apply(2000));
+    TEST_ASSERT_EQUAL_INT16(200, filter.apply(200));
+}
+
+void test_reset_and_reconfigure_clear_state() {
+    ChannelFilter filter;
+    filter.configure(makeConfig(MedianWindow::MEDIAN_5, SmoothingFilter::EMA));
+    for (int i = 0; i < 10; i++) {
+        filter.apply(1000);
+    }
+
+    filter.reset();
+    TEST_ASSERT_EQUAL_INT16(-50, filter.apply(-50));  // Primes again, no history
+
+    filter.configure(makeConfig(MedianWindow::NONE, SmoothingFilter::KALMAN));
+    TEST_ASSERT_EQUAL_INT16(700, filter.apply(700));
+    TEST_ASSERT_TRUE(filter.getConfig().smoothing == SmoothingFilter::KALMAN);
+}
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_config_validation);
+    RUN_TEST(test_disabled_filter_passes_through);
+    RUN_TEST(test_median3_removes_single_spike);
+    RUN_TEST(test_median5_removes_double_spike);
+    RUN_TEST(test_median_follows_step);
+    RUN_TEST(test_ema_step_response_is_symmetric);
+    RUN_TEST(test_ema_saturates_instead_of_wrapping);
+    RUN_TEST(test_kalman_smooths_noise_and_converges);
+    RUN_TEST(test_median_runs_before_smoothing);
+    RUN_TEST(test_reset_and_reconfigure_clear_state);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_config_validation);
+    RUN_TEST(test_disabled_filter_passes_through);
+    RUN_TEST(test_median3_removes_single_spike);
+    RUN_TEST(test_median5_removes_double_spike);
+    RUN_TEST(test_median_follows_step);
+    RUN_TEST(test_ema_step_response_is_symmetric);
+    RUN_TEST(test_ema_saturates_instead_of_wrapping);
+    RUN_TEST(test_kalman_smooths_noise_and_converges);
+    RUN_TEST(test_median_runs_before_smoothing);
+    RUN_TEST(test_reset_and_reconfigure_clear_state);
+    return UNITY_END();
+}
+#endif
@@ -0,0 +1,257 @@
+/**
+ * @file test_mb8art_history.cpp
+ * @brief Unit tests and encode benchmark for the compressed reading history
+ *
+ * MB8ARTHistory.h has no FreeRTOS dependency, so these tests run on the
+ * native (host) environment as well as on ESP32.
+ */
+
+#include <unity.h>
+#include <stdio.h>
+#include "MB8ARTHistory.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+static uint32_t benchMicros() { return micros(); }
+#else
+#include <chrono>
+static uint32_t benchMicros() {
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+#endif
+
+using mb8art::HistoryFrame;
+using mb8art::StaticHistory;
+
+void setUp() {}
+void tearDown() {}
+
+// Deterministic, slowly drifting temperatures (tenths of °C) with ±0.2 noise
+static void makeFrame(uint32_t index, int16_t* values) {
+    static uint32_t lcg = 12345;
+    for (uint8_t ch = 0; ch < 8; ch++) {
+        lcg = lcg * 1103515245u + 12345u;
+        int16_t noise = static_cast<int16_t>((lcg >> 16) % 5) - 2;
+        values[ch] = static_cast<int16_t>(200 + ch * 50 + (index / 10) % 100 + noise);
+    }
+}
+
+static uint32_t readAll(StaticHistory<8, 128>& history, HistoryFrame* out, uint32_t maxFrames) {
+    HistoryFrame frame;
+    uint32_t count = 0;
+    auto reader = history.reader();
+    while (reader.next(frame) && count < maxFrames) {
+        out[count++] = frame;
+    }
+    return count;
+}
+
+// ============================================================================
+// Round trip
+// ============================================================================
+
+void test_history_empty_reader_returns_nothing() {
+    StaticHistory<4, 128> history;
+    HistoryFrame frame;
+    auto reader = history.reader();
+    TEST_ASSERT_FALSE(reader.next(frame));
+}
+
+void test_history_round_trip_preserves_values_and_ticks() {
+    StaticHistory<8, 128> history;
+    int16_t written[40][8];
+
+    for (uint32_t i = 0; i < 40; i++) {
+        makeFrame(i, written[i]);
+        history.append(1000 + i * 1000, 0xFF, written[i]);
+    }
+
+    HistoryFrame frames[64];
+    uint32_t count = readAll(history, frames, 64);
+    TEST_ASSERT_EQUAL_UINT32(40, count);
+    for (uint32_t i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL_UINT32(1000 + i * 1000, frames[i].tick);
+        TEST_ASSERT_EQUAL_UINT8(0xFF, frames[i].validMask);
+        for (uint8_t ch = 0; ch < 8; ch++) {
+            TEST_ASSERT_EQUAL_INT16(written[i][ch], frames[i].values[ch]);
+        }
+    }
+}
+
+void test_history_handles_large_jumps_and_negative_values() {
+    StaticHistory<8, 128> history;
+    int16_t a[8] = {-2000, 8500, 0, -1, 32767, -32768, 100, 7};
+    int16_t b[8] = {8500, -2000, -1, 0, -32768, 32767, -100, 7};
+    history.append(10, 0xFF, a);
+    history.append(20, 0xFF, b);
+    history.append(30, 0xFF, a);
+
+    HistoryFrame frames[4];
+    TEST_ASSERT_EQUAL_UINT32(3, readAll(history, frames, 4));
+    for (uint8_t ch = 0; ch < 8; ch++) {
+        TEST_ASSERT_EQUAL_INT16(a[ch], frames[0].values[ch]);
+        TEST_ASSERT_EQUAL_INT16(b[ch], frames[1].values[ch]);
+        TEST_ASSERT_EQUAL_INT16(a[ch], frames[2].values[ch]);
+    }
+}
+
+void test_history_valid_mask_changes_are_recorded() {
+    StaticHistory<8, 128> history;
+    int16_t values[8] = {100, 200, 300, 400, 500, 600, 700, 800};
+    history.append(1, 0xFF, values);
+    values[2] = 999;  // Ignored: channel 2 invalid in this frame
+    history.append(2, 0xFB, values);
+    values[2] = 310;
+    history.append(3, 0xFF, values);
+
+    HistoryFrame frames[4];
+    TEST_ASSERT_EQUAL_UINT32(3, readAll(history, frames, 4));
+    TEST_ASSERT_EQUAL_UINT8(0xFB, frames[1].validMask);
+    TEST_ASSERT_EQUAL_UINT8(0xFF, frames[2].validMask);
+    TEST_ASSERT_EQUAL_INT16(310, frames[2].values[2]);
+}
+
+void test_history_quality_codes_are_recorded() {
+    StaticHistory<8, 128> history;
+    int16_t values[8] = {100, 200, 300, 400, 500, 600, 700, 800};
+    mb8art::QualityCode quality[8] = {};
+    history.append(1, 0xFF, values, quality);
+    quality[3] = mb8art::QualityCode::BAD_SENSOR_OPEN;
+    quality[5] = mb8art::QualityCode::UNCERTAIN_REJECTED;
+    history.append(2, 0xD7, values, quality);
+    history.append(3, 0xD7, values, quality);
+    quality[3] = mb8art::QualityCode::GOOD;
+    history.append(4, 0xDF, values, quality);
+
+    HistoryFrame frames[4];
+    TEST_ASSERT_EQUAL_UINT32(4, readAll(history, frames, 4));
+    TEST_ASSERT_EQUAL_UINT8(0x00, static_cast<uint8_t>(frames[0].quality[3]));
+    TEST_ASSERT_EQUAL_UINT8(0x81, static_cast<uint8_t>(frames[1].quality[3]));
+    TEST_ASSERT_EQUAL_UINT8(0x42, static_cast<uint8_t>(frames[2].quality[5]));
+    TEST_ASSERT_EQUAL_UINT8(0x00, static_cast<uint8_t>(frames[3].quality[3]));
+    TEST_ASSERT_EQUAL_UINT8(0x42, static_cast<uint8_t>(frames[3].quality[5]));
+}
+
+// ============================================================================
+// Ring behavior
+// ============================================================================
+
+void test_history_wraps_and_keeps_newest_frames_in_order() {
+    StaticHistory<8, 128> history;
+    int16_t values[8];
+    const uint32_t total = 2000;
+
+    for (uint32_t i = 0; i < total; i++) {
+        makeFrame(i, values);
+        history.append(i * 100, 0xFF, values);
+    }
+
+    HistoryFrame frames[256];
+    uint32_t count = readAll(history, frames, 256);
+    TEST_ASSERT_GREATER_THAN(0, count);
+    TEST_ASSERT_EQUAL_UINT32(history.getStoredFrames(), count);
+
+    // Oldest retained frame onwards, contiguous, ending with the newest
+    for (uint32_t i = 1; i < count; i++) {
+        TEST_ASSERT_EQUAL_UINT32(frames[i - 1].tick + 100, frames[i].tick);
+    }
+    TEST_ASSERT_EQUAL_UINT32((total - 1) * 100, frames[count - 1].tick);
+}
+
+void test_history_reader_survives_recycling_during_readout() {
+    StaticHistory<4, 128> history;
+    int16_t values[8];
+    for (uint32_t i = 0; i < 200; i++) {
+        makeFrame(i, values);
+        history.append(i, 0xFF, values);
+    }
+
+    // Start reading, then let the writer lap the ring before continuing
+    HistoryFrame frame;
+    auto reader = history.reader();
+    TEST_ASSERT_TRUE(reader.next(frame));
+    uint32_t previousTick = frame.tick;
+
+    for (uint32_t i = 200; i < 400; i++) {
+        makeFrame(i, values);
+        history.append(i, 0xFF, values);
+    }
+
+    // Whatever is returned must still be strictly increasing in time
+    while (reader.next(frame)) {
+        TEST_ASSERT_GREATER_THAN(previousTick, frame.tick);
+        previousTick = frame.tick;
+    }
+}
+
+// ============================================================================
+// Benchmark: bytes per sample and encode cost
+// ============================================================================
+
+void test_history_benchmark_bytes_per_sample() {
+    static StaticHistory<64, 256> history;
+    int16_t values[8];
+    const uint32_t frames = 1000;  // Fits without recycling
+
+    uint32_t start = benchMicros();
+    for (uint32_t i = 0; i < frames; i++) {
+        makeFrame(i, values);
+        history.append(i * 1000, 0xFF, values);
+    }
+    uint32_t elapsed = benchMicros() - start;
+
+    uint32_t bytes = history.getTotalEncodedBytes();
+    uint32_t samples = frames * 8;
+    char message[160];
+    snprintf(message, sizeof(message),
+             "history: %lu frames, %lu bytes, %lu.%02lu bytes/sample (raw int16+tick: 2.50), %lu ns/frame",
+             static_cast<unsigned long>(frames), static_cast<unsigned long>(bytes),
+             static_cast<unsigned long>(bytes / samples),
+             static_cast<unsigned long>((bytes * 100 / samples) % 100),
+             static_cast<unsigned long>(elapsed * 1000 / frames));
+    TEST_MESSAGE(message);
+
+    // Slowly varying temperatures must compress well below raw int16 storage
+    TEST_ASSERT_LESS_THAN(samples * 3 / 2, bytes);
+}
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_history_empty_reader_returns_nothing);
+    RUN_TEST(test_history_round_trip_preserves_values_and_ticks);
+    RUN_TEST(test_history_handles_large_jumps_and_negative_values);
+    RUN_TEST(test_history_valid_mask_changes_are_recorded);
+    RUN_TEST(test_history_quality_codes_are_recorded);
+    RUN_TEST(test_history_wraps_and_keeps_newest_frames_in_order);
+    RUN_TEST(test_history_reader_survives_recycling_during_readout);
+    RUN_TEST(test_history_benchmark_bytes_per_sample);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_history_empty_reader_returns_nothing);
+    RUN_TEST(test_history_round_trip_preserves_values_and_ticks);
+    RUN_TEST(test_history_handles_large_jumps_and_negative_values);
+    RUN_TEST(test_history_valid_mask_changes_are_recorded);
+    RUN_TEST(test_history_quality_codes_are_recorded);
+    RUN_TEST(test_history_wraps_and_keeps_newest_frames_in_order);
+    RUN_TEST(test_history_reader_survives_recycling_during_readout);
+    RUN_TEST(test_history_benchmark_bytes_per_sample);
+    return UNITY_END();
+}
+#endif
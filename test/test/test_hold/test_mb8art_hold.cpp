@@ -0,0 +1,237 @@
+/**
+ * @file test_mb8art_hold.cpp
+ * @brief Unit tests for the last-good-value hold policy
+ *
+ * MB8ARTHold.h has no FreeRTOS dependency, so these tests run on the
+ * native (host) environment as well as on ESP32.
+ */
+
+#include <unity.h>
+#include "MB8ARTHold.h"
+
+using mb8art::ChannelSnapshot;
+using mb8art::HeldReading;
+using mb8art::HoldPolicy;
+using mb8art::QualityCode;
+using mb8art::ReadingQuality;
+using mb8art::evaluateHold;
+using mb8art::recordGoodSample;
+using mb8art::recordMissedSample;
+
+static HoldPolicy makePolicy(uint32_t uncertainAfterMs, uint32_t badAfterMs, uint32_t extrapolateMs = 0) {
+    HoldPolicy policy;
+    policy.uncertainAfterMs = uncertainAfterMs;
+    policy.badAfterMs = badAfterMs;
+    policy.extrapolateMs = extrapolateMs;
+    return policy;
+}
+
+static void assertReading(ReadingQuality quality, QualityCode code, const HeldReading& reading) {
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(quality), static_cast<uint8_t>(reading.quality));
+    TEST_ASSERT_EQUAL_HEX32(static_cast<uint8_t>(code), static_cast<uint8_t>(reading.code));
+}
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Without a policy
+// ============================================================================
+
+void test_no_sample_is_bad() {
+    ChannelSnapshot snapshot;
+    HeldReading r = evaluateHold(snapshot, 1000);
+    assertReading(ReadingQuality::BAD, QualityCode::BAD_NO_DATA, r);
+}
+
+void test_without_policy_latest_status_stands() {
+    ChannelSnapshot snapshot;
+    recordGoodSample(snapshot, 245, QualityCode::GOOD, 0);
+    assertReading(ReadingQuality::GOOD, QualityCode::GOOD, evaluateHold(snapshot, 100000));
+
+    TEST_ASSERT_TRUE(recordMissedSample(snapshot, QualityCode::BAD_TIMEOUT));
+    HeldReading r = evaluateHold(snapshot, 1000);
+    assertReading(ReadingQuality::BAD, QualityCode::BAD_TIMEOUT, r);
+    TEST_ASSERT_TRUE(r.held);
+    TEST_ASSERT_EQUAL_INT32(245, r.value);
+}
+
+void test_missed_sample_reports_change_once() {
+    ChannelSnapshot snapshot;
+    recordGoodSample(snapshot, 10, QualityCode::GOOD, 0);
+    TEST_ASSERT_TRUE(recordMissedSample(snapshot, QualityCode::BAD_TIMEOUT));
+    TEST_ASSERT_FALSE(recordMissedSample(snapshot, QualityCode::BAD_TIMEOUT));
+    TEST_ASSERT_TRUE(recordMissedSample(snapshot, QualityCode::BAD_SENSOR_OPEN));
+}
+
+// ============================================================================
+// Aging
+// ============================================================================
+
+void test_held_value_ages_good_uncertain_bad() {
+    ChannelSnapshot snapshot;
+    snapshot.policy = makePolicy(5000, 30000);
+    recordGoodSample(snapshot, 500, QualityCode::GOOD, 0);
+    recordMissedSample(snapshot, QualityCode::BAD_TIMEOUT);
+
+    HeldReading r = evaluateHold(snapshot, 1000);
+    assertReading(ReadingQuality::GOOD, QualityCode::GOOD_HELD, r);
+    TEST_ASSERT_EQUAL_INT32(500, r.value);
+    TEST_ASSERT_EQUAL_UINT32(1000, r.ageMs);
+
+    assertReading(ReadingQuality::UNCERTAIN, QualityCode::UNCERTAIN_HELD, evaluateHold(snapshot, 5000));
+    assertReading(ReadingQuality::UNCERTAIN, QualityCode::UNCERTAIN_HELD, evaluateHold(snapshot, 29999));
+    assertReading(ReadingQuality::BAD, QualityCode::BAD_TIMEOUT, evaluateHold(snapshot, 30000));
+}
+
+void test_current_sample_ages_without_new_frames() {
+    // The offline case: no frame and no missed-sample record, only time passes
+    ChannelSnapshot snapshot;
+    snapshot.policy = makePolicy(5000, 30000);
+    recordGoodSample(snapshot, 500, QualityCode::GOOD_FILTERED, 0);
+
+    HeldReading r = evaluateHold(snapshot, 1000);
+    assertReading(ReadingQuality::GOOD, QualityCode::GOOD_FILTERED, r);
+    TEST_ASSERT_FALSE(r.held);
+
+    r = evaluateHold(snapshot, 6000);
+    assertReading(ReadingQuality::UNCERTAIN, QualityCode::UNCERTAIN_HELD, r);
+    TEST_ASSERT_TRUE(r.held);
+    assertReading(ReadingQuality::BAD, QualityCode::BAD_TIMEOUT, evaluateHold(snapshot, 40000));
+}
+
+void test_fault_reason_kept_when_aged_out() {
+    ChannelSnapshot snapshot;
+    snapshot.policy = makePolicy(5000, 30000);
+    recordGoodSample(snapshot, 500, QualityCode::GOOD, 0);
+    recordMissedSample(snapshot, QualityCode::BAD_SENSOR_OPEN);
+
+    // Held while young, the open-circuit reason is reported once it turns BAD
+    assertReading(ReadingQuality::GOOD, QualityCode::GOOD_HELD, evaluateHold(snapshot, 100));
+    assertReading(ReadingQuality::BAD, QualityCode::BAD_SENSOR_OPEN, evaluateHold(snapshot, 30000));
+}
+
+void test_deactivated_channel_is_never_held() {
+    ChannelSnapshot snapshot;
+    snapshot.policy = makePolicy(5000, 30000);
+    recordGoodSample(snapshot, 500, QualityCode::GOOD, 0);
+    recordMissedSample(snapshot, QualityCode::BAD_DEACTIVATED);
+    assertReading(ReadingQuality::BAD, QualityCode::BAD_DEACTIVATED, evaluateHold(snapshot, 100));
+}
+
+void test_age_survives_millisecond_wrap() {
+    ChannelSnapshot snapshot;
+    snapshot.policy = makePolicy(5000, 30000);
+    recordGoodSample(snapshot, 500, QualityCode::GOOD, UINT32_MAX - 999);
+    recordMissedSample(snapshot, QualityCode::BAD_TIMEOUT);
+    HeldReading r = evaluateHold(snapshot, 1000);
+    TEST_ASSERT_EQUAL_UINT32(2000, r.ageMs);
+    assertReading(ReadingQuality::GOOD, QualityCode::GOOD_HELD, r);
+}
+
+// ============================================================================
+// Slope and extrapolation
+// ============================================================================
+
+void test_extrapolation_is_bounded() {
+    ChannelSnapshot snapshot;
+    snapshot.policy = makePolicy(5000, 60000, 10000);
+    recordGoodSample(snapshot, 100, QualityCode::GOOD, 0);
+    recordGoodSample(snapshot, 110, QualityCode::GOOD, 6000);  // 100/min, smoothed to 25/min
+    TEST_ASSERT_EQUAL_INT32(25, snapshot.slopePerMin);
+    recordMissedSample(snapshot, QualityCode::BAD_TIMEOUT);
+
+    // 8 s old: 110 + 25 × 8/60
+    HeldReading r = evaluateHold(snapshot, 14000);
+    assertReading(ReadingQuality::UNCERTAIN, QualityCode::UNCERTAIN_EXTRAPOLATED, r);
+    TEST_ASSERT_TRUE(r.extrapolated);
+    TEST_ASSERT_EQUAL_INT32(113, r.value);
+
+    // Projection stops after extrapolateMs: 110 + 25 × 10/60
+    TEST_ASSERT_EQUAL_INT32(114, evaluateHold(snapshot, 40000).value);
+}
+
+void test_slope_not_estimated_across_outage() {
+    ChannelSnapshot snapshot;
+    snapshot.policy = makePolicy(5000, 30000, 10000);
+    recordGoodSample(snapshot, 100, QualityCode::GOOD, 0);
+    recordGoodSample(snapshot, 110, QualityCode::GOOD, 6000);
+    recordMissedSample(snapshot, QualityCode::BAD_TIMEOUT);
+    recordGoodSample(snapshot, 500, QualityCode::GOOD, 20000);
+    TEST_ASSERT_EQUAL_INT32(0, snapshot.slopePerMin);
+}
+
+void test_full_range_slope_saturates() {
+    ChannelSnapshot snapshot;
+    recordGoodSample(snapshot, -2000000000, QualityCode::GOOD, 0);
+    // 4e9 counts in 1 ms - the product needs 64 bits before clamping
+    recordGoodSample(snapshot, 2000000000, QualityCode::GOOD, 1);
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, snapshot.slopePerMin);
+
+    recordGoodSample(snapshot, -2000000000, QualityCode::GOOD, 2);
+    TEST_ASSERT_TRUE(snapshot.slopePerMin < 0);
+}
+
+void test_wide_engineering_value_is_not_clipped() {
+    // Mapped analog values exceed int16_t; held and extrapolated values keep them
+    ChannelSnapshot snapshot;
+    snapshot.policy = makePolicy(5000, 60000, 10000);
+    recordGoodSample(snapshot, 250000, QualityCode::GOOD, 0);
+    recordGoodSample(snapshot, 250600, QualityCode::GOOD, 6000);  // 6000/min, smoothed to 1500/min
+    recordMissedSample(snapshot, QualityCode::BAD_TIMEOUT);
+
+    TEST_ASSERT_EQUAL_INT32(250600, evaluateHold(snapshot, 7000).value);
+    HeldReading r = evaluateHold(snapshot, 18000);
+    assertReading(ReadingQuality::UNCERTAIN, QualityCode::UNCERTAIN_EXTRAPOLATED, r);
+    TEST_ASSERT_EQUAL_INT32(250600 + 1500 * 10 / 60, r.value);
+}
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_no_sample_is_bad);
+    RUN_TEST(test_without_policy_latest_status_stands);
+    RUN_TEST(test_missed_sample_reports_change_once);
+    RUN_TEST(test_held_value_ages_good_uncertain_bad);
+    RUN_TEST(test_current_sample_ages_without_new_frames);
+    RUN_TEST(test_fault_reason_kept_when_aged_out);
+    RUN_TEST(test_deactivated_channel_is_never_held);
+    RUN_TEST(test_age_survives_millisecond_wrap);
+    RUN_TEST(test_extrapolation_is_bounded);
+    RUN_TEST(test_slope_not_estimated_across_outage);
+    RUN_TEST(test_full_range_slope_saturates);
+    RUN_TEST(test_wide_engineering_value_is_not_clipped);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_no_sample_is_bad);
+    RUN_TEST(test_without_policy_latest_status_stands);
+    RUN_TEST(test_missed_sample_reports_change_once);
+    RUN_TEST(test_held_value_ages_good_uncertain_bad);
+    RUN_TEST(test_current_sample_ages_without_new_frames);
+    RUN_TEST(test_fault_reason_kept_when_aged_out);
+    RUN_TEST(test_deactivated_channel_is_never_held);
+    RUN_TEST(test_age_survives_millisecond_wrap);
+    RUN_TEST(test_extrapolation_is_bounded);
+    RUN_TEST(test_slope_not_estimated_across_outage);
+    RUN_TEST(test_full_range_slope_saturates);
+    RUN_TEST(test_wide_engineering_value_is_not_clipped);
+    return UNITY_END();
+}
+#endif
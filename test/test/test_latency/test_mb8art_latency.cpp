@@ -0,0 +1,150 @@
+/**
+ * @file test_mb8art_latency.cpp
+ * @brief Unit tests for the log-bucketed latency histograms
+ *
+ * MB8ARTLatency.h has no FreeRTOS dependency, so these tests run on the
+ * native (host) environment as well as on ESP32.
+ */
+
+#include <unity.h>
+#include "MB8ARTLatency.h"
+
+#ifndef ARDUINO
+#include <thread>
+#include <atomic>
+#endif
+
+using mb8art::LatencyHistogram;
+using mb8art::LatencySummary;
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Bucket mapping
+// ============================================================================
+
+void test_bucket_bounds_cover_every_value() {
+    // Every value lands in a bucket whose upper bound is >= the value and
+    // whose predecessor's bound is below it; width stays within 25 %
+    for (uint32_t us = 0; us < (1u << 20); us += (us < 4096 ? 1 : 97)) {
+        uint8_t bucket = LatencyHistogram::bucketFor(us);
+        TEST_ASSERT_TRUE(bucket < LatencyHistogram::BUCKETS);
+        uint32_t upper = LatencyHistogram::bucketUpperBound(bucket);
+        TEST_ASSERT_TRUE(upper >= us);
+        if (bucket > 0) {
+            TEST_ASSERT_TRUE(LatencyHistogram::bucketUpperBound(bucket - 1) < us);
+        }
+        if (us >= 4) {
+            TEST_ASSERT_TRUE(upper - us <= us / 4);
+        }
+    }
+}
+
+void test_long_durations_share_top_bucket() {
+    TEST_ASSERT_EQUAL_UINT8(LatencyHistogram::BUCKETS - 1, LatencyHistogram::bucketFor(1u << 24));
+    TEST_ASSERT_EQUAL_UINT8(LatencyHistogram::BUCKETS - 1, LatencyHistogram::bucketFor(UINT32_MAX));
+}
+
+// ============================================================================
+// Percentiles
+// ============================================================================
+
+void test_percentiles_of_known_distribution() {
+    LatencyHistogram histogram;
+    TEST_ASSERT_EQUAL_UINT32(0, histogram.summary().p99Us);
+
+    // 1000 samples: 1..1000 us
+    for (uint32_t us = 1; us <= 1000; us++) {
+        histogram.record(us);
+    }
+    LatencySummary s = histogram.summary();
+    TEST_ASSERT_EQUAL_UINT32(1000, s.count);
+    TEST_ASSERT_EQUAL_UINT32(1000, s.maxUs);
+    // Reported value is the bucket upper bound: >= true value, <= 25 % over
+    TEST_ASSERT_TRUE(s.p50Us >= 500 && s.p50Us <= 625);
+    TEST_ASSERT_TRUE(s.p90Us >= 900 && s.p90Us <= 1000);
+    TEST_ASSERT_TRUE(s.p99Us >= 990 && s.p99Us <= 1000);
+    TEST_ASSERT_EQUAL_UINT32(s.p50Us, histogram.percentile(500));
+}
+
+void test_outlier_shows_in_max_not_median() {
+    LatencyHistogram histogram;
+    for (uint32_t i = 0; i < 999; i++) {
+        histogram.record(12000);  // ~12 ms typical read at 9600 baud
+    }
+    histogram.record(850000);     // One stuck transaction
+    LatencySummary s = histogram.summary();
+    TEST_ASSERT_TRUE(s.p50Us >= 12000 && s.p50Us < 15000);
+    TEST_ASSERT_TRUE(s.p99Us < 15000);
+    TEST_ASSERT_EQUAL_UINT32(850000, s.maxUs);
+
+    histogram.reset();
+    TEST_ASSERT_EQUAL_UINT32(0, histogram.count());
+    TEST_ASSERT_EQUAL_UINT32(0, histogram.max());
+}
+
+#ifndef ARDUINO
+// Reader summarizes while the writer records - never blocks, never
+// reports a percentile above the maximum recorded so far
+void test_concurrent_summary() {
+    static LatencyHistogram histogram;
+    std::atomic<bool> stop(false);
+    std::atomic<uint32_t> violations(0);
+
+    std::thread writer([&]() {
+        for (uint32_t i = 0; i < 200000; i++) {
+            histogram.record(100 + (i % 5000));
+        }
+        stop.store(true);
+    });
+    std::thread reader([&]() {
+        while (!stop.load()) {
+            LatencySummary s = histogram.summary();
+            if (s.p50Us > s.maxUs || s.p99Us > s.maxUs || s.p50Us > s.p99Us) {
+                violations.fetch_add(1);
+            }
+        }
+    });
+    writer.join();
+    reader.join();
+
+    TEST_ASSERT_EQUAL_UINT32(0, violations.load());
+    TEST_ASSERT_EQUAL_UINT32(200000, histogram.count());
+}
+#endif
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_bucket_bounds_cover_every_value);
+    RUN_TEST(test_long_durations_share_top_bucket);
+    RUN_TEST(test_percentiles_of_known_distribution);
+    RUN_TEST(test_outlier_shows_in_max_not_median);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_bucket_bounds_cover_every_value);
+    RUN_TEST(test_long_durations_share_top_bucket);
+    RUN_TEST(test_percentiles_of_known_distribution);
+    RUN_TEST(test_outlier_shows_in_max_not_median);
+    RUN_TEST(test_concurrent_summary);
+    return UNITY_END();
+}
+#endif
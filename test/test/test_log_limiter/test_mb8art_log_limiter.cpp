@@ -0,0 +1,196 @@
+/**
+ * @file test_mb8art_log_limiter.cpp
+ * @brief Unit tests for the per-site token-bucket log limiter
+ *
+ * MB8ARTLogLimiter.h has no FreeRTOS dependency, so these tests run on the
+ * native (host) environment as well as on ESP32. Time is passed in
+ * explicitly, in milliseconds.
+ */
+
+#include <unity.h>
+#include "MB8ARTLogLimiter.h"
+
+#ifndef ARDUINO
+#include <thread>
+#endif
+
+using mb8art::LogLimiter;
+using mb8art::LogLimiterTable;
+using mb8art::LogRate;
+using mb8art::LogSite;
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Token bucket
+// ============================================================================
+
+void test_burst_then_one_per_interval() {
+    LogLimiter limiter;
+    limiter.configure(LogRate{1000, 3});
+    uint32_t suppressed = 99;
+    uint32_t now = 5000;
+
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_TRUE(limiter.allow(now, suppressed));
+        TEST_ASSERT_EQUAL_UINT32(0, suppressed);
+    }
+    TEST_ASSERT_FALSE(limiter.allow(now, suppressed));
+    TEST_ASSERT_FALSE(limiter.allow(now + 999, suppressed));
+    TEST_ASSERT_EQUAL_UINT32(2, limiter.pendingSuppressed());
+
+    // One token back after an interval, carrying the suppressed count
+    TEST_ASSERT_TRUE(limiter.allow(now + 1000, suppressed));
+    TEST_ASSERT_EQUAL_UINT32(2, suppressed);
+    TEST_ASSERT_FALSE(limiter.allow(now + 1000, suppressed));
+
+    // A long quiet period refills the whole burst, no more
+    now += 60000;
+    TEST_ASSERT_TRUE(limiter.allow(now, suppressed));
+    TEST_ASSERT_EQUAL_UINT32(1, suppressed);
+    TEST_ASSERT_TRUE(limiter.allow(now, suppressed));
+    TEST_ASSERT_TRUE(limiter.allow(now, suppressed));
+    TEST_ASSERT_FALSE(limiter.allow(now, suppressed));
+}
+
+void test_sustained_flood_reports_counts() {
+    // Sensor error default: once per 30 s; a 10 Hz flood for 90 s
+    LogLimiter limiter;
+    limiter.configure(mb8art::defaultLogRate(mb8art::sensorErrorSite(4)));
+    uint32_t logged = 0;
+    uint32_t reported = 0;
+    uint32_t suppressed = 0;
+    for (uint32_t t = 0; t < 90000; t += 100) {
+        if (limiter.allow(1000 + t, suppressed)) {
+            logged++;
+            reported += suppressed;
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(3, logged);
+    // Every message is either logged, reported as suppressed, or still pending
+    TEST_ASSERT_EQUAL_UINT32(900, logged + reported + limiter.pendingSuppressed());
+    TEST_ASSERT_EQUAL_UINT32(598, reported);
+}
+
+void test_mute_and_unlimited() {
+    LogLimiter limiter;
+    uint32_t suppressed = 0;
+
+    limiter.configure(LogRate{1000, 0});
+    TEST_ASSERT_FALSE(limiter.allow(0, suppressed));
+    TEST_ASSERT_FALSE(limiter.allow(100000, suppressed));
+
+    limiter.configure(LogRate{0, 1});
+    for (int i = 0; i < 100; i++) {
+        TEST_ASSERT_TRUE(limiter.allow(5, suppressed));
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, limiter.pendingSuppressed());
+}
+
+void test_millisecond_wraparound_and_stale_state() {
+    LogLimiter limiter;
+    limiter.configure(LogRate{1000, 1});
+    uint32_t suppressed = 0;
+
+    // Across the 32-bit wrap
+    TEST_ASSERT_TRUE(limiter.allow(0xFFFFFF00u, suppressed));
+    TEST_ASSERT_FALSE(limiter.allow(0xFFFFFFF0u, suppressed));
+    TEST_ASSERT_FALSE(limiter.allow(0x00000100u, suppressed));
+    TEST_ASSERT_TRUE(limiter.allow(0x00000300u, suppressed));
+    TEST_ASSERT_EQUAL_UINT32(2, suppressed);
+
+    // Weeks of silence: the bucket is full again
+    TEST_ASSERT_TRUE(limiter.allow(0x80000400u, suppressed));
+    TEST_ASSERT_TRUE(limiter.allow(0xF0000000u, suppressed));
+}
+
+// ============================================================================
+// Per-site, per-instance tables
+// ============================================================================
+
+void test_sites_and_instances_are_independent() {
+    LogLimiterTable moduleA;
+    LogLimiterTable moduleB;
+    uint32_t suppressed = 0;
+
+    TEST_ASSERT_TRUE(moduleA[mb8art::sensorErrorSite(0)].allow(1000, suppressed));
+    TEST_ASSERT_FALSE(moduleA[mb8art::sensorErrorSite(0)].allow(2000, suppressed));
+
+    // Same channel on another module, other channel on the same module
+    TEST_ASSERT_TRUE(moduleB[mb8art::sensorErrorSite(0)].allow(2000, suppressed));
+    TEST_ASSERT_TRUE(moduleA[mb8art::sensorErrorSite(1)].allow(2000, suppressed));
+    TEST_ASSERT_TRUE(moduleA[LogSite::DATA_TIMEOUT].allow(2000, suppressed));
+
+    // Defaults
+    TEST_ASSERT_EQUAL_UINT32(30000, moduleA[mb8art::sensorErrorSite(7)].getRate().intervalMs);
+    TEST_ASSERT_EQUAL_UINT8(8, moduleA[LogSite::CHANNEL_ERROR].getRate().burst);
+    TEST_ASSERT_EQUAL_UINT8(3, moduleA[LogSite::MODBUS_ERROR].getRate().burst);
+}
+
+#ifndef ARDUINO
+// Response context and polling task hitting one site at once
+void test_concurrent_callers_respect_burst() {
+    static LogLimiter limiter;
+    limiter.configure(LogRate{1000, 5});
+    limiter.reset();
+    std::atomic<uint32_t> allowed(0);
+    std::atomic<uint32_t> reported(0);
+
+    auto caller = [&]() {
+        uint32_t suppressed = 0;
+        for (int i = 0; i < 50000; i++) {
+            if (limiter.allow(10000, suppressed)) {
+                allowed.fetch_add(1);
+                reported.fetch_add(suppressed);
+            }
+        }
+    };
+    std::thread a(caller);
+    std::thread b(caller);
+    std::thread c(caller);
+    a.join();
+    b.join();
+    c.join();
+
+    TEST_ASSERT_EQUAL_UINT32(5, allowed.load());
+    TEST_ASSERT_EQUAL_UINT32(150000, allowed.load() + reported.load() + limiter.pendingSuppressed());
+}
+#endif
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_burst_then_one_per_interval);
+    RUN_TEST(test_sustained_flood_reports_counts);
+    RUN_TEST(test_mute_and_unlimited);
+    RUN_TEST(test_millisecond_wraparound_and_stale_state);
+    RUN_TEST(test_sites_and_instances_are_independent);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_burst_then_one_per_interval);
+    RUN_TEST(test_sustained_flood_reports_counts);
+    RUN_TEST(test_mute_and_unlimited);
+    RUN_TEST(test_millisecond_wraparound_and_stale_state);
+    RUN_TEST(test_sites_and_instances_are_independent);
+    RUN_TEST(test_concurrent_callers_respect_burst);
+    return UNITY_END();
+}
+#endif
@@ -0,0 +1,222 @@
+/**
+ * @file test_mb8art_metrics.cpp
+ * @brief Unit tests for the per-device bus health counters
+ *
+ * MB8ARTMetrics.h has no FreeRTOS dependency, so these tests run on the
+ * native (host) environment as well as on ESP32.
+ */
+
+#include <unity.h>
+#include "MB8ARTMetrics.h"
+
+#ifndef ARDUINO
+#include <thread>
+#endif
+
+using mb8art::BusEvent;
+using mb8art::BusMetrics;
+using mb8art::BusMetricsCounters;
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Counting
+// ============================================================================
+
+void test_events_are_counted_by_kind() {
+    BusMetricsCounters counters;
+    counters.record(BusEvent::FRAME_OK, true);
+    counters.record(BusEvent::FRAME_OK, true);
+    counters.record(BusEvent::CRC_ERROR, true);
+    counters.record(BusEvent::TIMEOUT, true);
+    counters.record(BusEvent::EXCEPTION, true);
+    counters.record(BusEvent::OTHER_ERROR, true);
+    counters.dataTimeout();
+    counters.retry();
+    counters.cacheLookup(true);
+    counters.cacheLookup(true);
+    counters.cacheLookup(false);
+    counters.wentOffline();
+    counters.wentOnline();
+
+    BusMetrics metrics;
+    counters.snapshot(metrics);
+    TEST_ASSERT_EQUAL_UINT32(2, metrics.framesOk);
+    TEST_ASSERT_EQUAL_UINT32(1, metrics.crcErrors);
+    TEST_ASSERT_EQUAL_UINT32(1, metrics.timeouts);
+    TEST_ASSERT_EQUAL_UINT32(1, metrics.exceptions);
+    TEST_ASSERT_EQUAL_UINT32(1, metrics.otherErrors);
+    TEST_ASSERT_EQUAL_UINT32(1, metrics.dataTimeouts);
+    TEST_ASSERT_EQUAL_UINT32(1, metrics.retries);
+    TEST_ASSERT_EQUAL_UINT32(2, metrics.cacheHits);
+    TEST_ASSERT_EQUAL_UINT32(1, metrics.cacheMisses);
+    TEST_ASSERT_EQUAL_UINT32(1, metrics.offlineTransitions);
+    TEST_ASSERT_EQUAL_UINT32(1, metrics.onlineTransitions);
+}
+
+void test_in_flight_and_high_water() {
+    BusMetricsCounters counters;
+    counters.requestQueued(true);
+    counters.requestQueued(true);
+    counters.requestQueued(false);
+    counters.requestQueued(true);
+
+    BusMetrics metrics;
+    counters.snapshot(metrics);
+    TEST_ASSERT_EQUAL_UINT32(3, metrics.requestsQueued);
+    TEST_ASSERT_EQUAL_UINT32(1, metrics.requestsRejected);
+    TEST_ASSERT_EQUAL_UINT16(3, metrics.inFlight);
+    TEST_ASSERT_EQUAL_UINT16(3, metrics.inFlightHighWater);
+
+    // Responses and errors both settle a request
+    counters.record(BusEvent::FRAME_OK, true);
+    counters.record(BusEvent::TIMEOUT, true);
+    counters.snapshot(metrics);
+    TEST_ASSERT_EQUAL_UINT16(1, metrics.inFlight);
+    TEST_ASSERT_EQUAL_UINT16(3, metrics.inFlightHighWater);
+}
+
+void test_reset_and_unmatched_responses() {
+    BusMetricsCounters counters;
+    counters.requestQueued(true);
+    counters.requestQueued(true);
+    counters.record(BusEvent::FRAME_OK, true);
+    counters.reset();
+
+    // Counters cleared, the outstanding request still tracked
+    BusMetrics metrics;
+    counters.snapshot(metrics);
+    TEST_ASSERT_EQUAL_UINT32(0, metrics.framesOk);
+    TEST_ASSERT_EQUAL_UINT32(0, metrics.requestsQueued);
+    TEST_ASSERT_EQUAL_UINT16(1, metrics.inFlight);
+    TEST_ASSERT_EQUAL_UINT16(1, metrics.inFlightHighWater);
+
+    // Settles with nothing outstanding (late replies after reset) never underflow
+    counters.record(BusEvent::FRAME_OK, true);
+    counters.record(BusEvent::FRAME_OK, true);
+    counters.record(BusEvent::CRC_ERROR, true);
+    counters.snapshot(metrics);
+    TEST_ASSERT_EQUAL_UINT16(0, metrics.inFlight);
+    TEST_ASSERT_EQUAL_UINT32(2, metrics.framesOk);
+}
+
+void test_untracked_responses_keep_requests_in_flight() {
+    BusMetricsCounters counters;
+    counters.requestQueued(true);
+    counters.requestQueued(true);
+
+    // A config read answered while both polling reads are outstanding
+    counters.record(BusEvent::FRAME_OK, false);
+    counters.record(BusEvent::FRAME_OK, false);
+    BusMetrics metrics;
+    counters.snapshot(metrics);
+    TEST_ASSERT_EQUAL_UINT32(2, metrics.framesOk);
+    TEST_ASSERT_EQUAL_UINT16(2, metrics.inFlight);
+
+    counters.record(BusEvent::FRAME_OK, true);
+    counters.snapshot(metrics);
+    TEST_ASSERT_EQUAL_UINT16(1, metrics.inFlight);
+}
+
+void test_config_read_error_keeps_requests_in_flight() {
+    BusMetricsCounters counters;
+    BusMetrics metrics;
+
+    // No polling read outstanding: an error settles nothing
+    TEST_ASSERT_FALSE(counters.errorSettlesRequest());
+
+    counters.requestQueued(true);
+    {
+        // A config read fails while the polling read is outstanding
+        mb8art::UntrackedTransaction untracked(counters);
+        TEST_ASSERT_FALSE(counters.errorSettlesRequest());
+        counters.record(BusEvent::TIMEOUT, counters.errorSettlesRequest());
+        {
+            mb8art::UntrackedTransaction nested(counters);
+        }
+        TEST_ASSERT_FALSE(counters.errorSettlesRequest());
+    }
+    counters.snapshot(metrics);
+    TEST_ASSERT_EQUAL_UINT32(1, metrics.timeouts);
+    TEST_ASSERT_EQUAL_UINT16(1, metrics.inFlight);
+
+    // Once the config read is done, the next error is the polling read's
+    TEST_ASSERT_TRUE(counters.errorSettlesRequest());
+    counters.record(BusEvent::CRC_ERROR, counters.errorSettlesRequest());
+    counters.snapshot(metrics);
+    TEST_ASSERT_EQUAL_UINT16(0, metrics.inFlight);
+    TEST_ASSERT_FALSE(counters.errorSettlesRequest());
+}
+
+#ifndef ARDUINO
+// Polling task queues while the response context settles
+void test_concurrent_request_and_response_paths() {
+    static BusMetricsCounters counters;
+    const uint32_t requests = 200000;
+    std::atomic<uint32_t> queued(0);
+
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < requests; i++) {
+            counters.requestQueued(true);
+            queued.fetch_add(1, std::memory_order_release);
+        }
+    });
+    std::thread responder([&]() {
+        uint32_t settled = 0;
+        while (settled < requests) {
+            if (settled < queued.load(std::memory_order_acquire)) {
+                counters.record((settled & 7) == 0 ? BusEvent::TIMEOUT : BusEvent::FRAME_OK, true);
+                settled++;
+            }
+        }
+    });
+    producer.join();
+    responder.join();
+
+    BusMetrics metrics;
+    counters.snapshot(metrics);
+    TEST_ASSERT_EQUAL_UINT32(requests, metrics.requestsQueued);
+    TEST_ASSERT_EQUAL_UINT32(requests, metrics.framesOk + metrics.timeouts);
+    TEST_ASSERT_EQUAL_UINT32(requests / 8, metrics.timeouts);
+    TEST_ASSERT_EQUAL_UINT16(0, metrics.inFlight);
+    TEST_ASSERT_TRUE(metrics.inFlightHighWater >= 1);
+}
+#endif
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_events_are_counted_by_kind);
+    RUN_TEST(test_in_flight_and_high_water);
+    RUN_TEST(test_reset_and_unmatched_responses);
+    RUN_TEST(test_untracked_responses_keep_requests_in_flight);
+    RUN_TEST(test_config_read_error_keeps_requests_in_flight);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_events_are_counted_by_kind);
+    RUN_TEST(test_in_flight_and_high_water);
+    RUN_TEST(test_reset_and_unmatched_responses);
+    RUN_TEST(test_untracked_responses_keep_requests_in_flight);
+    RUN_TEST(test_config_read_error_keeps_requests_in_flight);
+    RUN_TEST(test_concurrent_request_and_response_paths);
+    return UNITY_END();
+}
+#endif
@@ -0,0 +1,171 @@
+/**
+ * @file test_mb8art_profiler.cpp
+ * @brief Unit tests for the scoped profiler and its counter table
+ *
+ * On the native (host) environment the profiler runs on steady_clock; on
+ * ESP32 it uses the CPU cycle counter. Counter names are process-wide, so
+ * each test uses its own names.
+ */
+
+#include <unity.h>
+#include <stdio.h>
+#include "MB8ARTProfiler.h"
+
+using mb8art::ProfileCounter;
+using mb8art::ProfileEntry;
+using mb8art::ProfileTimer;
+using mb8art::Profiler;
+
+static void spinUs(uint32_t us) {
+    uint32_t start = mb8art::profilerTicks();
+    while (mb8art::profilerTicks() - start < us * mb8art::profilerTicksPerUs()) {
+    }
+}
+
+static bool findEntry(const char* name, ProfileEntry& found) {
+    ProfileEntry entries[Profiler::SLOTS];
+    uint8_t n = Profiler::snapshot(entries, Profiler::SLOTS);
+    for (uint8_t i = 0; i < n; i++) {
+        if (strcmp(entries[i].name, name) == 0) {
+            found = entries[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Counter table
+// ============================================================================
+
+void test_same_name_shares_counter() {
+    ProfileCounter* a = Profiler::counter("shared");
+    char copy[] = "shared";  // Same content, different address
+    TEST_ASSERT_NOT_NULL(a);
+    TEST_ASSERT_EQUAL_PTR(a, Profiler::counter(copy));
+    TEST_ASSERT_TRUE(a != Profiler::counter("other"));
+}
+
+void test_total_carries_past_32_bits() {
+    ProfileCounter* counter = Profiler::counter("carry");
+    counter->add(0xF0000000u);
+    counter->add(0x20000000u);
+    counter->add(5);
+    ProfileEntry entry = counter->read();
+    TEST_ASSERT_EQUAL_UINT32(3, entry.count);
+    TEST_ASSERT_TRUE(entry.totalTicks == 0x110000005ULL);
+    TEST_ASSERT_EQUAL_UINT32(0xF0000000u, entry.maxTicks);
+}
+
+// ============================================================================
+// Scoped timing
+// ============================================================================
+
+static void profiledWork(uint32_t us) {
+    MB8ART_PROFILE_SCOPE(profiled_work);
+    spinUs(us);
+}
+
+void test_scope_records_sub_millisecond_durations() {
+    for (uint8_t i = 0; i < 10; i++) {
+        profiledWork(200);
+    }
+    profiledWork(900);
+
+    ProfileEntry entry;
+    TEST_ASSERT_TRUE(findEntry("profiled_work", entry));
+    TEST_ASSERT_EQUAL_UINT32(11, entry.count);
+    uint32_t maxUs = Profiler::ticksToUs(entry.maxTicks);
+    uint32_t totalUs = Profiler::ticksToUs(entry.totalTicks);
+    TEST_ASSERT_TRUE(maxUs >= 900 && maxUs < 5000);
+    TEST_ASSERT_TRUE(totalUs >= 2900);
+
+    char message[96];
+    snprintf(message, sizeof(message), "profiled_work: n=%lu total=%lu us max=%lu us",
+             static_cast<unsigned long>(entry.count), static_cast<unsigned long>(totalUs),
+             static_cast<unsigned long>(maxUs));
+    TEST_MESSAGE(message);
+}
+
+void test_timer_records_once() {
+    ProfileCounter* counter = Profiler::counter("records_once");
+    {
+        ProfileTimer timer(counter);
+        timer.stop();
+        TEST_ASSERT_EQUAL_UINT32(0, timer.stop());
+    }  // Destructor must not add a second sample
+    TEST_ASSERT_EQUAL_UINT32(1, counter->read().count);
+
+    {
+        ProfileTimer timer(counter);  // Early exit without stop()
+    }
+    TEST_ASSERT_EQUAL_UINT32(2, counter->read().count);
+
+    ProfileTimer orphan(nullptr);     // Table full: nothing recorded
+    TEST_ASSERT_EQUAL_UINT32(0, orphan.stop());
+}
+
+void test_reset_keeps_names() {
+    ProfileCounter* counter = Profiler::counter("reset_me");
+    counter->add(100);
+    Profiler::reset();
+    ProfileEntry entry;
+    TEST_ASSERT_TRUE(findEntry("reset_me", entry));
+    TEST_ASSERT_EQUAL_UINT32(0, entry.count);
+    TEST_ASSERT_TRUE(entry.totalTicks == 0);
+}
+
+void test_full_table_returns_null() {
+    static char names[Profiler::SLOTS][12];
+    uint8_t claimed = 0;
+    for (uint8_t i = 0; i < Profiler::SLOTS; i++) {
+        snprintf(names[i], sizeof(names[i]), "fill_%u", static_cast<unsigned>(i));
+        if (Profiler::counter(names[i]) != nullptr) {
+            claimed++;
+        }
+    }
+    TEST_ASSERT_TRUE(claimed < Profiler::SLOTS);  // Earlier tests hold slots too
+    TEST_ASSERT_NULL(Profiler::counter("one_too_many"));
+    TEST_ASSERT_NOT_NULL(Profiler::counter("shared"));  // Existing names still resolve
+}
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_same_name_shares_counter);
+    RUN_TEST(test_total_carries_past_32_bits);
+    RUN_TEST(test_scope_records_sub_millisecond_durations);
+    RUN_TEST(test_timer_records_once);
+    RUN_TEST(test_reset_keeps_names);
+    RUN_TEST(test_full_table_returns_null);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_same_name_shares_counter);
+    RUN_TEST(test_total_carries_past_32_bits);
+    RUN_TEST(test_scope_records_sub_millisecond_durations);
+    RUN_TEST(test_timer_records_once);
+    RUN_TEST(test_reset_keeps_names);
+    RUN_TEST(test_full_table_returns_null);
+    return UNITY_END();
+}
+#endif
@@ -0,0 +1,384 @@
+/**
+ * @file test_mb8art_publisher.cpp
+ * @brief Unit tests for the batched, deadband-filtered reading publisher
+ *
+ * MB8ARTPublisher.h has no FreeRTOS or MQTT dependency, so these tests run
+ * on the native (host) environment as well as on ESP32. A broker stub
+ * forwards published messages to a local stand-in IMqttMessageHandler that
+ * decodes the CBOR and rebuilds the channel table a subscriber would see.
+ */
+
+#include <unity.h>
+#include <string.h>
+#include <string>
+#include "MB8ARTPublisher.h"
+
+using mb8art::QualityCode;
+using mb8art::ReadingPublisher;
+
+// ============================================================================
+// Broker stub and subscriber
+// ============================================================================
+
+// Stand-in for the MQTT manager's handler interface
+class IMqttMessageHandler {
+public:
+    virtual ~IMqttMessageHandler() {}
+    virtual void handleMessage(const std::string& topic, const std::string& payload) = 0;
+};
+
+// Minimal CBOR reader for the publisher's message shape
+class CborReader {
+public:
+    CborReader(const uint8_t* data, size_t size) : p(data), end(data + size), ok(true) {}
+
+    uint8_t peek() const { return p < end ? *p : 0xFF; }
+    bool atEnd() const { return p == end; }
+    bool good() const { return ok; }
+
+    // Major type and argument of the next item; simple values return major 7
+    uint8_t head(uint32_t& value) {
+        if (p >= end) {
+            ok = false;
+            return 0xFF;
+        }
+        uint8_t initial = *p++;
+        uint8_t info = initial & 0x1F;
+        value = info;
+        if (info >= 24 && info <= 26) {
+            uint8_t bytes = static_cast<uint8_t>(1u << (info - 24));
+            value = 0;
+            for (uint8_t i = 0; i < bytes; i++) {
+                value = (value << 8) | (p < end ? *p++ : (ok = false, 0));
+            }
+        }
+        return static_cast<uint8_t>(initial >> 5);
+    }
+    int32_t integer() {
+        uint32_t value = 0;
+        uint8_t major = head(value);
+        return major == 1 ? -1 - static_cast<int32_t>(value) : static_cast<int32_t>(value);
+    }
+
+private:
+    const uint8_t* p;
+    const uint8_t* end;
+    bool ok;
+};
+
+class StubSubscriber : public IMqttMessageHandler {
+public:
+    int32_t value[8];
+    uint8_t code[8];
+    int32_t divider[8];
+    bool present[8];
+    uint32_t messages = 0;
+    uint32_t fullRefreshes = 0;
+    uint32_t lastSequence = 0;
+    uint32_t lastChannelCount = 0;
+    uint8_t address = 0;
+    std::string lastTopic;
+
+    StubSubscriber() {
+        memset(value, 0, sizeof(value));
+        memset(code, 0, sizeof(code));
+        memset(divider, 0, sizeof(divider));
+        memset(present, 0, sizeof(present));
+    }
+
+    void handleMessage(const std::string& topic, const std::string& payload) override {
+        lastTopic = topic;
+        CborReader r(reinterpret_cast<const uint8_t*>(payload.data()), payload.size());
+        uint32_t pairs = 0;
+        TEST_ASSERT_EQUAL_UINT8(5, r.head(pairs));
+        for (uint32_t k = 0; k < pairs; k++) {
+            uint32_t key = static_cast<uint32_t>(r.integer());
+            if (key == 0) {
+                address = static_cast<uint8_t>(r.integer());
+            } else if (key == 1) {
+                lastSequence = static_cast<uint32_t>(r.integer());
+            } else if (key == 2) {
+                r.integer();
+            } else if (key == 3) {
+                uint32_t channels = 0;
+                TEST_ASSERT_EQUAL_UINT8(5, r.head(channels));
+                lastChannelCount = channels;
+                for (uint32_t c = 0; c < channels; c++) {
+                    uint8_t ch = static_cast<uint8_t>(r.integer());
+                    if (r.peek() == 0xF6) {
+                        uint32_t ignored;
+                        r.head(ignored);
+                        present[ch] = false;
+                        continue;
+                    }
+                    uint32_t items = 0;
+                    TEST_ASSERT_EQUAL_UINT8(4, r.head(items));
+                    TEST_ASSERT_EQUAL_UINT32(3, items);
+                    value[ch] = static_cast<int32_t>(r.integer());
+                    code[ch] = static_cast<uint8_t>(r.integer());
+                    divider[ch] = static_cast<int32_t>(r.integer());
+                    present[ch] = true;
+                }
+            } else if (key == 4) {
+                uint32_t simple = 0;
+                TEST_ASSERT_EQUAL_UINT8(7, r.head(simple));
+                TEST_ASSERT_EQUAL_UINT32(21, simple);  // true
+                fullRefreshes++;
+            }
+        }
+        TEST_ASSERT_TRUE(r.good());
+        TEST_ASSERT_TRUE(r.atEnd());
+        messages++;
+    }
+};
+
+struct BrokerStub {
+    IMqttMessageHandler* subscriber = nullptr;
+    bool accept = true;
+    size_t maxPayload = 0;
+
+    static bool publish(void* context, const char* topic, const uint8_t* payload, size_t length) {
+        BrokerStub* broker = static_cast<BrokerStub*>(context);
+        if (!broker->accept) {
+            return false;
+        }
+        if (length > broker->maxPayload) {
+            broker->maxPayload = length;
+        }
+        broker->subscriber->handleMessage(topic, std::string(reinterpret_cast<const char*>(payload), length));
+        return true;
+    }
+};
+
+struct Frame {
+    int32_t values[8];
+    QualityCode codes[8];
+    int16_t dividers[8];
+    uint8_t active;
+
+    Frame() : active(0xFF) {
+        for (uint8_t i = 0; i < 8; i++) {
+            values[i] = static_cast<int32_t>(200 + i * 10);
+            codes[i] = QualityCode::GOOD;
+            dividers[i] = mb8art::BINDING_TEMPERATURE_DIVIDER;
+        }
+    }
+};
+
+static bool offer(ReadingPublisher& publisher, uint32_t nowMs, const Frame& frame) {
+    return publisher.offerFrame(nowMs, frame.active, frame.values, frame.codes, frame.dividers);
+}
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Deadband batching
+// ============================================================================
+
+void test_first_frame_is_full_then_only_changes() {
+    StubSubscriber subscriber;
+    BrokerStub broker;
+    broker.subscriber = &subscriber;
+    ReadingPublisher publisher("plant/boiler/temps", BrokerStub::publish, &broker, 3);
+    publisher.setDeadband(5);
+    publisher.setRateLimit(0);
+    Frame frame;
+
+    TEST_ASSERT_TRUE(offer(publisher, 1000, frame));
+    TEST_ASSERT_EQUAL_STRING("plant/boiler/temps", subscriber.lastTopic.c_str());
+    TEST_ASSERT_EQUAL_UINT8(3, subscriber.address);
+    TEST_ASSERT_EQUAL_UINT32(8, subscriber.lastChannelCount);
+    TEST_ASSERT_EQUAL_UINT32(1, subscriber.fullRefreshes);
+
+    // Within the deadband: nothing
+    frame.values[0] += 4;
+    frame.values[5] -= 4;
+    TEST_ASSERT_FALSE(offer(publisher, 2000, frame));
+
+    // Two channels beyond it: one message with exactly those two
+    frame.values[0] += 1;
+    frame.values[6] -= 9;
+    TEST_ASSERT_TRUE(offer(publisher, 3000, frame));
+    TEST_ASSERT_EQUAL_UINT32(2, subscriber.lastChannelCount);
+    TEST_ASSERT_EQUAL_INT32(205, subscriber.value[0]);
+    TEST_ASSERT_EQUAL_INT32(251, subscriber.value[6]);
+    TEST_ASSERT_EQUAL_INT32(250, subscriber.value[5]);  // Still the published value
+    TEST_ASSERT_EQUAL_UINT32(1, subscriber.lastSequence);
+
+    // A quality change alone is published
+    frame.codes[2] = QualityCode::UNCERTAIN_HELD;
+    TEST_ASSERT_TRUE(offer(publisher, 4000, frame));
+    TEST_ASSERT_EQUAL_UINT32(1, subscriber.lastChannelCount);
+    TEST_ASSERT_EQUAL_UINT8(0x40, subscriber.code[2]);
+    TEST_ASSERT_EQUAL_INT32(10, subscriber.divider[2]);
+
+    // So is a divider change (analog channel switched to a finer range)
+    frame.dividers[4] = 1000;
+    TEST_ASSERT_TRUE(offer(publisher, 5000, frame));
+    TEST_ASSERT_EQUAL_UINT32(1, subscriber.lastChannelCount);
+    TEST_ASSERT_EQUAL_INT32(1000, subscriber.divider[4]);
+    TEST_ASSERT_EQUAL_INT32(240, subscriber.value[4]);
+
+    mb8art::PublisherStats stats = publisher.getStats();
+    TEST_ASSERT_EQUAL_UINT32(4, stats.messages);
+    TEST_ASSERT_EQUAL_UINT32(12, stats.channelsPublished);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.unchangedFrames);
+    TEST_ASSERT_TRUE(broker.maxPayload <= ReadingPublisher::BUFFER_BYTES);
+}
+
+void test_deactivation_and_worst_case_size() {
+    StubSubscriber subscriber;
+    BrokerStub broker;
+    broker.subscriber = &subscriber;
+    ReadingPublisher publisher("t", BrokerStub::publish, &broker, 0xF7);
+    publisher.setRateLimit(0);
+    Frame frame;
+    for (uint8_t i = 0; i < 8; i++) {
+        frame.values[i] = (i & 1) ? INT32_MIN : INT32_MAX;  // Unclipped engineering values
+        frame.codes[i] = QualityCode::BAD_TIMEOUT;
+        frame.dividers[i] = 1000;
+    }
+    publisher.setHeartbeat(0);
+    TEST_ASSERT_TRUE(offer(publisher, 0xFFFFFFF0u, frame));
+    TEST_ASSERT_TRUE(broker.maxPayload <= ReadingPublisher::BUFFER_BYTES);
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, subscriber.value[1]);
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, subscriber.value[2]);
+
+    frame.active = 0xFF & ~0x08;
+    TEST_ASSERT_TRUE(offer(publisher, 0xFFFFFFF8u, frame));
+    TEST_ASSERT_EQUAL_UINT32(1, subscriber.lastChannelCount);
+    TEST_ASSERT_FALSE(subscriber.present[3]);
+
+    // Stays quiet while deactivated, reappears when reactivated
+    TEST_ASSERT_FALSE(offer(publisher, 5, frame));
+    frame.active = 0xFF;
+    TEST_ASSERT_TRUE(offer(publisher, 10, frame));
+    TEST_ASSERT_TRUE(subscriber.present[3]);
+}
+
+// ============================================================================
+// Rate limit, failures, heartbeat
+// ============================================================================
+
+void test_rate_limited_changes_merge_into_next_message() {
+    StubSubscriber subscriber;
+    BrokerStub broker;
+    broker.subscriber = &subscriber;
+    ReadingPublisher publisher("t", BrokerStub::publish, &broker);
+    publisher.setRateLimit(1000);
+    publisher.setHeartbeat(0);
+    Frame frame;
+
+    TEST_ASSERT_TRUE(offer(publisher, 10000, frame));
+
+    frame.values[1] = 400;
+    TEST_ASSERT_FALSE(offer(publisher, 10250, frame));
+    frame.values[1] = 410;
+    frame.values[4] = 100;
+    TEST_ASSERT_FALSE(offer(publisher, 10500, frame));
+    TEST_ASSERT_FALSE(offer(publisher, 10750, frame));
+
+    // Window open: both channels, latest values, even though this frame alone has no change
+    TEST_ASSERT_TRUE(offer(publisher, 11000, frame));
+    TEST_ASSERT_EQUAL_UINT32(2, subscriber.lastChannelCount);
+    TEST_ASSERT_EQUAL_INT32(410, subscriber.value[1]);
+    TEST_ASSERT_EQUAL_INT32(100, subscriber.value[4]);
+    TEST_ASSERT_EQUAL_UINT32(3, publisher.getStats().rateLimited);
+    TEST_ASSERT_EQUAL_UINT32(2, subscriber.messages);
+}
+
+void test_failure_forces_full_refresh_and_heartbeat() {
+    StubSubscriber subscriber;
+    BrokerStub broker;
+    broker.subscriber = &subscriber;
+    ReadingPublisher publisher("t", BrokerStub::publish, &broker);
+    publisher.setRateLimit(0);
+    publisher.setHeartbeat(60000);
+    Frame frame;
+
+    TEST_ASSERT_TRUE(offer(publisher, 1000, frame));
+    broker.accept = false;
+    frame.values[7] = 0;
+    TEST_ASSERT_FALSE(offer(publisher, 2000, frame));
+    TEST_ASSERT_EQUAL_UINT32(1, publisher.getStats().failures);
+
+    broker.accept = true;
+    TEST_ASSERT_TRUE(offer(publisher, 3000, frame));
+    TEST_ASSERT_EQUAL_UINT32(8, subscriber.lastChannelCount);
+    TEST_ASSERT_EQUAL_UINT32(2, subscriber.fullRefreshes);
+    TEST_ASSERT_EQUAL_INT32(0, subscriber.value[7]);
+
+    // Nothing changes for a minute: one heartbeat
+    TEST_ASSERT_FALSE(offer(publisher, 62999, frame));
+    TEST_ASSERT_TRUE(offer(publisher, 63000, frame));
+    TEST_ASSERT_EQUAL_UINT32(3, subscriber.fullRefreshes);
+
+    publisher.requestFullRefresh();
+    TEST_ASSERT_TRUE(offer(publisher, 64000, frame));
+    TEST_ASSERT_EQUAL_UINT32(4, subscriber.fullRefreshes);
+}
+
+void test_subscriber_tracks_within_deadband() {
+    StubSubscriber subscriber;
+    BrokerStub broker;
+    broker.subscriber = &subscriber;
+    ReadingPublisher publisher("t", BrokerStub::publish, &broker);
+    publisher.setDeadband(3);
+    publisher.setRateLimit(0);
+    Frame frame;
+
+    uint32_t seed = 12345;
+    uint32_t frames = 2000;
+    for (uint32_t n = 0; n < frames; n++) {
+        for (uint8_t i = 0; i < 8; i++) {
+            seed = seed * 1103515245u + 12345u;
+            frame.values[i] += static_cast<int32_t>((seed >> 16) % 5) - 2;
+        }
+        offer(publisher, 1000 + n * 500, frame);
+        for (uint8_t i = 0; i < 8; i++) {
+            int32_t error = static_cast<int32_t>(frame.values[i]) - subscriber.value[i];
+            TEST_ASSERT_TRUE(error > -3 && error < 3);
+        }
+    }
+    // Batching: far fewer messages and entries than frames × channels
+    mb8art::PublisherStats stats = publisher.getStats();
+    TEST_ASSERT_TRUE(stats.messages <= frames);
+    TEST_ASSERT_TRUE(stats.channelsPublished < frames * 8 / 2);
+}
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_first_frame_is_full_then_only_changes);
+    RUN_TEST(test_deactivation_and_worst_case_size);
+    RUN_TEST(test_rate_limited_changes_merge_into_next_message);
+    RUN_TEST(test_failure_forces_full_refresh_and_heartbeat);
+    RUN_TEST(test_subscriber_tracks_within_deadband);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_first_frame_is_full_then_only_changes);
+    RUN_TEST(test_deactivation_and_worst_case_size);
+    RUN_TEST(test_rate_limited_changes_merge_into_next_message);
+    RUN_TEST(test_failure_forces_full_refresh_and_heartbeat);
+    RUN_TEST(test_subscriber_tracks_within_deadband);
+    return UNITY_END();
+}
+#endif
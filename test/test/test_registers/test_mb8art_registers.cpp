@@ -0,0 +1,173 @@
+/**
+ * @file test_mb8art_registers.cpp
+ * @brief Unit tests for the compile-time register map and response dispatch
+ *
+ * MB8ARTRegisters.h has no FreeRTOS dependency, so these tests run on the
+ * native (host) environment as well as on ESP32.
+ */
+
+#include <unity.h>
+#include "MB8ARTRegisters.h"
+
+using mb8art::RegisterDescriptor;
+using mb8art::RegisterId;
+
+static int idOf(const RegisterDescriptor* reg) {
+    return reg != nullptr ? static_cast<int>(reg->id) : -1;
+}
+
+static int find(uint8_t fc, uint16_t address, size_t length) {
+    return idOf(mb8art::findRegister(fc, address, length));
+}
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Table
+// ============================================================================
+
+void test_addresses_match_hardware_map() {
+    TEST_ASSERT_EQUAL_UINT16(0, mb8art::registerDescriptor(RegisterId::CONNECTION_STATUS).address);
+    TEST_ASSERT_EQUAL_UINT16(0, mb8art::registerDescriptor(RegisterId::TEMPERATURES).address);
+    TEST_ASSERT_EQUAL_UINT16(65, mb8art::registerDescriptor(RegisterId::EQUIPMENT_STATUS).address);
+    TEST_ASSERT_EQUAL_UINT16(67, mb8art::registerDescriptor(RegisterId::MODULE_TEMPERATURE).address);
+    TEST_ASSERT_EQUAL_UINT16(68, mb8art::registerDescriptor(RegisterId::PRODUCT_VERSION).address);
+    TEST_ASSERT_EQUAL_UINT16(70, mb8art::registerDescriptor(RegisterId::RS485_ADDRESS).address);
+    TEST_ASSERT_EQUAL_UINT16(71, mb8art::registerDescriptor(RegisterId::BAUD_RATE).address);
+    TEST_ASSERT_EQUAL_UINT16(72, mb8art::registerDescriptor(RegisterId::PARITY).address);
+    TEST_ASSERT_EQUAL_UINT16(76, mb8art::registerDescriptor(RegisterId::MEASUREMENT_RANGE).address);
+    TEST_ASSERT_EQUAL_UINT16(128, mb8art::registerDescriptor(RegisterId::CHANNEL_CONFIG).address);
+
+    // The batch runs from 70 through the measurement range register
+    const RegisterDescriptor& batch = mb8art::registerDescriptor(RegisterId::MODULE_BATCH);
+    TEST_ASSERT_EQUAL_UINT16(76, batch.address + batch.count - 1);
+}
+
+void test_response_sizes() {
+    TEST_ASSERT_EQUAL(1, mb8art::registerResponseBytes(mb8art::registerDescriptor(RegisterId::CONNECTION_STATUS)));
+    TEST_ASSERT_EQUAL(16, mb8art::registerResponseBytes(mb8art::registerDescriptor(RegisterId::TEMPERATURES)));
+    TEST_ASSERT_EQUAL(14, mb8art::registerResponseBytes(mb8art::registerDescriptor(RegisterId::MODULE_BATCH)));
+    TEST_ASSERT_EQUAL(2, mb8art::registerResponseBytes(mb8art::registerDescriptor(RegisterId::PRODUCT_VERSION)));
+}
+
+void test_request_builders() {
+    mb8art::RegisterRequest request = mb8art::registerRequest(RegisterId::TEMPERATURES);
+    TEST_ASSERT_EQUAL_UINT8(mb8art::REGISTER_FC_INPUT, request.functionCode);
+    TEST_ASSERT_EQUAL_UINT16(0, request.address);
+    TEST_ASSERT_EQUAL_UINT16(8, request.count);
+
+    request = mb8art::registerRequest(RegisterId::CONNECTION_STATUS);
+    TEST_ASSERT_EQUAL_UINT8(mb8art::REGISTER_FC_DISCRETE_INPUTS, request.functionCode);
+    TEST_ASSERT_EQUAL_UINT16(8, request.count);
+
+    request = mb8art::registerRequest(RegisterId::CHANNEL_CONFIG, 5);
+    TEST_ASSERT_EQUAL_UINT8(mb8art::REGISTER_FC_HOLDING, request.functionCode);
+    TEST_ASSERT_EQUAL_UINT16(133, request.address);
+    TEST_ASSERT_EQUAL_UINT16(1, request.count);
+
+    // Usable in constant expressions
+    static_assert(mb8art::registerRequest(RegisterId::PRODUCT_VERSION).address == 68, "register 68");
+}
+
+// ============================================================================
+// Dispatch
+// ============================================================================
+
+void test_every_block_dispatches_to_itself() {
+    for (const RegisterDescriptor& reg : mb8art::REGISTER_MAP) {
+        if (reg.id == RegisterId::RS485_ADDRESS) {
+            continue;  // Shares address 70 with the batch, reached by length
+        }
+        TEST_ASSERT_EQUAL_PTR(&reg, mb8art::findRegister(reg.functionCode, reg.address,
+                                                         mb8art::registerResponseBytes(reg)));
+    }
+}
+
+void test_function_code_selects_block() {
+    TEST_ASSERT_EQUAL(static_cast<int>(RegisterId::CONNECTION_STATUS), find(2, 0, 1));
+    TEST_ASSERT_EQUAL(static_cast<int>(RegisterId::TEMPERATURES), find(4, 0, 16));
+    TEST_ASSERT_EQUAL(-1, find(3, 0, 2));   // No holding register at 0
+}
+
+void test_batch_falls_back_by_length() {
+    TEST_ASSERT_EQUAL(static_cast<int>(RegisterId::MODULE_BATCH), find(3, 70, 14));
+    TEST_ASSERT_EQUAL(static_cast<int>(RegisterId::RS485_ADDRESS), find(3, 70, 2));
+    TEST_ASSERT_EQUAL(static_cast<int>(RegisterId::RS485_ADDRESS), find(3, 70, 6));
+}
+
+void test_channel_config_span() {
+    for (uint16_t address = 128; address < 136; address++) {
+        TEST_ASSERT_EQUAL(static_cast<int>(RegisterId::CHANNEL_CONFIG), find(3, address, 2));
+    }
+    // Other blocks only match their start register
+    TEST_ASSERT_EQUAL(-1, find(4, 3, 2));
+    TEST_ASSERT_EQUAL(-1, find(3, 73, 2));
+}
+
+void test_unknown_responses() {
+    TEST_ASSERT_EQUAL(-1, find(3, 64, 2));      // Equipment type: not mapped
+    TEST_ASSERT_EQUAL(-1, find(3, 69, 2));
+    TEST_ASSERT_EQUAL(-1, find(3, 136, 2));     // Past the dispatch array
+    TEST_ASSERT_EQUAL(-1, find(3, 0xFFFF, 2));
+    TEST_ASSERT_EQUAL(-1, find(1, 0, 2));       // Coils
+    TEST_ASSERT_EQUAL(-1, find(6, 76, 4));      // Writes are not dispatched
+    TEST_ASSERT_EQUAL(-1, find(0, 0, 0));
+}
+
+// ============================================================================
+// Payload helpers
+// ============================================================================
+
+void test_payload_helpers() {
+    const uint8_t payload[] = {0x22, 0x21, 0xFF, 0x38};
+    TEST_ASSERT_EQUAL_UINT16(0x2221, mb8art::registerWord(payload, 0));
+    TEST_ASSERT_EQUAL_INT16(-200, static_cast<int16_t>(mb8art::registerWord(payload, 1)));  // -20.0 °C
+
+    TEST_ASSERT_EQUAL_UINT8(0x22, mb8art::productHardwareVersion(0x2221));
+    TEST_ASSERT_EQUAL_UINT8(0x21, mb8art::productSoftwareVersion(0x2221));
+}
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_addresses_match_hardware_map);
+    RUN_TEST(test_response_sizes);
+    RUN_TEST(test_request_builders);
+    RUN_TEST(test_every_block_dispatches_to_itself);
+    RUN_TEST(test_function_code_selects_block);
+    RUN_TEST(test_batch_falls_back_by_length);
+    RUN_TEST(test_channel_config_span);
+    RUN_TEST(test_unknown_responses);
+    RUN_TEST(test_payload_helpers);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_addresses_match_hardware_map);
+    RUN_TEST(test_response_sizes);
+    RUN_TEST(test_request_builders);
+    RUN_TEST(test_every_block_dispatches_to_itself);
+    RUN_TEST(test_function_code_selects_block);
+    RUN_TEST(test_batch_falls_back_by_length);
+    RUN_TEST(test_channel_config_span);
+    RUN_TEST(test_unknown_responses);
+    RUN_TEST(test_payload_helpers);
+    return UNITY_END();
+}
+#endif
@@ -0,0 +1,166 @@
+/**
+ * @file test_mb8art_registry.cpp
+ * @brief Unit tests for the lock-free instance registry
+ *
+ * MB8ARTRegistry.h has no FreeRTOS dependency, so these tests run on the
+ * native (host) environment as well as on ESP32.
+ */
+
+#include <unity.h>
+#include <string.h>
+#include "MB8ARTRegistry.h"
+
+#ifndef ARDUINO
+#include <thread>
+#include <atomic>
+#endif
+
+using mb8art::InstanceRegistry;
+
+// Stand-in for MB8ART: keyed by address and tag
+struct FakeModule {
+    uint8_t address;
+    const char* tag;
+};
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Registration and lookup
+// ============================================================================
+
+void test_registry_finds_by_key() {
+    InstanceRegistry<FakeModule, 4> registry;
+    FakeModule boiler = {0x03, "boiler"};
+    FakeModule solar = {0x04, "solar"};
+
+    TEST_ASSERT_NULL(registry.first());
+    TEST_ASSERT_TRUE(registry.add(&boiler));
+    TEST_ASSERT_TRUE(registry.add(&solar));
+    TEST_ASSERT_TRUE(registry.add(&boiler));  // Idempotent
+    TEST_ASSERT_EQUAL_UINT8(2, registry.count());
+
+    FakeModule* byAddress = registry.find([](const FakeModule& m) { return m.address == 0x04; });
+    TEST_ASSERT_EQUAL_PTR(&solar, byAddress);
+    FakeModule* byTag = registry.find([](const FakeModule& m) { return strcmp(m.tag, "boiler") == 0; });
+    TEST_ASSERT_EQUAL_PTR(&boiler, byTag);
+    TEST_ASSERT_NULL(registry.find([](const FakeModule& m) { return m.address == 0x09; }));
+    TEST_ASSERT_EQUAL_PTR(&boiler, registry.first());
+}
+
+void test_registry_remove_frees_slot() {
+    InstanceRegistry<FakeModule, 2> registry;
+    FakeModule a = {1, "a"};
+    FakeModule b = {2, "b"};
+    FakeModule c = {3, "c"};
+
+    TEST_ASSERT_TRUE(registry.add(&a));
+    TEST_ASSERT_TRUE(registry.add(&b));
+    TEST_ASSERT_FALSE(registry.add(&c));  // Full
+
+    TEST_ASSERT_TRUE(registry.remove(&a));
+    TEST_ASSERT_FALSE(registry.remove(&a));
+    TEST_ASSERT_FALSE(registry.contains(&a));
+    TEST_ASSERT_EQUAL_PTR(&b, registry.first());
+
+    TEST_ASSERT_TRUE(registry.add(&c));
+    TEST_ASSERT_TRUE(registry.contains(&c));
+    TEST_ASSERT_EQUAL_UINT8(2, registry.count());
+}
+
+#ifndef ARDUINO
+// Readers scan while writers register/remove - a reader must only ever see
+// nullptr or a fully registered instance, never block
+void test_registry_concurrent_lookup() {
+    static InstanceRegistry<FakeModule, 8> registry;
+    static FakeModule modules[8];
+    for (uint8_t i = 0; i < 8; i++) {
+        modules[i].address = static_cast<uint8_t>(i + 1);
+        modules[i].tag = "m";
+    }
+    FakeModule pinned = {0x40, "pinned"};
+    TEST_ASSERT_TRUE(registry.add(&pinned));
+
+    std::atomic<bool> stop(false);
+    std::atomic<uint32_t> misses(0);
+    std::thread writer([&]() {
+        for (uint32_t round = 0; round < 20000; round++) {
+            FakeModule* m = &modules[round % 7];
+            registry.add(m);
+            registry.remove(m);
+        }
+        stop.store(true);
+    });
+    std::thread reader([&]() {
+        while (!stop.load()) {
+            FakeModule* found = registry.find([](const FakeModule& m) { return m.address == 0x40; });
+            if (found != &pinned) {
+                misses.fetch_add(1);
+            }
+        }
+    });
+    writer.join();
+    reader.join();
+
+    TEST_ASSERT_EQUAL_UINT32(0, misses.load());
+    TEST_ASSERT_EQUAL_UINT8(1, registry.count());
+}
+
+// Several tasks register the same instance at once - it must end up in
+// exactly one slot, and one remove() must unregister it
+void test_registry_concurrent_duplicate_add() {
+    static InstanceRegistry<FakeModule, 8> registry;
+    FakeModule module = {0x21, "dup"};
+    for (uint32_t round = 0; round < 2000; round++) {
+        std::atomic<bool> go(false);
+        std::thread adders[4];
+        for (uint8_t t = 0; t < 4; t++) {
+            adders[t] = std::thread([&]() {
+                while (!go.load()) {
+                }
+                registry.add(&module);
+            });
+        }
+        go.store(true);
+        for (uint8_t t = 0; t < 4; t++) {
+            adders[t].join();
+        }
+        TEST_ASSERT_EQUAL_UINT8(1, registry.count());
+        TEST_ASSERT_TRUE(registry.remove(&module));
+        TEST_ASSERT_EQUAL_UINT8(0, registry.count());
+    }
+}
+#endif
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_registry_finds_by_key);
+    RUN_TEST(test_registry_remove_frees_slot);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_registry_finds_by_key);
+    RUN_TEST(test_registry_remove_frees_slot);
+    RUN_TEST(test_registry_concurrent_lookup);
+    RUN_TEST(test_registry_concurrent_duplicate_add);
+    return UNITY_END();
+}
+#endif
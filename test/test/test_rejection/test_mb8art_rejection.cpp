@@ -0,0 +1,176 @@
+/**
+ * @file test_mb8art_rejection.cpp
+ * @brief Unit tests for the ingest spike rejector
+ *
+ * SpikeRejector lives in MB8ARTFilters.h, which has no FreeRTOS dependency,
+ * so these tests run on the native (host) environment as well as on ESP32.
+ */
+
+#include <unity.h>
+#include "MB8ARTFilters.h"
+
+using mb8art::RejectionConfig;
+using mb8art::RejectReason;
+using mb8art::SpikeRejector;
+
+static RejectionConfig makeConfig(uint16_t maxSlewPerSecond, uint16_t jumpThreshold) {
+    RejectionConfig config;
+    config.maxSlewPerSecond = maxSlewPerSecond;
+    config.jumpThreshold = jumpThreshold;
+    return config;
+}
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Defaults
+// ============================================================================
+
+void test_disabled_accepts_everything() {
+    SpikeRejector rejector;
+    TEST_ASSERT_FALSE(rejector.getConfig().isEnabled());
+    TEST_ASSERT_TRUE(rejector.check(0, 1000) == RejectReason::NONE);
+    TEST_ASSERT_TRUE(rejector.check(INT16_MAX, 0) == RejectReason::NONE);
+    TEST_ASSERT_TRUE(rejector.check(INT16_MIN, 0) == RejectReason::NONE);
+}
+
+void test_first_sample_primes() {
+    SpikeRejector rejector;
+    rejector.configure(makeConfig(10, 20));
+    // Nothing to compare against yet - any value is accepted
+    TEST_ASSERT_TRUE(rejector.check(5000, 0) == RejectReason::NONE);
+    TEST_ASSERT_TRUE(rejector.check(5005, 1000) == RejectReason::NONE);
+}
+
+// ============================================================================
+// Slew-rate limit
+// ============================================================================
+
+void test_slew_rate_limit_scales_with_elapsed_time() {
+    SpikeRejector rejector;
+    rejector.configure(makeConfig(50, 0));  // 5.0 °C/s in tenths
+
+    TEST_ASSERT_TRUE(rejector.check(200, 0) == RejectReason::NONE);
+    TEST_ASSERT_TRUE(rejector.check(260, 1000) == RejectReason::SLEW_RATE);
+    TEST_ASSERT_TRUE(rejector.check(250, 1000) == RejectReason::NONE);   // Exactly the limit
+    TEST_ASSERT_TRUE(rejector.check(150, 1000) == RejectReason::SLEW_RATE);
+
+    // After an outage the allowed delta grows with the gap, so a real change recovers
+    TEST_ASSERT_TRUE(rejector.check(150, 2000) == RejectReason::NONE);
+}
+
+void test_slew_rate_handles_full_range_delta() {
+    SpikeRejector rejector;
+    rejector.configure(makeConfig(UINT16_MAX, 0));
+
+    TEST_ASSERT_TRUE(rejector.check(INT16_MIN, 0) == RejectReason::NONE);
+    TEST_ASSERT_TRUE(rejector.check(INT16_MAX, 100) == RejectReason::SLEW_RATE);
+    TEST_ASSERT_TRUE(rejector.check(INT16_MAX, UINT32_MAX) == RejectReason::NONE);
+}
+
+// ============================================================================
+// Confirm-on-next-frame
+// ============================================================================
+
+void test_step_change_passes_one_frame_late() {
+    SpikeRejector rejector;
+    rejector.configure(makeConfig(0, 20));
+
+    TEST_ASSERT_TRUE(rejector.check(200, 1000) == RejectReason::NONE);
+    TEST_ASSERT_TRUE(rejector.check(215, 1000) == RejectReason::NONE);       // Below threshold
+    TEST_ASSERT_TRUE(rejector.check(400, 1000) == RejectReason::UNCONFIRMED);
+    TEST_ASSERT_TRUE(rejector.check(405, 1000) == RejectReason::NONE);       // Confirmed
+    TEST_ASSERT_TRUE(rejector.check(405, 1000) == RejectReason::NONE);
+}
+
+void test_single_glitch_never_passes() {
+    SpikeRejector rejector;
+    rejector.configure(makeConfig(0, 20));
+
+    TEST_ASSERT_TRUE(rejector.check(200, 1000) == RejectReason::NONE);
+    TEST_ASSERT_TRUE(rejector.check(900, 1000) == RejectReason::UNCONFIRMED);
+    TEST_ASSERT_TRUE(rejector.check(201, 1000) == RejectReason::NONE);       // Back to normal
+    // The earlier candidate is forgotten - a new glitch needs its own confirmation
+    TEST_ASSERT_TRUE(rejector.check(900, 1000) == RejectReason::UNCONFIRMED);
+}
+
+void test_alternating_glitches_stay_rejected() {
+    SpikeRejector rejector;
+    rejector.configure(makeConfig(0, 20));
+
+    TEST_ASSERT_TRUE(rejector.check(200, 1000) == RejectReason::NONE);
+    // Candidates that disagree with each other never confirm
+    TEST_ASSERT_TRUE(rejector.check(900, 1000) == RejectReason::UNCONFIRMED);
+    TEST_ASSERT_TRUE(rejector.check(-500, 1000) == RejectReason::UNCONFIRMED);
+    TEST_ASSERT_TRUE(rejector.check(900, 1000) == RejectReason::UNCONFIRMED);
+}
+
+void test_slew_reject_drops_pending_candidate() {
+    SpikeRejector rejector;
+    rejector.configure(makeConfig(100, 20));
+
+    TEST_ASSERT_TRUE(rejector.check(200, 1000) == RejectReason::NONE);
+    TEST_ASSERT_TRUE(rejector.check(260, 1000) == RejectReason::UNCONFIRMED);
+    TEST_ASSERT_TRUE(rejector.check(400, 1000) == RejectReason::SLEW_RATE);
+    // The slew reject cleared the candidate, so 260 has to be confirmed again
+    TEST_ASSERT_TRUE(rejector.check(260, 1000) == RejectReason::UNCONFIRMED);
+    TEST_ASSERT_TRUE(rejector.check(262, 1000) == RejectReason::NONE);
+}
+
+void test_reset_forgets_last_accepted() {
+    SpikeRejector rejector;
+    rejector.configure(makeConfig(10, 20));
+    TEST_ASSERT_TRUE(rejector.check(200, 0) == RejectReason::NONE);
+    TEST_ASSERT_TRUE(rejector.check(2000, 100) != RejectReason::NONE);
+
+    rejector.reset();
+    TEST_ASSERT_TRUE(rejector.check(2000, 100) == RejectReason::NONE);
+
+    rejector.configure(makeConfig(10, 20));  // Reconfigure resets as well
+    TEST_ASSERT_TRUE(rejector.check(-2000, 0) == RejectReason::NONE);
+}
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_disabled_accepts_everything);
+    RUN_TEST(test_first_sample_primes);
+    RUN_TEST(test_slew_rate_limit_scales_with_elapsed_time);
+    RUN_TEST(test_slew_rate_handles_full_range_delta);
+    RUN_TEST(test_step_change_passes_one_frame_late);
+    RUN_TEST(test_single_glitch_never_passes);
+    RUN_TEST(test_alternating_glitches_stay_rejected);
+    RUN_TEST(test_slew_reject_drops_pending_candidate);
+    RUN_TEST(test_reset_forgets_last_accepted);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_disabled_accepts_everything);
+    RUN_TEST(test_first_sample_primes);
+    RUN_TEST(test_slew_rate_limit_scales_with_elapsed_time);
+    RUN_TEST(test_slew_rate_handles_full_range_delta);
+    RUN_TEST(test_step_change_passes_one_frame_late);
+    RUN_TEST(test_single_glitch_never_passes);
+    RUN_TEST(test_alternating_glitches_stay_rejected);
+    RUN_TEST(test_slew_reject_drops_pending_candidate);
+    RUN_TEST(test_reset_forgets_last_accepted);
+    return UNITY_END();
+}
+#endif
@@ -0,0 +1,221 @@
+/**
+ * @file test_mb8art_rollup.cpp
+ * @brief Unit tests for the multi-resolution min/max/mean rollups
+ *
+ * MB8ARTRollup.h has no FreeRTOS dependency, so these tests run on the
+ * native (host) environment as well as on ESP32.
+ */
+
+#include <unity.h>
+#include "MB8ARTRollup.h"
+
+#ifndef ARDUINO
+#include <thread>
+#include <atomic>
+#endif
+
+using mb8art::RollupPoint;
+using mb8art::StaticRollup;
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Buckets
+// ============================================================================
+
+void test_samples_fold_into_every_tier() {
+    static StaticRollup<60, 60, 24> rollup;
+    rollup.clear();
+    for (uint32_t t = 0; t < 120; t++) {
+        rollup.add(t, static_cast<int16_t>(t));
+    }
+
+    RollupPoint points[4];
+    uint8_t tier = 0xFF;
+    // 2 minutes back: the seconds ring only holds the last 60 s
+    size_t n = rollup.query(0, 119, 4, points, 4, &tier);
+    TEST_ASSERT_EQUAL_UINT8(1, tier);
+    TEST_ASSERT_EQUAL_UINT32(2, n);
+    TEST_ASSERT_EQUAL_UINT32(0, points[0].startSec);
+    TEST_ASSERT_EQUAL_INT16(0, points[0].min);
+    TEST_ASSERT_EQUAL_INT16(59, points[0].max);
+    TEST_ASSERT_EQUAL_INT16(30, points[0].mean);   // 29.5 rounds away from zero
+    TEST_ASSERT_EQUAL_UINT16(60, points[0].count);
+    TEST_ASSERT_EQUAL_UINT32(60, points[1].startSec);
+    TEST_ASSERT_EQUAL_INT16(60, points[1].min);
+    TEST_ASSERT_EQUAL_INT16(119, points[1].max);
+
+    // Hour tier has everything in one bucket
+    n = rollup.query(0, 119, 1, points, 4, &tier);
+    TEST_ASSERT_EQUAL_UINT8(2, tier);
+    TEST_ASSERT_EQUAL_UINT32(1, n);
+    TEST_ASSERT_EQUAL_UINT16(120, points[0].count);
+    TEST_ASSERT_EQUAL_INT16(0, points[0].min);
+    TEST_ASSERT_EQUAL_INT16(119, points[0].max);
+}
+
+void test_negative_mean_rounding() {
+    static StaticRollup<4, 4, 4> rollup;
+    rollup.clear();
+    rollup.add(10, -5);
+    rollup.add(10, -6);
+
+    RollupPoint point;
+    TEST_ASSERT_EQUAL_UINT32(1, rollup.query(10, 10, 1, &point, 1));
+    TEST_ASSERT_EQUAL_INT16(-6, point.mean);   // -5.5
+    TEST_ASSERT_EQUAL_INT16(-6, point.min);
+    TEST_ASSERT_EQUAL_INT16(-5, point.max);
+}
+
+void test_count_saturates_but_extremes_track() {
+    static StaticRollup<2, 2, 2> rollup;
+    rollup.clear();
+    for (uint32_t i = 0; i < 70000; i++) {
+        rollup.add(5, 10);
+    }
+    rollup.add(5, -100);
+    rollup.add(5, 100);
+
+    RollupPoint point;
+    TEST_ASSERT_EQUAL_UINT32(1, rollup.query(5, 5, 1, &point, 1));
+    TEST_ASSERT_EQUAL_UINT16(UINT16_MAX, point.count);
+    TEST_ASSERT_EQUAL_INT16(10, point.mean);   // Mean of the first 65535 samples
+    TEST_ASSERT_EQUAL_INT16(-100, point.min);
+    TEST_ASSERT_EQUAL_INT16(100, point.max);
+}
+
+// ============================================================================
+// Tier selection and budgets
+// ============================================================================
+
+void test_finest_tier_within_budget() {
+    static StaticRollup<60, 60, 24> rollup;
+    rollup.clear();
+    for (uint32_t t = 0; t < 600; t++) {
+        rollup.add(t, 200);
+    }
+
+    // Last 30 s fit the seconds ring and the budget
+    TEST_ASSERT_EQUAL_UINT8(0, rollup.selectTier(570, 599, 60));
+    // Same range, tighter budget: minutes
+    TEST_ASSERT_EQUAL_UINT8(1, rollup.selectTier(570, 599, 10));
+    // Ten minutes back: seconds ring has wrapped past it
+    TEST_ASSERT_EQUAL_UINT8(1, rollup.selectTier(0, 599, 60));
+}
+
+void test_over_budget_keeps_newest_buckets() {
+    static StaticRollup<4, 4, 4> rollup;
+    rollup.clear();
+    for (uint32_t h = 0; h < 3; h++) {
+        rollup.add(h * 3600, static_cast<int16_t>(h));
+    }
+
+    RollupPoint points[3];
+    uint8_t tier = 0;
+    // Even the hour tier needs 3 points - the newest one is returned
+    size_t n = rollup.query(0, 7200, 1, points, 3, &tier);
+    TEST_ASSERT_EQUAL_UINT8(2, tier);
+    TEST_ASSERT_EQUAL_UINT32(1, n);
+    TEST_ASSERT_EQUAL_UINT32(7200, points[0].startSec);
+
+    // Output capacity limits as well, oldest dropped first
+    n = rollup.query(0, 7200, 3, points, 2, &tier);
+    TEST_ASSERT_EQUAL_UINT32(2, n);
+    TEST_ASSERT_EQUAL_UINT32(3600, points[0].startSec);
+    TEST_ASSERT_EQUAL_UINT32(7200, points[1].startSec);
+}
+
+void test_invalid_queries_and_clear() {
+    static StaticRollup<4, 4, 4> rollup;
+    rollup.clear();
+    rollup.add(100, 1);
+
+    RollupPoint point;
+    TEST_ASSERT_EQUAL_UINT32(0, rollup.query(200, 100, 4, &point, 1));
+    TEST_ASSERT_EQUAL_UINT32(0, rollup.query(0, 200, 0, &point, 1));
+    TEST_ASSERT_EQUAL_UINT32(0, rollup.query(0, 200, 4, nullptr, 1));
+    TEST_ASSERT_EQUAL_UINT32(1, rollup.query(0, 200, 4, &point, 1));
+
+    rollup.clear();
+    TEST_ASSERT_EQUAL_UINT32(0, rollup.query(0, 200, 4, &point, 1));
+    TEST_ASSERT_EQUAL_UINT8(3, rollup.getTierCount());
+    TEST_ASSERT_EQUAL_UINT32(60, rollup.getTierResolution(1));
+    TEST_ASSERT_EQUAL_UINT32(0, rollup.getTierResolution(3));
+}
+
+#ifndef ARDUINO
+// Queries run while the writer opens new buckets - every point returned must
+// be internally consistent (one sample value per second, min <= mean <= max)
+void test_concurrent_query() {
+    static StaticRollup<16, 16, 16> rollup;
+    rollup.clear();
+    std::atomic<bool> stop(false);
+    std::atomic<uint32_t> violations(0);
+
+    std::thread writer([&]() {
+        for (uint32_t t = 0; t < 200000; t++) {
+            rollup.add(t, static_cast<int16_t>(t % 1000));
+        }
+        stop.store(true);
+    });
+    std::thread reader([&]() {
+        RollupPoint points[16];
+        while (!stop.load()) {
+            size_t n = rollup.query(0, UINT32_MAX - 1, 16, points, 16);
+            for (size_t i = 0; i < n; i++) {
+                if (points[i].min > points[i].mean || points[i].mean > points[i].max ||
+                    points[i].count == 0) {
+                    violations.fetch_add(1);
+                }
+                if (i > 0 && points[i].startSec <= points[i - 1].startSec) {
+                    violations.fetch_add(1);
+                }
+            }
+        }
+    });
+    writer.join();
+    reader.join();
+
+    TEST_ASSERT_EQUAL_UINT32(0, violations.load());
+}
+#endif
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_samples_fold_into_every_tier);
+    RUN_TEST(test_negative_mean_rounding);
+    RUN_TEST(test_count_saturates_but_extremes_track);
+    RUN_TEST(test_finest_tier_within_budget);
+    RUN_TEST(test_over_budget_keeps_newest_buckets);
+    RUN_TEST(test_invalid_queries_and_clear);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_samples_fold_into_every_tier);
+    RUN_TEST(test_negative_mean_rounding);
+    RUN_TEST(test_count_saturates_but_extremes_track);
+    RUN_TEST(test_finest_tier_within_budget);
+    RUN_TEST(test_over_budget_keeps_newest_buckets);
+    RUN_TEST(test_invalid_queries_and_clear);
+    RUN_TEST(test_concurrent_query);
+    return UNITY_END();
+}
+#endif
@@ -0,0 +1,163 @@
+/**
+ * @file test_mb8art_sensor_state.cpp
+ * @brief Unit tests and AoS/SoA benchmark for the per-channel sensor state
+ *
+ * MB8ARTSensorState.h has no FreeRTOS dependency, so these tests run on the
+ * native (host) environment as well as on ESP32.
+ */
+
+#include <unity.h>
+#include <stdio.h>
+#include "MB8ARTSensorState.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+static uint32_t benchMicros() { return micros(); }
+#else
+#include <chrono>
+static uint32_t benchMicros() {
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+#endif
+
+using mb8art::SensorStateTable;
+
+// Layout of the previous array-of-structs state (mb8art::SensorReading)
+struct LegacyReading {
+    int16_t temperature;
+    uint32_t lastTemperatureUpdated;
+    uint8_t isTemperatureValid : 1;
+    uint8_t Error : 1;
+    uint8_t lastCommandSuccess : 1;
+    uint8_t isStateConfirmed : 1;
+    uint8_t isRejected : 1;
+    uint8_t reserved : 3;
+};
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Flags and decode plan
+// ============================================================================
+
+void test_sensor_state_flags_are_per_channel() {
+    SensorStateTable state;
+    state.reset();
+
+    state.setValid(0, true);
+    state.setValid(7, true);
+    state.setError(3, true);
+    state.setRejected(5, true);
+    TEST_ASSERT_EQUAL_UINT8(0x81, state.validMask);
+    TEST_ASSERT_TRUE(state.isValid(7));
+    TEST_ASSERT_FALSE(state.isValid(3));
+    TEST_ASSERT_TRUE(state.hasError(3));
+    TEST_ASSERT_TRUE(state.isRejected(5));
+
+    state.setValid(0, false);
+    TEST_ASSERT_EQUAL_UINT8(0x80, state.validMask);
+    TEST_ASSERT_FALSE(state.isCommandOk(0));
+}
+
+void test_sensor_state_plan_range_is_inclusive() {
+    SensorStateTable state;
+    state.reset();
+    state.validMin[2] = -2000;
+    state.validMax[2] = 8500;
+
+    TEST_ASSERT_TRUE(state.isInPlanRange(2, -2000));
+    TEST_ASSERT_TRUE(state.isInPlanRange(2, 8500));
+    TEST_ASSERT_FALSE(state.isInPlanRange(2, 8501));
+    TEST_ASSERT_FALSE(state.isInPlanRange(2, -2001));
+    // A reset plan accepts only 0 - the decode path rebuilds it before use
+    TEST_ASSERT_FALSE(state.isInPlanRange(3, 1));
+}
+
+// ============================================================================
+// Benchmark: footprint and frame extraction (history append input)
+// ============================================================================
+
+void test_sensor_state_benchmark_against_array_of_structs() {
+    static LegacyReading legacy[8];
+    static SensorStateTable state;
+    state.reset();
+    for (uint8_t ch = 0; ch < 8; ch++) {
+        legacy[ch].temperature = static_cast<int16_t>(200 + ch);
+        legacy[ch].isTemperatureValid = ch & 1;
+        state.temperature[ch] = static_cast<int16_t>(200 + ch);
+        state.setValid(ch, ch & 1);
+    }
+
+    const uint32_t rounds = 200000;
+    volatile uint32_t sink = 0;
+    int16_t values[8];
+
+    uint32_t start = benchMicros();
+    for (uint32_t r = 0; r < rounds; r++) {
+        uint8_t mask = 0;
+        for (uint8_t ch = 0; ch < 8; ch++) {
+            values[ch] = legacy[ch].temperature;
+            if (legacy[ch].isTemperatureValid) {
+                mask |= static_cast<uint8_t>(1u << ch);
+            }
+        }
+        sink = sink + mask + static_cast<uint16_t>(values[r & 7]);
+        legacy[r & 7].temperature = static_cast<int16_t>(r);
+    }
+    uint32_t aosElapsed = benchMicros() - start;
+
+    start = benchMicros();
+    for (uint32_t r = 0; r < rounds; r++) {
+        memcpy(values, state.temperature, sizeof(values));
+        uint8_t mask = state.validMask;
+        sink = sink + mask + static_cast<uint16_t>(values[r & 7]);
+        state.temperature[r & 7] = static_cast<int16_t>(r);
+    }
+    uint32_t soaElapsed = benchMicros() - start;
+
+    char message[200];
+    snprintf(message, sizeof(message),
+             "sensor state: AoS %lu bytes, SoA %lu bytes (incl. decode plan); "
+             "frame extract AoS %lu ns, SoA %lu ns",
+             static_cast<unsigned long>(sizeof(legacy)),
+             static_cast<unsigned long>(sizeof(SensorStateTable)),
+             static_cast<unsigned long>(aosElapsed * 1000 / rounds),
+             static_cast<unsigned long>(soaElapsed * 1000 / rounds));
+    TEST_MESSAGE(message);
+
+    // State without the decode plan must be smaller than the old layout
+    TEST_ASSERT_LESS_THAN(sizeof(legacy), sizeof(SensorStateTable) - 2 * sizeof(state.validMin));
+    (void)sink;
+}
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_sensor_state_flags_are_per_channel);
+    RUN_TEST(test_sensor_state_plan_range_is_inclusive);
+    RUN_TEST(test_sensor_state_benchmark_against_array_of_structs);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_sensor_state_flags_are_per_channel);
+    RUN_TEST(test_sensor_state_plan_range_is_inclusive);
+    RUN_TEST(test_sensor_state_benchmark_against_array_of_structs);
+    return UNITY_END();
+}
+#endif
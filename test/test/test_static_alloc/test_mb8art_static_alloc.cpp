@@ -0,0 +1,279 @@
+/**
+ * @file test_mb8art_static_alloc.cpp
+ * @brief Zero-allocation check for the steady-state ingest path
+ *
+ * Replaces the global allocation operators with counting versions and runs
+ * the per-frame work MB8ART::processTemperatureData() does for each channel
+ * (state table, spike rejection, filter chain, statistics, alarms, hold
+ * snapshot, history, rollups, reader queries). The test fails if any of it
+ * touches the heap once the pipeline is set up.
+ *
+ * The native test covers a re-implementation of that pipeline built from the
+ * same header-only components - it cannot see an allocation added to
+ * MB8ART::processTemperatureData() itself. On ESP32, where MB8ART links,
+ * test_decode_path_does_not_allocate additionally drives the real
+ * handleModbusResponse() -> processTemperatureData() path through
+ * MockMB8ART.
+ */
+
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <new>
+#include "MB8ARTSensorState.h"
+#include "MB8ARTFilters.h"
+#include "MB8ARTStatistics.h"
+#include "MB8ARTAlarms.h"
+#include "MB8ARTHold.h"
+#include "MB8ARTSeqLock.h"
+#include "MB8ARTHistory.h"
+#include "MB8ARTRollup.h"
+
+// ============================================================================
+// Counting allocator
+// ============================================================================
+
+static volatile unsigned long allocationCount = 0;
+
+void* operator new(size_t size) {
+    allocationCount = allocationCount + 1;
+    void* p = malloc(size != 0 ? size : 1);
+    if (p == nullptr) {
+        abort();
+    }
+    return p;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+// ============================================================================
+// Pipeline under test (same per-channel order as processTemperatureData)
+// ============================================================================
+
+using namespace mb8art;
+
+static const uint8_t CHANNELS = SensorStateTable::CHANNELS;
+
+struct IngestPipeline {
+    SensorStateTable state;
+    SpikeRejector rejectors[CHANNELS];
+    ChannelFilter filters[CHANNELS];
+    RollingStatistics statistics[CHANNELS];
+    ChannelAlarms alarms[CHANNELS];
+    ChannelSnapshot snapshots[CHANNELS];
+    SeqLock<ChannelSnapshot> published[CHANNELS];
+    StaticHistory<8, 128> history;
+    StaticRollup<60, 60, 24> rollup;
+    QualityCode quality[CHANNELS];
+
+    void setUp() {
+        state.reset();
+        FilterConfig filter;
+        filter.median = MedianWindow::MEDIAN_5;
+        filter.smoothing = SmoothingFilter::KALMAN;
+        RejectionConfig rejection;
+        rejection.maxSlewPerSecond = 500;
+        rejection.jumpThreshold = 100;
+        AlarmRule high;
+        high.type = AlarmType::HIGH;
+        high.threshold = 600;
+        high.hysteresis = 20;
+        AlarmRule stale;
+        stale.type = AlarmType::STALE;
+        stale.threshold = 10;
+        for (uint8_t ch = 0; ch < CHANNELS; ch++) {
+            state.validMin[ch] = -2000;
+            state.validMax[ch] = 8500;
+            rejectors[ch].configure(rejection);
+            filters[ch].configure(filter);
+            statistics[ch].setWindow(RollingStatistics::CAPACITY);
+            alarms[ch].setRule(0, high);
+            alarms[ch].setRule(1, stale);
+            snapshots[ch].policy.uncertainAfterMs = 5000;
+            snapshots[ch].policy.badAfterMs = 30000;
+            snapshots[ch].policy.extrapolateMs = 10000;
+            quality[ch] = QualityCode::BAD_NO_DATA;
+        }
+    }
+
+    void ingest(uint32_t nowMs, const int16_t* raw) {
+        for (uint8_t ch = 0; ch < CHANNELS; ch++) {
+            bool inRange = state.isInPlanRange(ch, raw[ch]);
+            if (!inRange || rejectors[ch].check(raw[ch], 1000) != RejectReason::NONE) {
+                quality[ch] = inRange ? QualityCode::UNCERTAIN_REJECTED : QualityCode::BAD_OUT_OF_RANGE;
+                if (recordMissedSample(snapshots[ch], quality[ch])) {
+                    published[ch].write(snapshots[ch]);
+                }
+                state.setValid(ch, false);
+                continue;
+            }
+            int16_t value = filters[ch].apply(raw[ch]);
+            state.temperature[ch] = value;
+            state.updatedAt[ch] = nowMs;
+            state.setValid(ch, true);
+            quality[ch] = QualityCode::GOOD_FILTERED;
+
+            recordGoodSample(snapshots[ch], value, quality[ch], nowMs);
+            published[ch].write(snapshots[ch]);
+            statistics[ch].push(value);
+            rollup.add(nowMs / 1000, value);
+
+            AlarmInput input = {true, false, value, nowMs};
+            alarms[ch].evaluate(input);
+        }
+        history.append(nowMs, state.validMask, state.temperature, quality);
+    }
+};
+
+static IngestPipeline pipeline;
+
+static void makeFrame(uint32_t index, int16_t* raw) {
+    for (uint8_t ch = 0; ch < CHANNELS; ch++) {
+        raw[ch] = static_cast<int16_t>(200 + ch * 50 + (index / 10) % 100 + (index % 3));
+    }
+    // Periodic glitch and out-of-range sample exercise the reject paths
+    if (index % 50 == 0) {
+        raw[index % CHANNELS] = 4000;
+    }
+    if (index % 70 == 0) {
+        raw[(index + 1) % CHANNELS] = 30000;
+    }
+}
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Tests
+// ============================================================================
+
+void test_counting_allocator_sees_heap_use() {
+    unsigned long before = allocationCount;
+    int* volatile probe = new int(42);
+    TEST_ASSERT_EQUAL_UINT32(before + 1, allocationCount);
+    delete probe;
+}
+
+void test_steady_state_ingest_does_not_allocate() {
+    pipeline.setUp();
+    int16_t raw[CHANNELS];
+
+    // Warm-up: fill filters, statistics windows and history blocks
+    uint32_t nowMs = 0;
+    for (uint32_t i = 0; i < 200; i++, nowMs += 1000) {
+        makeFrame(i, raw);
+        pipeline.ingest(nowMs, raw);
+    }
+
+    unsigned long before = allocationCount;
+    HistoryFrame frame;
+    RollupPoint points[32];
+    for (uint32_t i = 200; i < 5200; i++, nowMs += 1000) {
+        makeFrame(i, raw);
+        pipeline.ingest(nowMs, raw);
+
+        // Consumer side: lock-free reads
+        for (uint8_t ch = 0; ch < CHANNELS; ch++) {
+            HeldReading held = evaluateHold(pipeline.published[ch].read(), nowMs);
+            (void)held;
+            ChannelStatistics summary = pipeline.statistics[ch].summary();
+            (void)summary;
+        }
+        if (i % 100 == 0) {
+            auto reader = pipeline.history.reader();
+            while (reader.next(frame)) {
+            }
+            pipeline.rollup.query(nowMs / 1000 - 3600, nowMs / 1000, 32, points, 32);
+        }
+    }
+    unsigned long allocations = allocationCount - before;
+
+    char message[96];
+    snprintf(message, sizeof(message), "5000 frames x %u channels: %lu heap allocations",
+             static_cast<unsigned>(CHANNELS), allocations);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_EQUAL_UINT32(0, allocations);
+}
+
+// ============================================================================
+// Real decode path (ESP32 only - MB8ART needs the Modbus/FreeRTOS stack)
+// ============================================================================
+
+#ifdef ARDUINO
+#include "MockMB8ART.h"
+
+void test_decode_path_does_not_allocate() {
+    // Constructed before counting starts; PT1000 channels, LOW_RES (tenths)
+    static MockMB8ART* device = new MockMB8ART(0x03);
+    device->initialize();
+    const mb8art::RegisterDescriptor& reg = mb8art::registerDescriptor(mb8art::RegisterId::TEMPERATURES);
+    uint8_t payload[CHANNELS * 2];
+
+    auto feed = [&](uint32_t index) {
+        for (uint8_t ch = 0; ch < CHANNELS; ch++) {
+            uint16_t value = static_cast<uint16_t>(200 + ch * 50 + (index / 10) % 100 + (index % 3));
+            payload[ch * 2] = static_cast<uint8_t>(value >> 8);
+            payload[ch * 2 + 1] = static_cast<uint8_t>(value);
+        }
+        device->simulateModbusResponse(reg.functionCode, reg.address, payload, sizeof(payload));
+    };
+
+    // Warm-up: first-use state in the driver and its dependencies
+    for (uint32_t i = 0; i < 50; i++) {
+        feed(i);
+    }
+
+    unsigned long before = allocationCount;
+    for (uint32_t i = 50; i < 1050; i++) {
+        feed(i);
+        for (uint8_t ch = 0; ch < CHANNELS; ch++) {
+            mb8art::HeldReading held = device->getHeldReading(ch);
+            (void)held;
+        }
+    }
+    unsigned long allocations = allocationCount - before;
+
+    char message[96];
+    snprintf(message, sizeof(message), "1000 decoded frames: %lu heap allocations", allocations);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_EQUAL_UINT32(0, allocations);
+}
+#endif
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_counting_allocator_sees_heap_use);
+    RUN_TEST(test_steady_state_ingest_does_not_allocate);
+    RUN_TEST(test_decode_path_does_not_allocate);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_counting_allocator_sees_heap_use);
+    RUN_TEST(test_steady_state_ingest_does_not_allocate);
+    return UNITY_END();
+}
+#endif
@@ -0,0 +1,205 @@
+/**
+ * @file test_mb8art_statistics.cpp
+ * @brief Unit tests for the O(1) rolling statistics aggregator
+ *
+ * MB8ARTStatistics.h has no FreeRTOS dependency, so these tests run on the
+ * native (host) environment as well as on ESP32. Results are checked against
+ * a brute-force recomputation over the same window.
+ */
+
+#include <unity.h>
+#include "MB8ARTStatistics.h"
+
+using mb8art::ChannelStatistics;
+using mb8art::RollingStatistics;
+
+// Brute-force reference over the last `window` samples of `samples`
+static ChannelStatistics reference(const int16_t* samples, uint32_t pushed, uint8_t window) {
+    ChannelStatistics stats;
+    uint32_t n = pushed < window ? pushed : window;
+    stats.count = static_cast<uint16_t>(n);
+    stats.totalSamples = pushed;
+    if (n == 0) {
+        return stats;
+    }
+    int64_t sum = 0;
+    int64_t sumSquares = 0;
+    int16_t lo = INT16_MAX;
+    int16_t hi = INT16_MIN;
+    for (uint32_t i = pushed - n; i < pushed; i++) {
+        int16_t v = samples[i];
+        sum += v;
+        sumSquares += static_cast<int64_t>(v) * v;
+        if (v < lo) lo = v;
+        if (v > hi) hi = v;
+    }
+    int64_t half = static_cast<int64_t>(n) / 2;
+    stats.min = lo;
+    stats.max = hi;
+    stats.mean = static_cast<int16_t>((sum >= 0 ? sum + half : sum - half) / static_cast<int64_t>(n));
+    stats.variance = static_cast<uint32_t>((static_cast<int64_t>(n) * sumSquares - sum * sum) /
+                                           (static_cast<int64_t>(n) * n));
+    return stats;
+}
+
+static void assertSummary(const ChannelStatistics& expected, const ChannelStatistics& actual) {
+    TEST_ASSERT_EQUAL_UINT16(expected.count, actual.count);
+    TEST_ASSERT_EQUAL_UINT32(expected.totalSamples, actual.totalSamples);
+    TEST_ASSERT_EQUAL_INT16(expected.min, actual.min);
+    TEST_ASSERT_EQUAL_INT16(expected.max, actual.max);
+    TEST_ASSERT_EQUAL_INT16(expected.mean, actual.mean);
+    TEST_ASSERT_EQUAL_UINT32(expected.variance, actual.variance);
+}
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+void test_disabled_by_default() {
+    RollingStatistics stats;
+    TEST_ASSERT_FALSE(stats.isEnabled());
+    stats.push(100);
+    TEST_ASSERT_EQUAL_UINT16(0, stats.summary().count);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.summary().totalSamples);
+}
+
+void test_window_bounds() {
+    RollingStatistics stats;
+    TEST_ASSERT_FALSE(stats.setWindow(RollingStatistics::CAPACITY + 1));
+    TEST_ASSERT_FALSE(stats.isEnabled());
+    TEST_ASSERT_TRUE(stats.setWindow(RollingStatistics::CAPACITY));
+    TEST_ASSERT_EQUAL_UINT8(RollingStatistics::CAPACITY, stats.getWindow());
+    TEST_ASSERT_TRUE(stats.setWindow(0));
+    TEST_ASSERT_FALSE(stats.isEnabled());
+}
+
+// ============================================================================
+// Values
+// ============================================================================
+
+void test_known_window() {
+    RollingStatistics stats;
+    stats.setWindow(4);
+    const int16_t samples[] = {2, 4, 4, 4, 5, 5, 7, 9};
+    for (int16_t v : samples) {
+        stats.push(v);
+    }
+    // Last four: 5 5 7 9 -> mean 6.5 -> 7, variance 2.75 -> 2
+    ChannelStatistics s = stats.summary();
+    TEST_ASSERT_EQUAL_UINT16(4, s.count);
+    TEST_ASSERT_EQUAL_UINT32(8, s.totalSamples);
+    TEST_ASSERT_EQUAL_INT16(5, s.min);
+    TEST_ASSERT_EQUAL_INT16(9, s.max);
+    TEST_ASSERT_EQUAL_INT16(7, s.mean);
+    TEST_ASSERT_EQUAL_UINT32(2, s.variance);
+}
+
+void test_negative_mean_rounds_away_from_zero() {
+    RollingStatistics stats;
+    stats.setWindow(2);
+    stats.push(-5);
+    stats.push(-6);
+    TEST_ASSERT_EQUAL_INT16(-6, stats.summary().mean);  // -5.5
+    stats.push(-4);
+    TEST_ASSERT_EQUAL_INT16(-5, stats.summary().mean);  // -5.0
+}
+
+void test_full_range_samples() {
+    RollingStatistics stats;
+    stats.setWindow(8);
+    for (int i = 0; i < 16; i++) {
+        stats.push((i & 1) ? INT16_MAX : INT16_MIN);
+    }
+    ChannelStatistics s = stats.summary();
+    TEST_ASSERT_EQUAL_INT16(INT16_MIN, s.min);
+    TEST_ASSERT_EQUAL_INT16(INT16_MAX, s.max);
+    TEST_ASSERT_EQUAL_INT16(-1, s.mean);                // -0.5 rounds away from zero
+    TEST_ASSERT_EQUAL_UINT32(1073709056u, s.variance);  // 32767.5², truncated
+}
+
+void test_matches_brute_force() {
+    static int16_t samples[2000];
+    uint32_t lcg = 12345;
+    for (uint32_t i = 0; i < 2000; i++) {
+        lcg = lcg * 1103515245u + 12345u;
+        // Mix of noise, ramps and plateaus to exercise both deques
+        if (i % 300 < 100) {
+            samples[i] = static_cast<int16_t>(static_cast<int32_t>((lcg >> 16) % 2001) - 1000);
+        } else if (i % 300 < 200) {
+            samples[i] = static_cast<int16_t>(i % 300);
+        } else {
+            samples[i] = static_cast<int16_t>(-static_cast<int32_t>(i % 300));
+        }
+    }
+
+    const uint8_t windows[] = {1, 2, 3, 7, 16, RollingStatistics::CAPACITY};
+    for (uint8_t window : windows) {
+        RollingStatistics stats;
+        stats.setWindow(window);
+        for (uint32_t i = 0; i < 2000; i++) {
+            stats.push(samples[i]);
+            assertSummary(reference(samples, i + 1, window), stats.summary());
+        }
+    }
+}
+
+void test_reset_clears_window() {
+    RollingStatistics stats;
+    stats.setWindow(4);
+    for (int i = 0; i < 10; i++) {
+        stats.push(1000);
+    }
+    stats.reset();
+    TEST_ASSERT_EQUAL_UINT16(0, stats.summary().count);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.summary().totalSamples);
+
+    stats.push(-20);
+    ChannelStatistics s = stats.summary();
+    TEST_ASSERT_EQUAL_INT16(-20, s.min);
+    TEST_ASSERT_EQUAL_INT16(-20, s.max);
+    TEST_ASSERT_EQUAL_UINT32(0, s.variance);
+    TEST_ASSERT_EQUAL_UINT8(4, stats.getWindow());
+}
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_disabled_by_default);
+    RUN_TEST(test_window_bounds);
+    RUN_TEST(test_known_window);
+    RUN_TEST(test_negative_mean_rounds_away_from_zero);
+    RUN_TEST(test_full_range_samples);
+    RUN_TEST(test_matches_brute_force);
+    RUN_TEST(test_reset_clears_window);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_disabled_by_default);
+    RUN_TEST(test_window_bounds);
+    RUN_TEST(test_known_window);
+    RUN_TEST(test_negative_mean_rounds_away_from_zero);
+    RUN_TEST(test_full_range_samples);
+    RUN_TEST(test_matches_brute_force);
+    RUN_TEST(test_reset_clears_window);
+    return UNITY_END();
+}
+#endif
@@ -0,0 +1,211 @@
+/**
+ * @file test_mb8art_trace.cpp
+ * @brief Unit tests for the binary Modbus transaction trace
+ *
+ * MB8ARTTrace.h has no FreeRTOS dependency, so these tests run on the
+ * native (host) environment as well as on ESP32.
+ */
+
+#include <unity.h>
+#include <string.h>
+#include "MB8ARTTrace.h"
+
+#ifndef ARDUINO
+#include <thread>
+#include <stdio.h>
+#endif
+
+using mb8art::StaticTrace;
+using mb8art::TraceBlobReader;
+using mb8art::TraceEvent;
+using mb8art::TraceKind;
+
+// dump() sink collecting into a fixed buffer
+struct BlobSink {
+    uint8_t data[4096];
+    size_t used;
+};
+
+static bool collect(void* context, const uint8_t* data, size_t length) {
+    BlobSink* sink = static_cast<BlobSink*>(context);
+    if (sink->used + length > sizeof(sink->data)) {
+        return false;
+    }
+    memcpy(sink->data + sink->used, data, length);
+    sink->used += length;
+    return true;
+}
+
+static TraceEvent makeEvent(TraceKind kind, uint32_t us, uint16_t length) {
+    TraceEvent e;
+    e.timestampUs = us;
+    e.tick = us / 1000;
+    e.functionCode = 4;
+    e.address = 0;
+    e.length = length;
+    e.kind = kind;
+    return e;
+}
+
+static const uint8_t TEMPERATURE_FRAME[16] = {
+    0x00, 0xF4, 0x00, 0xF5, 0xFF, 0x9C, 0x75, 0x30,
+    0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x03
+};
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Record / dump / decode
+// ============================================================================
+
+void test_round_trip_with_payload() {
+    static StaticTrace<8, 16> trace;
+    trace.clear();
+    TraceEvent request = makeEvent(TraceKind::REQUEST, 1000, 16);
+    TraceEvent response = makeEvent(TraceKind::RESPONSE, 13500, 16);
+    response.rttUs = 12500;
+    TraceEvent error = makeEvent(TraceKind::ERROR, 20000, 0);
+    error.functionCode = 0;
+    error.result = 1;  // TIMEOUT
+
+    trace.record(request, nullptr);
+    trace.record(response, TEMPERATURE_FRAME);
+    trace.record(error, nullptr);
+
+    static BlobSink sink;
+    sink.used = 0;
+    TEST_ASSERT_EQUAL_INT(3, trace.dump(collect, &sink, 0x03));
+    TEST_ASSERT_EQUAL_UINT32(14 + 3 * 20 + 16, sink.used);
+
+    TraceBlobReader reader(sink.data, sink.used);
+    TEST_ASSERT_TRUE(reader.isValid());
+    TEST_ASSERT_EQUAL_UINT8(0x03, reader.serverAddress());
+    TEST_ASSERT_EQUAL_UINT16(3, reader.recordCount());
+
+    TraceEvent e;
+    TEST_ASSERT_TRUE(reader.next(e));
+    TEST_ASSERT_TRUE(e.kind == TraceKind::REQUEST);
+    TEST_ASSERT_EQUAL_UINT8(0, e.captured);
+    TEST_ASSERT_TRUE(reader.next(e));
+    TEST_ASSERT_TRUE(e.kind == TraceKind::RESPONSE);
+    TEST_ASSERT_EQUAL_UINT32(12500, e.rttUs);
+    TEST_ASSERT_EQUAL_UINT8(16, e.captured);
+    TEST_ASSERT_EQUAL_MEMORY(TEMPERATURE_FRAME, e.payload, 16);
+    TEST_ASSERT_TRUE(reader.next(e));
+    TEST_ASSERT_TRUE(e.kind == TraceKind::ERROR);
+    TEST_ASSERT_EQUAL_UINT8(1, e.result);
+    TEST_ASSERT_FALSE(reader.next(e));
+}
+
+void test_ring_keeps_newest_and_counts_lost() {
+    static StaticTrace<4, 4> trace;
+    trace.clear();
+    for (uint32_t i = 1; i <= 10; i++) {
+        trace.record(makeEvent(TraceKind::RESPONSE, i * 100, 16), TEMPERATURE_FRAME);
+    }
+
+    static BlobSink sink;
+    sink.used = 0;
+    TEST_ASSERT_EQUAL_INT(4, trace.dump(collect, &sink));
+    // lost field: records overwritten before the oldest kept one
+    uint32_t lost = sink.data[10] | (sink.data[11] << 8) | (sink.data[12] << 16) | (sink.data[13] << 24);
+    TEST_ASSERT_EQUAL_UINT32(6, lost);
+
+    TraceBlobReader reader(sink.data, sink.used);
+    TraceEvent e;
+    uint32_t expected = 700;
+    while (reader.next(e)) {
+        TEST_ASSERT_EQUAL_UINT32(expected, e.timestampUs);
+        TEST_ASSERT_EQUAL_UINT8(4, e.captured);      // Truncated to payload capacity
+        TEST_ASSERT_EQUAL_UINT16(16, e.length);      // Wire length preserved
+        expected += 100;
+    }
+    TEST_ASSERT_EQUAL_UINT32(1100, expected);
+}
+
+void test_reader_rejects_foreign_and_truncated_blobs() {
+    const uint8_t junk[20] = {'M', 'B', '8', 'X'};
+    TraceBlobReader foreign(junk, sizeof(junk));
+    TEST_ASSERT_FALSE(foreign.isValid());
+
+    static StaticTrace<4, 16> trace;
+    trace.clear();
+    trace.record(makeEvent(TraceKind::RESPONSE, 5, 16), TEMPERATURE_FRAME);
+    static BlobSink sink;
+    sink.used = 0;
+    trace.dump(collect, &sink);
+
+    TraceBlobReader truncated(sink.data, sink.used - 1);
+    TraceEvent e;
+    TEST_ASSERT_TRUE(truncated.isValid());
+    TEST_ASSERT_FALSE(truncated.next(e));
+}
+
+#ifndef ARDUINO
+// Request path, response context and error handler record at the same time
+void test_concurrent_writers() {
+    static StaticTrace<64, 0> trace;
+    trace.clear();
+    auto writer = [](TraceKind kind) {
+        for (uint32_t i = 0; i < 20000; i++) {
+            trace.record(makeEvent(kind, i, 0), nullptr);
+        }
+    };
+    std::thread a(writer, TraceKind::REQUEST);
+    std::thread b(writer, TraceKind::RESPONSE);
+    std::thread c(writer, TraceKind::ERROR);
+    a.join();
+    b.join();
+    c.join();
+
+    TEST_ASSERT_EQUAL_UINT32(60000, trace.totalRecorded());
+    static BlobSink sink;
+    sink.used = 0;
+    int written = trace.dump(collect, &sink);
+    TEST_ASSERT_TRUE(written > 0 && written <= 64);
+
+    TraceBlobReader reader(sink.data, sink.used);
+    TraceEvent e;
+    int decoded = 0;
+    while (reader.next(e)) {
+        TEST_ASSERT_TRUE(e.kind == TraceKind::REQUEST || e.kind == TraceKind::RESPONSE ||
+                         e.kind == TraceKind::ERROR);
+        decoded++;
+    }
+    TEST_ASSERT_EQUAL_INT(written, decoded);
+}
+#endif
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void setup() {
+    delay(2000);  // Allow time for serial to connect
+
+    UNITY_BEGIN();
+    RUN_TEST(test_round_trip_with_payload);
+    RUN_TEST(test_ring_keeps_newest_and_counts_lost);
+    RUN_TEST(test_reader_rejects_foreign_and_truncated_blobs);
+    UNITY_END();
+}
+
+void loop() {
+    // Nothing needed for tests
+}
+
+#else
+// Native platform uses main()
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_round_trip_with_payload);
+    RUN_TEST(test_ring_keeps_newest_and_counts_lost);
+    RUN_TEST(test_reader_rejects_foreign_and_truncated_blobs);
+    RUN_TEST(test_concurrent_writers);
+    return UNITY_END();
+}
+#endif
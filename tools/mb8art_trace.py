@@ -0,0 +1,187 @@
+#!/usr/bin/env python3
+"""Decode an MB8ART transaction trace (mb8art::TraceBuffer::dump()).
+
+Input is either the raw binary blob or a serial log in which the blob was
+printed as hex (anything that is not hex is ignored; if the log contains
+lines with "MB8T-BEGIN" / "MB8T-END" only the text between them is used).
+
+    mb8art_trace.py trace.bin                    # timeline
+    mb8art_trace.py serial.log --summary         # timeline + per-FC stats
+    mb8art_trace.py trace.bin --c-array field_trace > field_trace.h
+
+Error records carry the error name as payload. For dumps taken with a
+payload capacity too small to hold it, --modbus-types points at the
+ModbusTypes.h of the ESP32-ModbusDevice library the firmware was built
+with (e.g. .pio/libdeps/<env>/ESP32-ModbusDevice/src/ModbusTypes.h) and
+the names are taken from its ModbusError enum.
+
+The C array can be #included in a native test and fed to
+MockMB8ART::replayTrace() to reproduce a field sequence on the host build.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+HEADER = struct.Struct("<4sBBBBHI")     # magic, version, server, payload cap, reserved, count, lost
+RECORD = struct.Struct("<IIIHHBBBB")    # ts, tick, rtt, address, length, fc, kind, result, captured
+
+KINDS = {1: "REQ", 2: "RSP", 3: "ERR"}
+FUNCTION_CODES = {
+    1: "READ_COIL", 2: "READ_DISCR_INPUT", 3: "READ_HOLD_REGISTER",
+    4: "READ_INPUT_REGISTER", 5: "WRITE_COIL", 6: "WRITE_HOLD_REGISTER",
+    16: "WRITE_MULT_REGISTERS",
+}
+
+
+def load_error_names(path):
+    """Value -> name of modbus::ModbusError, parsed from ModbusTypes.h."""
+    with open(path, encoding="utf-8", errors="ignore") as f:
+        text = f.read()
+    text = re.sub(r"//[^\n]*|/\*.*?\*/", "", text, flags=re.S)
+    match = re.search(r"enum\s+class\s+ModbusError\b[^{]*\{(.*?)\}", text, re.S)
+    if not match:
+        raise ValueError("no ModbusError enum in %s" % path)
+    names = {}
+    value = 0
+    for entry in match.group(1).split(","):
+        entry = entry.strip()
+        if not entry:
+            continue
+        name, _, explicit = entry.partition("=")
+        if explicit.strip():
+            value = int(explicit.strip(), 0)
+        names[value] = name.strip()
+        value += 1
+    return names
+
+
+def error_name(record, error_names):
+    """Name from the record's payload (emitted by the driver), else from the enum."""
+    if record["length"] and len(record["payload"]) == record["length"]:
+        return record["payload"].decode("ascii", errors="replace")
+    if record["result"] in error_names:
+        return error_names[record["result"]]
+    if record["payload"]:
+        return record["payload"].decode("ascii", errors="replace") + "..."
+    return "ERROR_%d" % record["result"]
+
+
+def load_blob(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data.startswith(b"MB8T"):
+        return data
+    text = data.decode("ascii", errors="ignore")
+    if "MB8T-BEGIN" in text:
+        text = text.split("MB8T-BEGIN", 1)[1].split("MB8T-END", 1)[0]
+    digits = "".join(re.findall(r"\b[0-9A-Fa-f]{2}(?:[0-9A-Fa-f]{2})*\b", text))
+    blob = bytes.fromhex(digits)
+    start = blob.find(b"MB8T")
+    if start < 0:
+        raise ValueError("no MB8T trace header found")
+    return blob[start:]
+
+
+def parse(blob):
+    magic, version, server, payload_cap, _, count, lost = HEADER.unpack_from(blob, 0)
+    if magic != b"MB8T" or version != 1:
+        raise ValueError("unsupported trace (magic %r, version %d)" % (magic, version))
+    header = {"server": server, "payload_capacity": payload_cap, "count": count, "lost": lost}
+    records = []
+    offset = HEADER.size
+    while offset + RECORD.size <= len(blob):
+        ts, tick, rtt, address, length, fc, kind, result, captured = RECORD.unpack_from(blob, offset)
+        offset += RECORD.size
+        payload = blob[offset:offset + captured]
+        if len(payload) < captured:
+            break  # Truncated dump
+        offset += captured
+        records.append({"ts": ts, "tick": tick, "rtt": rtt, "address": address, "length": length,
+                        "fc": fc, "kind": kind, "result": result, "payload": payload})
+    return header, records
+
+
+def describe_payload(record):
+    payload = record["payload"]
+    if record["kind"] == 3:
+        return ""  # Error name, shown as the event
+    if record["kind"] == 2 and record["fc"] == 4 and record["address"] == 0 and len(payload) >= 2:
+        # Temperature registers: big-endian int16 per channel, native units
+        values = struct.unpack(">%dh" % (len(payload) // 2), payload[:len(payload) // 2 * 2])
+        return "raw=" + " ".join(str(v) for v in values)
+    return payload.hex(" ") if payload else ""
+
+
+def print_timeline(header, records, out, error_names):
+    out.write("server 0x%02X, %d records, %d overwritten before the oldest, payload capacity %d\n"
+              % (header["server"], len(records), header["lost"], header["payload_capacity"]))
+    if not records:
+        return
+    base = records[0]["ts"]
+    for r in records:
+        elapsed = ((r["ts"] - base) & 0xFFFFFFFF) / 1e6
+        kind = KINDS.get(r["kind"], "?%d" % r["kind"])
+        if r["kind"] == 3:
+            what = error_name(r, error_names)
+        else:
+            what = "%s @%d len=%d" % (FUNCTION_CODES.get(r["fc"], "FC%d" % r["fc"]), r["address"], r["length"])
+        rtt = " rtt=%.1fms" % (r["rtt"] / 1000.0) if r["rtt"] else ""
+        out.write("%12.6f  tick=%-10u %s  %s%s  %s\n" % (elapsed, r["tick"], kind, what, rtt,
+                                                      describe_payload(r)))
+
+
+def print_summary(records, out, error_names):
+    groups = {}
+    for r in records:
+        if r["kind"] == 3:
+            key = "ERR " + error_name(r, error_names)
+        else:
+            key = "%s %s@%d" % (KINDS.get(r["kind"], "?"), FUNCTION_CODES.get(r["fc"], r["fc"]), r["address"])
+        groups.setdefault(key, []).append(r["rtt"])
+    out.write("\n%-40s %8s %10s %10s\n" % ("event", "count", "rtt p50", "rtt max"))
+    for key in sorted(groups):
+        rtts = sorted(v for v in groups[key] if v)
+        p50 = "%.1fms" % (rtts[len(rtts) // 2] / 1000.0) if rtts else "-"
+        worst = "%.1fms" % (rtts[-1] / 1000.0) if rtts else "-"
+        out.write("%-40s %8d %10s %10s\n" % (key, len(groups[key]), p50, worst))
+
+
+def print_c_array(name, blob, out):
+    out.write("// Generated by tools/mb8art_trace.py - MB8ART trace for MockMB8ART::replayTrace()\n")
+    out.write("#pragma once\n#include <stdint.h>\n#include <stddef.h>\n\n")
+    out.write("static const uint8_t %s[] = {\n" % name)
+    for i in range(0, len(blob), 16):
+        out.write("    " + ", ".join("0x%02X" % b for b in blob[i:i + 16]) + ",\n")
+    out.write("};\nstatic const size_t %s_size = sizeof(%s);\n" % (name, name))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="binary blob or serial log with a hex dump")
+    parser.add_argument("--summary", action="store_true", help="append per-event counts and RTT")
+    parser.add_argument("--c-array", metavar="NAME", help="emit a C header for host replay instead")
+    parser.add_argument("--modbus-types", metavar="PATH",
+                        help="ModbusTypes.h to name errors whose name was not captured")
+    args = parser.parse_args()
+
+    try:
+        blob = load_blob(args.input)
+        header, records = parse(blob)
+        error_names = load_error_names(args.modbus_types) if args.modbus_types else {}
+    except (OSError, ValueError, struct.error) as e:
+        sys.stderr.write("mb8art_trace: %s\n" % e)
+        return 1
+
+    if args.c_array:
+        print_c_array(args.c_array, blob, sys.stdout)
+        return 0
+    print_timeline(header, records, sys.stdout, error_names)
+    if args.summary:
+        print_summary(records, sys.stdout, error_names)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())